@@ -53,6 +53,7 @@
 
 #include <AllClustersExampleDeviceInfoProviderImpl.h>
 #include <DeviceInfoProviderImpl.h>
+#include <MappedEventStorage.h>
 
 #if CHIP_DEVICE_CONFIG_ENABLE_BOTH_COMMISSIONER_AND_COMMISSIONEE
 #include "CommissionerMain.h"
@@ -339,6 +340,10 @@ LinuxCommissionableDataProvider gCommissionableDataProvider;
 chip::DeviceLayer::DeviceInfoProviderImpl gExampleDeviceInfoProvider;
 chip::DeviceLayer::AllClustersExampleDeviceInfoProviderImpl gAllClustersExampleDeviceInfoProvider;
 
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+MappedEventStorage gEventStorage;
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+
 void EventHandler(const DeviceLayer::ChipDeviceEvent * event, intptr_t arg)
 {
     (void) arg;
@@ -985,6 +990,22 @@ void ChipLinuxAppMainLoop(chip::ServerInitParams & initParams, AppMainLoopImplem
         initParams.advertiseCommissionableIfNoFabrics = false;
     }
 
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    if (LinuxDeviceOptions::GetInstance().eventLogFile != nullptr)
+    {
+        CHIP_ERROR eventStorageErr = gEventStorage.Init(LinuxDeviceOptions::GetInstance().eventLogFile);
+        if (eventStorageErr == CHIP_NO_ERROR)
+        {
+            initParams.eventLogStorageResources = gEventStorage.GetLogStorageResources();
+            initParams.eventStorageDelegate     = &gEventStorage;
+        }
+        else
+        {
+            ChipLogError(AppServer, "Failed to open the event log file: %" CHIP_ERROR_FORMAT, eventStorageErr.Format());
+        }
+    }
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+
     // Set DAC provider before server init because Operational Credentials may snapshot
     // the provider during cluster construction.
     SetDeviceAttestationCredentialsProvider(LinuxDeviceOptions::GetInstance().dacProvider);
@@ -1103,6 +1124,10 @@ void ChipLinuxAppMainLoop(chip::ServerInitParams & initParams, AppMainLoopImplem
 
     Server::GetInstance().Shutdown();
 
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    gEventStorage.Shutdown();
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+
 #if CHIP_DEVICE_CONFIG_ENABLE_BOTH_COMMISSIONER_AND_COMMISSIONEE
     ShutdownCommissioner();
 #endif // CHIP_DEVICE_CONFIG_ENABLE_BOTH_COMMISSIONER_AND_COMMISSIONEE
@@ -0,0 +1,177 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "MappedEventStorage.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kMagic   = 0x544E5645; // "EVNT"
+constexpr uint32_t kVersion = 1;
+
+constexpr uint32_t kBufferSizes[MappedEventStorage::kBufferCount] = {
+    CHIP_LINUX_APP_EVENT_LOG_FILE_DEBUG_BUFFER_SIZE,
+    CHIP_LINUX_APP_EVENT_LOG_FILE_INFO_BUFFER_SIZE,
+    CHIP_LINUX_APP_EVENT_LOG_FILE_CRIT_BUFFER_SIZE,
+};
+
+constexpr app::PriorityLevel kPriorities[MappedEventStorage::kBufferCount] = {
+    app::PriorityLevel::Debug,
+    app::PriorityLevel::Info,
+    app::PriorityLevel::Critical,
+};
+
+// Delay before buffer changes are flushed to the file, so that bursts of events are flushed at once.
+constexpr System::Clock::Milliseconds32 kSyncDelay(1000);
+
+} // namespace
+
+CHIP_ERROR MappedEventStorage::Init(const char * path)
+{
+    VerifyOrReturnError(mHeader == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t mappingSize = sizeof(Header);
+    for (uint32_t bufferSize : kBufferSizes)
+    {
+        mappingSize += bufferSize;
+    }
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct stat fileStat;
+    bool restorable;
+    void * mapping;
+    uint8_t * buffer;
+
+    VerifyOrExit(fstat(fd, &fileStat) == 0, err = CHIP_ERROR_POSIX(errno));
+    restorable = static_cast<size_t>(fileStat.st_size) == mappingSize;
+    if (!restorable)
+    {
+        VerifyOrExit(ftruncate(fd, static_cast<off_t>(mappingSize)) == 0, err = CHIP_ERROR_POSIX(errno));
+    }
+    mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    VerifyOrExit(mapping != MAP_FAILED, err = CHIP_ERROR_POSIX(errno));
+
+    mFd          = fd;
+    mMappingSize = mappingSize;
+    mHeader      = static_cast<Header *>(mapping);
+
+    restorable = restorable && mHeader->magic == kMagic && mHeader->version == kVersion &&
+        memcmp(mHeader->bufferSizes, kBufferSizes, sizeof(kBufferSizes)) == 0;
+    if (!restorable)
+    {
+        ChipLogProgress(EventLogging, "Resetting event log file %s", path);
+        memset(mHeader, 0, sizeof(Header));
+        mHeader->magic   = kMagic;
+        mHeader->version = kVersion;
+        memcpy(mHeader->bufferSizes, kBufferSizes, sizeof(kBufferSizes));
+    }
+
+    buffer = static_cast<uint8_t *>(mapping) + sizeof(Header);
+    for (uint32_t i = 0; i < kBufferCount; i++)
+    {
+        mResources[i].mpBuffer    = buffer;
+        mResources[i].mBufferSize = kBufferSizes[i];
+        mResources[i].mPriority   = kPriorities[i];
+        buffer += kBufferSizes[i];
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        close(fd);
+    }
+    return err;
+}
+
+void MappedEventStorage::Shutdown()
+{
+    VerifyOrReturn(mHeader != nullptr);
+
+    if (mSyncScheduled)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(SyncTimerHandler, this);
+        mSyncScheduled = false;
+    }
+    msync(mHeader, mMappingSize, MS_SYNC);
+    munmap(mHeader, mMappingSize);
+    close(mFd);
+
+    mHeader      = nullptr;
+    mMappingSize = 0;
+    mFd          = -1;
+}
+
+CHIP_ERROR MappedEventStorage::LoadBufferState(uint32_t aBufferIndex, uint32_t & aHeadOffset, uint32_t & aDataLength)
+{
+    VerifyOrReturnError(mHeader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aBufferIndex < kBufferCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const BufferState & state = mHeader->states[aBufferIndex];
+    VerifyOrReturnError(state.check == ComputeCheck(state.headOffset, state.dataLength), CHIP_ERROR_NOT_FOUND);
+
+    aHeadOffset = state.headOffset;
+    aDataLength = state.dataLength;
+    return CHIP_NO_ERROR;
+}
+
+void MappedEventStorage::SaveBufferState(uint32_t aBufferIndex, uint32_t aHeadOffset, uint32_t aDataLength)
+{
+    VerifyOrReturn(mHeader != nullptr && aBufferIndex < kBufferCount);
+
+    BufferState & state = mHeader->states[aBufferIndex];
+    state.headOffset    = aHeadOffset;
+    state.dataLength    = aDataLength;
+    state.check         = ComputeCheck(aHeadOffset, aDataLength);
+
+    if (!mSyncScheduled)
+    {
+        mSyncScheduled = DeviceLayer::SystemLayer().StartTimer(kSyncDelay, SyncTimerHandler, this) == CHIP_NO_ERROR;
+    }
+}
+
+uint32_t MappedEventStorage::ComputeCheck(uint32_t headOffset, uint32_t dataLength)
+{
+    return kMagic ^ headOffset ^ (dataLength * 0x9E3779B1u);
+}
+
+void MappedEventStorage::SyncTimerHandler(System::Layer * layer, void * appState)
+{
+    auto * self          = static_cast<MappedEventStorage *>(appState);
+    self->mSyncScheduled = false;
+    if (msync(self->mHeader, self->mMappingSize, MS_ASYNC) != 0)
+    {
+        ChipLogError(EventLogging, "Failed to flush the event log file: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+    }
+}
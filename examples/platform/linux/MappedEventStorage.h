@@ -0,0 +1,101 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/EventManagement.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Sizes of the Debug, Info and Critical event buffers kept in the event log file.  The file only costs memory for the
+// pages in use, so they default to more than the CHIP_DEVICE_CONFIG_EVENT_LOGGING_*_BUFFER_SIZE of the in-memory buffers.
+#ifndef CHIP_LINUX_APP_EVENT_LOG_FILE_DEBUG_BUFFER_SIZE
+#define CHIP_LINUX_APP_EVENT_LOG_FILE_DEBUG_BUFFER_SIZE (8 * 1024)
+#endif
+#ifndef CHIP_LINUX_APP_EVENT_LOG_FILE_INFO_BUFFER_SIZE
+#define CHIP_LINUX_APP_EVENT_LOG_FILE_INFO_BUFFER_SIZE (8 * 1024)
+#endif
+#ifndef CHIP_LINUX_APP_EVENT_LOG_FILE_CRIT_BUFFER_SIZE
+#define CHIP_LINUX_APP_EVENT_LOG_FILE_CRIT_BUFFER_SIZE (16 * 1024)
+#endif
+
+/**
+ * Event log storage for the Linux examples, backed by a memory-mapped file so that the events logged before a restart
+ * can be restored.
+ *
+ * The file holds a header, with the state of each buffer, followed by the Debug, Info and Critical event buffers.
+ * Events are logged directly in the mapping, so persisting them costs nothing on the logging path: the kernel writes
+ * back the dirty pages, and an msync is scheduled shortly after buffers change so that they also survive a power loss.
+ *
+ * A file that does not match the configured buffer sizes is reset.
+ */
+class MappedEventStorage : public chip::app::EventStorageDelegate
+{
+public:
+    static constexpr uint32_t kBufferCount = 3;
+
+    ~MappedEventStorage() override { Shutdown(); }
+
+    /**
+     * Map the event log file at @a path, creating it if needed.
+     */
+    CHIP_ERROR Init(const char * path);
+
+    /**
+     * Flush and unmap the event log file.  Must be called once the event management is shut down.
+     */
+    void Shutdown();
+
+    /**
+     * The storage of the Debug, Info and Critical event buffers, in that order, to be passed to the event management.
+     * Valid between Init() and Shutdown().
+     */
+    const chip::app::LogStorageResources * GetLogStorageResources() const { return mResources; }
+
+    CHIP_ERROR LoadBufferState(uint32_t aBufferIndex, uint32_t & aHeadOffset, uint32_t & aDataLength) override;
+    void SaveBufferState(uint32_t aBufferIndex, uint32_t aHeadOffset, uint32_t aDataLength) override;
+
+private:
+    struct BufferState
+    {
+        uint32_t headOffset;
+        uint32_t dataLength;
+        // Detects a state torn by a crash in the middle of its update.
+        uint32_t check;
+    };
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t bufferSizes[kBufferCount];
+        BufferState states[kBufferCount];
+    };
+
+    static uint32_t ComputeCheck(uint32_t headOffset, uint32_t dataLength);
+    static void SyncTimerHandler(chip::System::Layer * layer, void * appState);
+
+    chip::app::LogStorageResources mResources[kBufferCount];
+    Header * mHeader    = nullptr;
+    size_t mMappingSize = 0;
+    int mFd             = -1;
+    bool mSyncScheduled = false;
+};
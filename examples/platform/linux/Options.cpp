@@ -93,6 +93,7 @@ enum
     kDeviceOption_Command,
     kDeviceOption_PICS,
     kDeviceOption_KVS,
+    kDeviceOption_EventLogFile,
     kDeviceOption_InterfaceId,
     kDeviceOption_AppPipe,
     kDeviceOption_AppPipeOut,
@@ -208,6 +209,7 @@ OptionDef sDeviceOptionDefs[] = {
     { "command", kArgumentRequired, kDeviceOption_Command },
     { "PICS", kArgumentRequired, kDeviceOption_PICS },
     { "KVS", kArgumentRequired, kDeviceOption_KVS },
+    { "event-log-file", kArgumentRequired, kDeviceOption_EventLogFile },
     { "interface-id", kArgumentRequired, kDeviceOption_InterfaceId },
     { "app-pipe", kArgumentRequired, kDeviceOption_AppPipe },
     { "app-pipe-out", kArgumentRequired, kDeviceOption_AppPipeOut },
@@ -376,6 +378,9 @@ const char * sDeviceOptionHelp =
     "  --KVS <filepath>\n"
     "       A file to store Key Value Store items.\n"
     "\n"
+    "  --event-log-file <filepath>\n"
+    "       A file to store event logs in, so that they survive restarts.\n"
+    "\n"
     "  --interface-id <interface>\n"
     "       A interface id to advertise on.\n"
     "\n"
@@ -746,6 +751,10 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
         LinuxDeviceOptions::GetInstance().KVS = aValue;
         break;
 
+    case kDeviceOption_EventLogFile:
+        LinuxDeviceOptions::GetInstance().eventLogFile = aValue;
+        break;
+
     case kDeviceOption_AppPipe:
         LinuxDeviceOptions::GetInstance().app_pipe = aValue;
         break;
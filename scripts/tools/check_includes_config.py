@@ -34,6 +34,9 @@ IGNORE: set[str] = {
     '/tests/',
     '/tools/',
 
+    # Benchmarks only run on host builds.
+    'src/benchmarks/',
+
     # Platforms can opt in or out.
     '/darwin/',
     '/platform/Ameba/',
@@ -128,7 +131,7 @@ DENY: set[str] = {
 
     # CHIP headers using STL containers.
     'app/data-model/ListLargeSystemExtensions.h',      # uses std::set
-    'src/platform/DeviceSafeQueue.h',   # uses std::deque
+    'src/platform/DeviceEventQueue.h',  # uses std::queue
 }
 
 
@@ -148,7 +151,7 @@ ALLOW: dict[str, set[str]] = {
 
     # Itself in DENY.
     'src/app/data-model/ListLargeSystemExtensions.h': {'set'},
-    'src/platform/DeviceSafeQueue.h': {'queue'},
+    'src/platform/DeviceEventQueue.h': {'queue'},
 
     # Only uses <chrono> for zero-cost types.
     'src/system/SystemClock.h': {'chrono'},
@@ -24,10 +24,15 @@
 #include "AccessControl.h"
 
 #include <lib/core/Global.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/FibonacciHash.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 #include <lib/support/TypeTraits.h>
 
 #include <credentials/GroupDataProvider.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Access {
 
@@ -73,6 +78,39 @@ bool CheckRequestPrivilegeAgainstEntryPrivilege(Privilege requestPrivilege, Priv
     return false;
 }
 
+// Privilege bits of the requests granted by an entry with the given privilege.
+uint8_t GetGrantedPrivileges(Privilege entryPrivilege)
+{
+    uint8_t granted = 0;
+    for (Privilege requestPrivilege :
+         { Privilege::kView, Privilege::kProxyView, Privilege::kOperate, Privilege::kManage, Privilege::kAdminister })
+    {
+        if (CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, entryPrivilege))
+        {
+            granted = static_cast<uint8_t>(granted | to_underlying(requestPrivilege));
+        }
+    }
+    return granted;
+}
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+static_assert((CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE & (CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE - 1)) == 0,
+              "CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE must be a power of two");
+
+// Decisions are cached direct-mapped, so that looking one up is a single comparison.
+size_t GetCachedDecisionSlot(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                             Privilege requestPrivilege)
+{
+    uint32_t hash = static_cast<uint32_t>(subjectDescriptor.subject) ^ static_cast<uint32_t>(subjectDescriptor.subject >> 32);
+    hash          = FibonacciHashCombine(hash, requestPath.cluster);
+    hash          = FibonacciHashCombine(hash,
+                                         static_cast<uint32_t>(requestPath.endpoint) |
+                                             (static_cast<uint32_t>(to_underlying(requestPrivilege)) << 16) |
+                                             (static_cast<uint32_t>(subjectDescriptor.fabricIndex) << 24));
+    return FibonacciHashIndex(hash, CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE);
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
 constexpr bool IsValidCaseNodeId(NodeId aNodeId)
 {
     if (IsOperationalNodeId(aNodeId))
@@ -213,6 +251,243 @@ char GetRequestTypeStringForLogging(RequestType requestType)
 Global<AccessControl::Entry::Delegate> AccessControl::Entry::mDefaultDelegate;
 Global<AccessControl::EntryIterator::Delegate> AccessControl::EntryIterator::mDefaultDelegate;
 
+/**
+ * The ACL entries of a fabric as flat arrays, so that checks do not go through the entry delegates,
+ * and only look at the entries naming the subject being checked.
+ *
+ * Entry subjects are kept sorted: entries without subjects are filed under kUndefinedNodeId, and the
+ * CAT subjects of a CAT identifier are contiguous, in increasing version order.
+ */
+class AccessControl::CompiledEntries
+{
+public:
+    explicit CompiledEntries(FabricIndex fabricIndex) : mFabricIndex(fabricIndex) {}
+
+    /**
+     * Compile the current entries of the fabric.
+     *
+     * Fails with CHIP_ERROR_INCORRECT_STATE for entries that CheckEntries would report as inconsistent.
+     */
+    CHIP_ERROR Compile(const AccessControl & accessControl);
+
+    /**
+     * Same result as CheckEntries, for compiled entries.
+     *
+     * @retval #CHIP_NO_ERROR if allowed.
+     * @retval #CHIP_ERROR_ACCESS_DENIED if denied.
+     */
+    CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                     DeviceTypeResolver & deviceTypeResolver) const;
+
+    FabricIndex GetFabricIndex() const { return mFabricIndex; }
+
+    // Whether checks depend on the device types of endpoints, which may change without the entries changing.
+    bool HasDeviceTypeTargets() const { return mHasDeviceTypeTargets; }
+
+private:
+    struct CompiledEntry
+    {
+        size_t firstTarget;
+        size_t targetCount;
+        AuthMode authMode;
+        uint8_t grantedPrivileges;
+    };
+
+    struct CompiledSubject
+    {
+        NodeId subject;
+        size_t entry;
+    };
+
+    // Whether an entry filed under a subject in [first, last] matches.
+    template <typename Matches>
+    bool AnySubjectMatches(NodeId first, NodeId last, Matches && matches) const
+    {
+        const CompiledSubject * const end = mSubjects.Get() + mSubjectCount;
+        const CompiledSubject * subject   = std::lower_bound(
+            mSubjects.Get(), end, first, [](const CompiledSubject & compiled, NodeId value) { return compiled.subject < value; });
+        for (; subject != end && subject->subject <= last; ++subject)
+        {
+            if (matches(mEntries[subject->entry]))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const FabricIndex mFabricIndex;
+    bool mHasDeviceTypeTargets = false;
+
+    Platform::ScopedMemoryBuffer<CompiledEntry> mEntries;
+    Platform::ScopedMemoryBuffer<CompiledSubject> mSubjects;
+    Platform::ScopedMemoryBuffer<Entry::Target> mTargets;
+    size_t mEntryCount   = 0;
+    size_t mSubjectCount = 0;
+    size_t mTargetCount  = 0;
+};
+
+CHIP_ERROR AccessControl::CompiledEntries::Compile(const AccessControl & accessControl)
+{
+    // Count first, so that the arrays are allocated at their exact size.
+    size_t entryCapacity   = 0;
+    size_t subjectCapacity = 0;
+    size_t targetCapacity  = 0;
+    {
+        EntryIterator iterator;
+        ReturnErrorOnFailure(accessControl.Entries(iterator, &mFabricIndex));
+
+        Entry entry;
+        CHIP_ERROR err;
+        while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+        {
+            size_t count = 0;
+            ReturnErrorOnFailure(entry.GetSubjectCount(count));
+            subjectCapacity += (count > 0) ? count : 1;
+            ReturnErrorOnFailure(entry.GetTargetCount(count));
+            targetCapacity += count;
+            entryCapacity++;
+        }
+        // Iteration may also stop early, e.g. when out of entry delegates.
+        VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+    }
+
+    if (entryCapacity > 0)
+    {
+        VerifyOrReturnError(mEntries.Alloc(entryCapacity) && mSubjects.Alloc(subjectCapacity), CHIP_ERROR_NO_MEMORY);
+    }
+    if (targetCapacity > 0)
+    {
+        VerifyOrReturnError(mTargets.Alloc(targetCapacity), CHIP_ERROR_NO_MEMORY);
+    }
+
+    EntryIterator iterator;
+    ReturnErrorOnFailure(accessControl.Entries(iterator, &mFabricIndex));
+
+    Entry entry;
+    CHIP_ERROR err;
+    while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(mEntryCount < entryCapacity, CHIP_ERROR_INCORRECT_STATE);
+
+        AuthMode authMode = AuthMode::kNone;
+        ReturnErrorOnFailure(entry.GetAuthMode(authMode));
+        // Operational PASE not supported for v1.0.
+        VerifyOrReturnError(authMode == AuthMode::kCase || authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+
+        Privilege privilege = Privilege::kView;
+        ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+
+        size_t subjectCount = 0;
+        ReturnErrorOnFailure(entry.GetSubjectCount(subjectCount));
+        VerifyOrReturnError(subjectCount <= subjectCapacity - mSubjectCount, CHIP_ERROR_INCORRECT_STATE);
+        for (size_t i = 0; i < subjectCount; ++i)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+            {
+                VerifyOrReturnError(authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+            }
+            else
+            {
+                // Operational PASE not supported for v1.0.
+                VerifyOrReturnError(IsGroupId(subject) && authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+            }
+            mSubjects[mSubjectCount++] = { subject, mEntryCount };
+        }
+        if (subjectCount == 0)
+        {
+            VerifyOrReturnError(mSubjectCount < subjectCapacity, CHIP_ERROR_INCORRECT_STATE);
+            mSubjects[mSubjectCount++] = { kUndefinedNodeId, mEntryCount };
+        }
+
+        size_t targetCount = 0;
+        ReturnErrorOnFailure(entry.GetTargetCount(targetCount));
+        VerifyOrReturnError(targetCount <= targetCapacity - mTargetCount, CHIP_ERROR_INCORRECT_STATE);
+        mEntries[mEntryCount] = { mTargetCount, targetCount, authMode, GetGrantedPrivileges(privilege) };
+        for (size_t i = 0; i < targetCount; ++i)
+        {
+            Entry::Target & target = mTargets[mTargetCount++];
+            ReturnErrorOnFailure(entry.GetTarget(i, target));
+            mHasDeviceTypeTargets = mHasDeviceTypeTargets || (target.flags & Entry::Target::kDeviceType);
+        }
+
+        mEntryCount++;
+    }
+    VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+
+    std::sort(mSubjects.Get(), mSubjects.Get() + mSubjectCount,
+              [](const CompiledSubject & a, const CompiledSubject & b) { return a.subject < b.subject; });
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AccessControl::CompiledEntries::Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                                 Privilege requestPrivilege, DeviceTypeResolver & deviceTypeResolver) const
+{
+    auto matches = [&](const CompiledEntry & entry) {
+        if (entry.authMode != subjectDescriptor.authMode || (entry.grantedPrivileges & to_underlying(requestPrivilege)) == 0)
+        {
+            return false;
+        }
+        if (entry.targetCount == 0)
+        {
+            return true;
+        }
+        for (size_t i = entry.firstTarget; i < entry.firstTarget + entry.targetCount; ++i)
+        {
+            const Entry::Target & target = mTargets[i];
+            if (((target.flags & Entry::Target::kCluster) && target.cluster != requestPath.cluster) ||
+                ((target.flags & Entry::Target::kEndpoint) && target.endpoint != requestPath.endpoint) ||
+                ((target.flags & Entry::Target::kDeviceType) &&
+                 !deviceTypeResolver.IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint)))
+            {
+                continue;
+            }
+            return true;
+        }
+        return false;
+    };
+
+    // Entries without subjects match any subject.
+    if (AnySubjectMatches(kUndefinedNodeId, kUndefinedNodeId, matches))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    const NodeId subject = subjectDescriptor.subject;
+    if (subjectDescriptor.authMode == AuthMode::kCase)
+    {
+        if (IsOperationalNodeId(subject) && AnySubjectMatches(subject, subject, matches))
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        // A CAT subject matches the CATs of the same identifier and at least the same (non-zero) version.
+        for (auto cat : subjectDescriptor.cats.values)
+        {
+            if (cat == kUndefinedCAT || GetCASEAuthTagVersion(cat) == 0)
+            {
+                continue;
+            }
+            const CASEAuthTag firstVersion = (static_cast<CASEAuthTag>(GetCASEAuthTagIdentifier(cat)) << kTagIdentifierShift) | 1;
+            if (AnySubjectMatches(NodeIdFromCASEAuthTag(firstVersion), NodeIdFromCASEAuthTag(cat), matches))
+            {
+                return CHIP_NO_ERROR;
+            }
+        }
+    }
+    else if (subjectDescriptor.authMode == AuthMode::kGroup)
+    {
+        if (IsGroupId(subject) && AnySubjectMatches(subject, subject, matches))
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    return CHIP_ERROR_ACCESS_DENIED;
+}
+
 CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeResolver & deviceTypeResolver)
 {
     VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
@@ -234,6 +509,7 @@ void AccessControl::Finish()
 {
     VerifyOrReturn(IsInitialized());
     ChipLogProgress(DataManagement, "AccessControl: finishing");
+    InvalidateCompiledEntries();
     mDelegate->Finish();
     mDelegate = nullptr;
 
@@ -439,6 +715,45 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+    CHIP_ERROR result                     = CHIP_NO_ERROR;
+    const CachedDecision * cachedDecision = FindCachedDecision(subjectDescriptor, requestPath, requestPrivilege);
+    if (cachedDecision != nullptr)
+    {
+        result = cachedDecision->allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    }
+    else if (CompiledEntries * compiledEntries = GetCompiledEntries(subjectDescriptor.fabricIndex))
+    {
+        result = compiledEntries->Check(subjectDescriptor, requestPath, requestPrivilege, *mDeviceTypeResolver);
+        // Endpoints may gain or lose device types without the entries changing, so such checks are not remembered.
+        if (!compiledEntries->HasDeviceTypeTargets())
+        {
+            CacheDecision(subjectDescriptor, requestPath, requestPrivilege, result == CHIP_NO_ERROR);
+        }
+    }
+    else
+    {
+        result = CheckEntries(subjectDescriptor, requestPath, requestPrivilege);
+    }
+
+    if (result == CHIP_NO_ERROR)
+    {
+        // Entry passed all checks: access is allowed.
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+        ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+    }
+    else if (result == CHIP_ERROR_ACCESS_DENIED)
+    {
+        // No entry was found which passed all checks: access is denied.
+        ChipLogProgress(DataManagement, "AccessControl: denied");
+    }
+
+    return result;
+}
+
+CHIP_ERROR AccessControl::CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege)
+{
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -540,19 +855,124 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
             }
         }
         // Entry passed all checks: access is allowed.
-
-#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
-        ChipLogProgress(DataManagement, "AccessControl: allowed");
-#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
-
         return CHIP_NO_ERROR;
     }
 
     // No entry was found which passed all checks: access is denied.
-    ChipLogProgress(DataManagement, "AccessControl: denied");
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+AccessControl::CompiledEntries * AccessControl::GetCompiledEntries(FabricIndex fabric)
+{
+    for (CompiledEntries * compiledEntries : mCompiledEntries)
+    {
+        if (compiledEntries != nullptr && compiledEntries->GetFabricIndex() == fabric)
+        {
+            return compiledEntries;
+        }
+    }
+
+    CompiledEntries * compiledEntries = Platform::New<CompiledEntries>(fabric);
+    VerifyOrReturnValue(compiledEntries != nullptr, nullptr);
+    CHIP_ERROR err = compiledEntries->Compile(*this);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Inconsistent entries are left to CheckEntries, which reports them when they are reached.
+        ChipLogDetail(DataManagement, "AccessControl: not compiling fabric %u: %" CHIP_ERROR_FORMAT, fabric, err.Format());
+        Platform::Delete(compiledEntries);
+        return nullptr;
+    }
+
+    // Use a free slot, or else replace the compiled entries of other fabrics in turn.
+    size_t slot = mNextCompiledEntries;
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(mCompiledEntries); ++i)
+    {
+        if (mCompiledEntries[i] == nullptr)
+        {
+            slot = i;
+            break;
+        }
+    }
+    mNextCompiledEntries = (slot + 1) % MATTER_ARRAY_SIZE(mCompiledEntries);
+
+    Platform::Delete(mCompiledEntries[slot]);
+    mCompiledEntries[slot] = compiledEntries;
+    return compiledEntries;
+}
+
+void AccessControl::InvalidateCompiledEntries(FabricIndex fabric)
+{
+    for (CompiledEntries *& compiledEntries : mCompiledEntries)
+    {
+        if (compiledEntries != nullptr && compiledEntries->GetFabricIndex() == fabric)
+        {
+            Platform::Delete(compiledEntries);
+            compiledEntries = nullptr;
+        }
+    }
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    for (CachedDecision & decision : mCachedDecisions)
+    {
+        if (decision.fabricIndex == fabric)
+        {
+            decision.fabricIndex = kUndefinedFabricIndex;
+        }
+    }
+#endif
+}
+
+void AccessControl::InvalidateCompiledEntries()
+{
+    for (CompiledEntries *& compiledEntries : mCompiledEntries)
+    {
+        Platform::Delete(compiledEntries);
+        compiledEntries = nullptr;
+    }
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    for (CachedDecision & decision : mCachedDecisions)
+    {
+        decision.fabricIndex = kUndefinedFabricIndex;
+    }
+#endif
+}
+
+const AccessControl::CachedDecision * AccessControl::FindCachedDecision(const SubjectDescriptor & subjectDescriptor,
+                                                                        const RequestPath & requestPath,
+                                                                        Privilege requestPrivilege) const
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    VerifyOrReturnValue(subjectDescriptor.fabricIndex != kUndefinedFabricIndex, nullptr);
+    const CachedDecision & decision = mCachedDecisions[GetCachedDecisionSlot(subjectDescriptor, requestPath, requestPrivilege)];
+    if (decision.fabricIndex == subjectDescriptor.fabricIndex && decision.authMode == subjectDescriptor.authMode &&
+        decision.subject == subjectDescriptor.subject && decision.cats.values == subjectDescriptor.cats.values &&
+        decision.cluster == requestPath.cluster && decision.endpoint == requestPath.endpoint &&
+        decision.privilege == requestPrivilege)
+    {
+        return &decision;
+    }
+#endif
+    return nullptr;
+}
+
+void AccessControl::CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                  Privilege requestPrivilege, bool allowed)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    VerifyOrReturn(subjectDescriptor.fabricIndex != kUndefinedFabricIndex);
+    CachedDecision & decision = mCachedDecisions[GetCachedDecisionSlot(subjectDescriptor, requestPath, requestPrivilege)];
+    decision.subject          = subjectDescriptor.subject;
+    decision.cats             = subjectDescriptor.cats;
+    decision.cluster          = requestPath.cluster;
+    decision.endpoint         = requestPath.endpoint;
+    decision.fabricIndex      = subjectDescriptor.fabricIndex;
+    decision.authMode         = subjectDescriptor.authMode;
+    decision.privilege        = requestPrivilege;
+    decision.allowed          = allowed;
+#endif
+}
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 CHIP_ERROR AccessControl::CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                    Privilege requestPrivilege)
@@ -767,6 +1187,8 @@ exit:
 void AccessControl::NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index,
                                        const Entry * entry, EntryListener::ChangeType changeType)
 {
+    InvalidateCompiledEntries(fabric);
+
     for (EntryListener * listener = mEntryListener; listener != nullptr; listener = listener->mNext)
     {
         listener->OnEntryChanged(subjectDescriptor, fabric, index, entry, changeType);
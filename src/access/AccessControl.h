@@ -438,6 +438,8 @@ public:
         {
             mDelegate->Release();
         }
+
+        InvalidateCompiledEntries();
     }
 
     /**
@@ -525,6 +527,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCompiledEntries();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -575,6 +578,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCompiledEntries();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -596,6 +600,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCompiledEntries();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -736,6 +741,26 @@ public:
 #endif
 
 private:
+    /**
+     * The ACL entries of a fabric, compiled for CheckACL into an index by subject.
+     */
+    class CompiledEntries;
+
+    /**
+     * A remembered result of CheckACL.
+     */
+    struct CachedDecision
+    {
+        NodeId subject;
+        CATValues cats;
+        ClusterId cluster;
+        EndpointId endpoint;
+        FabricIndex fabricIndex = kUndefinedFabricIndex; // kUndefinedFabricIndex if unused
+        AuthMode authMode;
+        Privilege privilege;
+        bool allowed;
+    };
+
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
@@ -747,6 +772,30 @@ private:
      */
     CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Check ACL entries one by one, for fabrics whose entries cannot be compiled.
+     */
+    CHIP_ERROR CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege);
+
+    /**
+     * Get the compiled ACL entries of a fabric, compiling them if needed.
+     *
+     * @return nullptr if the entries of the fabric cannot be compiled.
+     */
+    CompiledEntries * GetCompiledEntries(FabricIndex fabric);
+
+    /**
+     * Drop the compiled ACL entries and cached decisions of a fabric, or of all fabrics.
+     */
+    void InvalidateCompiledEntries(FabricIndex fabric);
+    void InvalidateCompiledEntries();
+
+    const CachedDecision * FindCachedDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                              Privilege requestPrivilege) const;
+    void CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                       bool allowed);
+
     /**
      * Check CommissioningARL or ARL (as appropriate) for whether access (by a
      * subject descriptor, to a request path, requiring a privilege) should
@@ -770,6 +819,14 @@ private:
 
     EntryListener * mEntryListener = nullptr;
 
+    // Compiled once per fabric on first check, and dropped whenever the entries of the fabric change.
+    CompiledEntries * mCompiledEntries[CHIP_CONFIG_MAX_FABRICS] = {};
+    size_t mNextCompiledEntries                                 = 0;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    CachedDecision mCachedDecisions[CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE];
+#endif
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
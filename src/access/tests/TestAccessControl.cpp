@@ -1990,6 +1990,76 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+// Prepares a CASE entry of fabric 1 granting View on the OnOff cluster to `subject` (or to any subject if undefined).
+CHIP_ERROR PrepareOnOffViewEntry(Entry & entry, NodeId subject)
+{
+    ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+    ReturnErrorOnFailure(entry.SetFabricIndex(1));
+    ReturnErrorOnFailure(entry.SetPrivilege(Privilege::kView));
+    ReturnErrorOnFailure(entry.SetAuthMode(AuthMode::kCase));
+    if (subject != kUndefinedNodeId)
+    {
+        ReturnErrorOnFailure(entry.AddSubject(nullptr, subject));
+    }
+    return entry.AddTarget(nullptr, Target{ Target::kCluster, kOnOffCluster, 0, 0 });
+}
+
+// Checks must follow changes of the entries, whichever API made them. Entries are released before checking,
+// since the example delegate may have a single entry delegate.
+TEST_F(TestAccessControl, TestCheckAfterEntryChanges)
+{
+    const SubjectDescriptor node0{ .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId0 };
+    const SubjectDescriptor catSubject{ .fabricIndex = 1,
+                                        .authMode    = AuthMode::kCase,
+                                        .subject     = kOperationalNodeId1,
+                                        .cats        = { { kCASEAuthTag3 } } };
+    const RequestPath onOff{ .cluster = kOnOffCluster, .endpoint = 1, .requestType = RequestType::kAttributeReadRequest };
+
+    EXPECT_EQ(accessControl.Check(node0, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    {
+        Entry entry;
+        ASSERT_EQ(PrepareOnOffViewEntry(entry, kOperationalNodeId0), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.CreateEntry(nullptr, 1, nullptr, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(node0, onOff, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(node0, onOff, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(node0, onOff, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(catSubject, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // A CAT subject is matched by any version at least as large.
+    {
+        Entry entry;
+        ASSERT_EQ(PrepareOnOffViewEntry(entry, kCASEAuthTagAsNodeId2), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.UpdateEntry(nullptr, 1, 0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(node0, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(catSubject, onOff, Privilege::kView), CHIP_NO_ERROR);
+
+    {
+        Entry entry;
+        ASSERT_EQ(PrepareOnOffViewEntry(entry, kCASEAuthTagAsNodeId4), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.UpdateEntry(0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(catSubject, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // Without subjects, the entry grants access to every subject of its auth mode.
+    {
+        Entry entry;
+        ASSERT_EQ(PrepareOnOffViewEntry(entry, kUndefinedNodeId), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.UpdateEntry(nullptr, 1, 0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(node0, onOff, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(catSubject, onOff, Privilege::kView), CHIP_NO_ERROR);
+
+    // Entries of other fabrics do not apply.
+    SubjectDescriptor otherFabric = node0;
+    otherFabric.fabricIndex       = 2;
+    EXPECT_EQ(accessControl.Check(otherFabric, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    ASSERT_EQ(accessControl.DeleteEntry(nullptr, 1, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(node0, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
@@ -30,9 +30,57 @@ using namespace chip::app::DataModel;
 namespace chip {
 namespace app {
 
-AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position) :
-    mDataModelProvider(dataModel), mPosition(position)
-{}
+AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position,
+                                                         DataModel::MetadataSnapshot * snapshot) :
+    mDataModelProvider(dataModel), mPosition(position), mSnapshot(snapshot)
+{
+    if (mSnapshot != nullptr)
+    {
+        mSnapshotEpoch = mSnapshot->Validate(mDataModelProvider);
+    }
+}
+
+void AttributePathExpandIterator::FetchEndpoints()
+{
+    if (mSnapshot != nullptr)
+    {
+        if (auto endpoints = mSnapshot->Endpoints(mDataModelProvider); endpoints.has_value())
+        {
+            mEndpoints = *endpoints;
+            return;
+        }
+    }
+    mEndpointsBuffer = mDataModelProvider->EndpointsIgnoreError();
+    mEndpoints       = mEndpointsBuffer;
+}
+
+void AttributePathExpandIterator::FetchClusters(EndpointId endpointId)
+{
+    if (mSnapshot != nullptr)
+    {
+        if (auto clusters = mSnapshot->ServerClusters(mDataModelProvider, endpointId); clusters.has_value())
+        {
+            mClusters = *clusters;
+            return;
+        }
+    }
+    mClustersBuffer = mDataModelProvider->ServerClustersIgnoreError(endpointId);
+    mClusters       = mClustersBuffer;
+}
+
+void AttributePathExpandIterator::FetchAttributes(const ConcreteClusterPath & path)
+{
+    if (mSnapshot != nullptr)
+    {
+        if (auto attributes = mSnapshot->Attributes(mDataModelProvider, path); attributes.has_value())
+        {
+            mAttributes = *attributes;
+            return;
+        }
+    }
+    mAttributesBuffer = mDataModelProvider->AttributesIgnoreError(path);
+    mAttributes       = mAttributesBuffer;
+}
 
 bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::AttributeEntry> * entry)
 {
@@ -95,6 +143,20 @@ bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::Att
 
 bool AttributePathExpandIterator::Next(ConcreteAttributePath & path, std::optional<DataModel::AttributeEntry> * entry)
 {
+    if (mSnapshot != nullptr)
+    {
+        const uint32_t epoch = mSnapshot->Validate(mDataModelProvider);
+        if (epoch != mSnapshotEpoch)
+        {
+            // The lists taken from the snapshot were released: fetch them again, positioned on the
+            // current output path, as a new iterator would.
+            mSnapshotEpoch  = epoch;
+            mEndpointIndex  = kInvalidIndex;
+            mClusterIndex   = kInvalidIndex;
+            mAttributeIndex = kInvalidIndex;
+        }
+    }
+
     while (mPosition.mAttributePath != nullptr)
     {
         if (AdvanceOutputPath(entry))
@@ -122,7 +184,7 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optio
     if (mAttributeIndex == kInvalidIndex)
     {
         // start a new iteration of attributes on the current cluster path.
-        mAttributes = mDataModelProvider->AttributesIgnoreError(mPosition.mOutputPath);
+        FetchAttributes(mPosition.mOutputPath);
 
         if (mPosition.mOutputPath.mAttributeId != kInvalidAttributeId)
         {
@@ -214,7 +276,7 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
     if (mClusterIndex == kInvalidIndex)
     {
         // start a new iteration on the current endpoint
-        mClusters = mDataModelProvider->ServerClustersIgnoreError(mPosition.mOutputPath.mEndpointId);
+        FetchClusters(mPosition.mOutputPath.mEndpointId);
 
         if (mPosition.mOutputPath.mClusterId != kInvalidClusterId)
         {
@@ -276,7 +338,7 @@ std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
     if (mEndpointIndex == kInvalidIndex)
     {
         // index is missing, have to start a new iteration
-        mEndpoints = mDataModelProvider->EndpointsIgnoreError();
+        FetchEndpoints();
 
         if (mPosition.mOutputPath.mEndpointId != kInvalidEndpointId)
         {
@@ -19,6 +19,7 @@
 
 #include <app/AttributePathParams.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/data-model-provider/Provider.h>
 #include <lib/core/DataModelTypes.h>
@@ -61,6 +62,9 @@ namespace app {
 ///    - `position` is automatically updated by the AttributePathExpandIterator, so
 ///      calling `Next` on the iterator will update the position cursor variable.
 ///
+///    - An optional `DataModel::MetadataSnapshot` may be shared by iterators over the same provider, so that
+///      endpoint, cluster and attribute lists are not fetched (and allocated) again by every iterator.
+///
 class AttributePathExpandIterator
 {
 public:
@@ -101,7 +105,8 @@ public:
         ConcreteAttributePath mOutputPath;
     };
 
-    AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position);
+    AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position,
+                                DataModel::MetadataSnapshot * snapshot = nullptr);
 
     // This class may not be copied. A new one should be created when needed and they
     // should not overlap.
@@ -137,15 +142,29 @@ private:
     DataModel::Provider * mDataModelProvider;
     Position & mPosition;
 
-    ReadOnlyBuffer<DataModel::EndpointEntry> mEndpoints; // all endpoints
+    DataModel::MetadataSnapshot * mSnapshot;
+    uint32_t mSnapshotEpoch = 0;
+
+    // The lists below are views of either the snapshot or of the corresponding buffer, when they are
+    // fetched from the provider directly.
+
+    Span<const DataModel::EndpointEntry> mEndpoints; // all endpoints
+    ReadOnlyBuffer<DataModel::EndpointEntry> mEndpointsBuffer;
     size_t mEndpointIndex = kInvalidIndex;
 
-    ReadOnlyBuffer<DataModel::ServerClusterEntry> mClusters; // all clusters ON THE CURRENT endpoint
+    Span<const DataModel::ServerClusterEntry> mClusters; // all clusters ON THE CURRENT endpoint
+    ReadOnlyBuffer<DataModel::ServerClusterEntry> mClustersBuffer;
     size_t mClusterIndex = kInvalidIndex;
 
-    ReadOnlyBuffer<DataModel::AttributeEntry> mAttributes; // all attributes ON THE CURRENT cluster
+    Span<const DataModel::AttributeEntry> mAttributes; // all attributes ON THE CURRENT cluster
+    ReadOnlyBuffer<DataModel::AttributeEntry> mAttributesBuffer;
     size_t mAttributeIndex = kInvalidIndex;
 
+    /// Fetch the endpoint, cluster and attribute lists, from the snapshot if possible.
+    void FetchEndpoints();
+    void FetchClusters(EndpointId endpointId);
+    void FetchAttributes(const ConcreteClusterPath & path);
+
     /// Move to the next endpoint/cluster/attribute triplet that is valid given
     /// the current mOutputPath and mpAttributePath.
     ///
@@ -202,8 +221,9 @@ private:
 class RollbackAttributePathExpandIterator
 {
 public:
-    RollbackAttributePathExpandIterator(DataModel::Provider * dataModel, AttributePathExpandIterator::Position & position) :
-        mAttributePathExpandIterator(dataModel, position), mPositionTarget(position), mCompletedPosition(position)
+    RollbackAttributePathExpandIterator(DataModel::Provider * dataModel, AttributePathExpandIterator::Position & position,
+                                        DataModel::MetadataSnapshot * snapshot = nullptr) :
+        mAttributePathExpandIterator(dataModel, position, snapshot), mPositionTarget(position), mCompletedPosition(position)
     {}
     ~RollbackAttributePathExpandIterator() { mPositionTarget = mCompletedPosition; }
 
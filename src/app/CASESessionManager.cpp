@@ -17,20 +17,45 @@
  */
 
 #include <app/CASESessionManager.h>
+#include <crypto/RandUtils.h>
 #include <lib/address_resolve/AddressResolve.h>
+#include <lib/support/TypeTraits.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+
+using namespace chip::Tracing;
 
 namespace chip {
 
+CASESessionManager::AdmittedSessionSetup::AdmittedSessionSetup(CASESessionManager & manager, const PendingSessionSetup & pending) :
+    mManager(manager), mPeerId(pending.mPeerId), mRequestTime(pending.mRequestTime),
+    mOnConnected(HandleAdmittedSessionConnected, this), mOnSetupFailure(HandleAdmittedSessionSetupFailure, this)
+{}
+
+CASESessionManager::PendingSessionSetup::~PendingSessionSetup()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    while (auto * cb = mRetryCallbacks.First())
+    {
+        cb->Cancel();
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+}
+
 CHIP_ERROR CASESessionManager::Init(chip::System::Layer * systemLayer, const CASESessionManagerConfig & params)
 {
     ReturnErrorOnFailure(params.sessionInitParams.Validate());
-    mConfig = params;
+    mConfig      = params;
+    mSystemLayer = systemLayer;
     params.sessionInitParams.exchangeMgr->GetReliableMessageMgr()->RegisterSessionUpdateDelegate(this);
     return AddressResolve::Resolver::Instance().Init(systemLayer);
 }
 
 void CASESessionManager::Shutdown()
 {
+    CancelPendingSessionSetups([](const PendingSessionSetup &) { return true; });
+    ClearSessionSetupAdmission();
     AddressResolve::Resolver::Instance().Shutdown();
 }
 
@@ -40,13 +65,14 @@ void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Cal
                                                 uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                                 TransportPayloadCapability transportPayloadCapability,
-                                                const Optional<AddressResolve::ResolveResult> & fallbackResolveResult)
+                                                const Optional<AddressResolve::ResolveResult> & fallbackResolveResult,
+                                                SessionSetupPriority priority)
 {
     FindOrEstablishSessionHelper(peerId, onConnection, onFailure, nullptr,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                  attemptCount, onRetry,
 #endif
-                                 transportPayloadCapability, fallbackResolveResult);
+                                 transportPayloadCapability, fallbackResolveResult, priority);
 }
 
 void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
@@ -54,13 +80,14 @@ void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Cal
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                                 uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif
-                                                TransportPayloadCapability transportPayloadCapability)
+                                                TransportPayloadCapability transportPayloadCapability,
+                                                SessionSetupPriority priority)
 {
     FindOrEstablishSessionHelper(peerId, onConnection, nullptr, onSetupFailure,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                  attemptCount, onRetry,
 #endif
-                                 transportPayloadCapability);
+                                 transportPayloadCapability, NullOptional, priority);
 }
 
 void CASESessionManager::FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
@@ -96,13 +123,27 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
                                                       uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif
                                                       TransportPayloadCapability transportPayloadCapability,
-                                                      const Optional<AddressResolve::ResolveResult> & fallbackResolveResult)
+                                                      const Optional<AddressResolve::ResolveResult> & fallbackResolveResult,
+                                                      SessionSetupPriority priority)
 {
     ChipLogDetail(CASESessionManager, "FindOrEstablishSession: PeerId = [%d:" ChipLogFormatX64 "]", peerId.GetFabricIndex(),
                   ChipLogValueX64(peerId.GetNodeId()));
 
     bool forAddressUpdate             = false;
     OperationalSessionSetup * session = FindExistingSessionSetup(peerId, forAddressUpdate);
+    if (session == nullptr && mConfig.maxConcurrentSessionSetups > 0 &&
+        !FindExistingSession(peerId, transportPayloadCapability).HasValue())
+    {
+        // A new session setup is needed: it goes through the admission queue, including for the requests without a
+        // failure callback, which are only told of a success.
+        EnqueueSessionSetup(peerId, onConnection, onFailure, onSetupFailure,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                            attemptCount, onRetry,
+#endif
+                            transportPayloadCapability, fallbackResolveResult, priority);
+        return;
+    }
+
     if (session == nullptr)
     {
         ChipLogDetail(CASESessionManager, "FindOrEstablishSession: No existing OperationalSessionSetup instance found");
@@ -152,13 +193,382 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
     }
 }
 
+void CASESessionManager::EnqueueSessionSetup(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
+                                             Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                                             Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                             uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
+#endif
+                                             TransportPayloadCapability transportPayloadCapability,
+                                             const Optional<AddressResolve::ResolveResult> & fallbackResolveResult,
+                                             SessionSetupPriority priority)
+{
+    // Nobody would be told of the outcome of a request without callbacks.
+    VerifyOrReturn(onConnection != nullptr || onFailure != nullptr || onSetupFailure != nullptr);
+
+    PendingSessionSetup * pending = FindPendingSessionSetup(peerId);
+    if (pending == nullptr)
+    {
+        if (mConfig.maxPendingSessionSetups == 0 || mAdmissionStats.queueDepth < mConfig.maxPendingSessionSetups)
+        {
+            pending = Platform::New<PendingSessionSetup>(peerId, System::SystemClock().GetMonotonicTimestamp());
+        }
+        if (pending == nullptr)
+        {
+            SessionSetupCallbackList callbacks;
+            callbacks.Enqueue(onConnection, onFailure, onSetupFailure);
+            NotifySessionSetupFailure(callbacks, peerId, CHIP_ERROR_NO_MEMORY);
+            return;
+        }
+        pending->mPriority = priority;
+        mPendingSetups[to_underlying(priority)].PushBack(pending);
+        mAdmissionStats.queueDepth++;
+        mAdmissionStats.peakQueueDepth = std::max(mAdmissionStats.peakQueueDepth, mAdmissionStats.queueDepth);
+        MATTER_LOG_METRIC(kMetricDeviceCASESessionAdmissionQueueDepth, static_cast<uint32_t>(mAdmissionStats.queueDepth));
+    }
+    else if (priority < pending->mPriority)
+    {
+        // The request joins the one already waiting for this peer, which moves up to its priority.
+        mPendingSetups[to_underlying(pending->mPriority)].Remove(pending);
+        pending->mPriority = priority;
+        mPendingSetups[to_underlying(priority)].PushBack(pending);
+    }
+
+    pending->mCallbacks.Enqueue(onConnection, onFailure, onSetupFailure);
+    // Like OperationalSessionSetup, the last request decides the transport.
+    pending->mTransportPayloadCapability = transportPayloadCapability;
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    pending->mAttemptCount = std::max(pending->mAttemptCount, attemptCount);
+    if (onRetry != nullptr)
+    {
+        pending->mRetryCallbacks.Enqueue(onRetry->Cancel());
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+#if CHIP_CONFIG_ENABLE_ADDRESS_RESOLVE_FALLBACK
+    if (fallbackResolveResult.HasValue())
+    {
+        pending->mFallbackResolveResult = fallbackResolveResult;
+    }
+#endif // CHIP_CONFIG_ENABLE_ADDRESS_RESOLVE_FALLBACK
+
+    AdmitSessionSetups();
+}
+
+void CASESessionManager::AdmitSessionSetups()
+{
+    while (PendingSessionSetup * pending = NextPendingSessionSetup())
+    {
+        if (pending->mCallbacks.IsEmpty())
+        {
+            // Every request for this peer was canceled while it was waiting.
+            RemovePendingSessionSetup(*pending);
+            continue;
+        }
+
+        VerifyOrReturn(mAdmissionStats.inFlight < mConfig.maxConcurrentSessionSetups);
+
+        System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        if (now < mNextAdmissionTime)
+        {
+            ScheduleSessionSetupAdmission();
+            return;
+        }
+
+        ScopedNodeId peerId = pending->mPeerId;
+        CHIP_ERROR err      = StartSessionSetup(*pending);
+        if (err == CHIP_ERROR_NO_MEMORY && mAdmissionStats.inFlight > 0)
+        {
+            // The session setup pool is full.  Wait for one of the admitted setups to complete.
+            return;
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(CASESessionManager, "Unable to start session setup for " ChipLogFormatScopedNodeId ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueScopedNodeId(peerId), err.Format());
+            SessionSetupCallbackList callbacks;
+            callbacks.EnqueueTakeAll(pending->mCallbacks);
+            RemovePendingSessionSetup(*pending);
+            NotifySessionSetupFailure(callbacks, peerId, err);
+            continue;
+        }
+
+        System::Clock::Milliseconds32 delay = mConfig.sessionSetupAdmissionInterval;
+        if (mConfig.sessionSetupAdmissionJitter.count() > 0)
+        {
+            delay += System::Clock::Milliseconds32(Crypto::GetRandU32() % (mConfig.sessionSetupAdmissionJitter.count() + 1));
+        }
+        mNextAdmissionTime = now + delay;
+    }
+}
+
+CHIP_ERROR CASESessionManager::StartSessionSetup(PendingSessionSetup & pending)
+{
+    AdmittedSessionSetup * admitted = Platform::New<AdmittedSessionSetup>(*this, pending);
+    VerifyOrReturnError(admitted != nullptr, CHIP_ERROR_NO_MEMORY);
+    OperationalSessionSetup * session =
+        mConfig.sessionSetupPool->Allocate(mConfig.sessionInitParams, mConfig.clientPool, pending.mPeerId, this);
+    if (session == nullptr)
+    {
+        Platform::Delete(admitted);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    ChipLogDetail(CASESessionManager, "Admitting session setup for " ChipLogFormatScopedNodeId " after %" PRIu32 " ms",
+                  ChipLogValueScopedNodeId(pending.mPeerId),
+                  static_cast<uint32_t>(std::chrono::duration_cast<System::Clock::Milliseconds32>(
+                                            System::SystemClock().GetMonotonicTimestamp() - pending.mRequestTime)
+                                            .count()));
+
+    admitted->mCallbacks.EnqueueTakeAll(pending.mCallbacks);
+    mAdmittedSetups.PushBack(admitted);
+
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    session->UpdateAttemptCount(pending.mAttemptCount);
+    while (auto * cb = pending.mRetryCallbacks.First())
+    {
+        session->AddRetryHandler(Callback::Callback<OnDeviceConnectionRetry>::FromCancelable(cb));
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+
+#if CHIP_CONFIG_ENABLE_ADDRESS_RESOLVE_FALLBACK
+    if (pending.mFallbackResolveResult.HasValue())
+    {
+        session->SetFallbackResolveResult(pending.mFallbackResolveResult.Value());
+    }
+#endif // CHIP_CONFIG_ENABLE_ADDRESS_RESOLVE_FALLBACK
+
+    TransportPayloadCapability transportPayloadCapability = pending.mTransportPayloadCapability;
+    RemovePendingSessionSetup(pending);
+    mAdmissionStats.inFlight++;
+
+    // This may complete synchronously, and notify the requests, which may make new ones.
+    session->Connect(&admitted->mOnConnected, &admitted->mOnSetupFailure, transportPayloadCapability);
+    return CHIP_NO_ERROR;
+}
+
+void CASESessionManager::ScheduleSessionSetupAdmission()
+{
+    VerifyOrReturn(mSystemLayer != nullptr && NextPendingSessionSetup() != nullptr);
+
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    System::Clock::Timeout delay = (now < mNextAdmissionTime) ? mNextAdmissionTime - now : System::Clock::kZero;
+    CHIP_ERROR err               = mSystemLayer->StartTimer(delay, HandleAdmissionTimer, this);
+    mAdmissionTimerArmed         = (err == CHIP_NO_ERROR);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(CASESessionManager, "Unable to schedule session setup admission: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void CASESessionManager::CompleteSessionSetup(AdmittedSessionSetup & admitted)
+{
+    System::Clock::Milliseconds32 timeToSession = std::chrono::duration_cast<System::Clock::Milliseconds32>(
+        System::SystemClock().GetMonotonicTimestamp() - admitted.mRequestTime);
+
+    mAdmittedSetups.Remove(&admitted);
+    Platform::Delete(&admitted);
+    mAdmissionStats.inFlight--;
+    mAdmissionStats.completedSetups++;
+    mAdmissionStats.lastTimeToSession = timeToSession;
+    mAdmissionStats.maxTimeToSession  = std::max(mAdmissionStats.maxTimeToSession, timeToSession);
+    MATTER_LOG_METRIC(kMetricDeviceCASESessionTimeToSession, static_cast<uint32_t>(timeToSession.count()));
+
+    // The next setup is started from the event loop, as the completed one is still notifying its callbacks.
+    ScheduleSessionSetupAdmission();
+}
+
+CASESessionManager::PendingSessionSetup * CASESessionManager::FindPendingSessionSetup(const ScopedNodeId & peerId)
+{
+    for (auto & list : mPendingSetups)
+    {
+        for (auto & pending : list)
+        {
+            if (pending.mPeerId == peerId)
+            {
+                return &pending;
+            }
+        }
+    }
+    return nullptr;
+}
+
+CASESessionManager::PendingSessionSetup * CASESessionManager::NextPendingSessionSetup()
+{
+    for (auto & list : mPendingSetups)
+    {
+        if (!list.Empty())
+        {
+            return &*list.begin();
+        }
+    }
+    return nullptr;
+}
+
+void CASESessionManager::RemovePendingSessionSetup(PendingSessionSetup & pending)
+{
+    mPendingSetups[to_underlying(pending.mPriority)].Remove(&pending);
+    Platform::Delete(&pending);
+    mAdmissionStats.queueDepth--;
+    MATTER_LOG_METRIC(kMetricDeviceCASESessionAdmissionQueueDepth, static_cast<uint32_t>(mAdmissionStats.queueDepth));
+}
+
+template <typename Predicate>
+void CASESessionManager::CancelPendingSessionSetups(Predicate && predicate)
+{
+    // Take the canceled peers out of the queue first, as their callbacks may make new requests.
+    IntrusiveList<PendingSessionSetup> canceled;
+    for (auto & list : mPendingSetups)
+    {
+        for (auto it = list.begin(); it != list.end();)
+        {
+            PendingSessionSetup & pending = *it++;
+            if (predicate(pending))
+            {
+                list.Remove(&pending);
+                canceled.PushBack(&pending);
+            }
+        }
+    }
+
+    while (!canceled.Empty())
+    {
+        PendingSessionSetup & pending = *canceled.begin();
+        canceled.Remove(&pending);
+
+        SessionSetupCallbackList callbacks;
+        callbacks.EnqueueTakeAll(pending.mCallbacks);
+        ScopedNodeId peerId = pending.mPeerId;
+        Platform::Delete(&pending);
+        mAdmissionStats.queueDepth--;
+        MATTER_LOG_METRIC(kMetricDeviceCASESessionAdmissionQueueDepth, static_cast<uint32_t>(mAdmissionStats.queueDepth));
+
+        NotifySessionSetupFailure(callbacks, peerId, CHIP_ERROR_CANCELLED);
+    }
+}
+
+void CASESessionManager::ClearSessionSetupAdmission()
+{
+    if (mAdmissionTimerArmed && mSystemLayer != nullptr && mSystemLayer->IsInitialized())
+    {
+        mSystemLayer->CancelTimer(HandleAdmissionTimer, this);
+    }
+    mAdmissionTimerArmed = false;
+
+    for (auto & list : mPendingSetups)
+    {
+        while (!list.Empty())
+        {
+            RemovePendingSessionSetup(*list.begin());
+        }
+    }
+}
+
+void CASESessionManager::ReleaseAdmittedSessionSetups()
+{
+    while (!mAdmittedSetups.Empty())
+    {
+        AdmittedSessionSetup & admitted = *mAdmittedSetups.begin();
+        mAdmittedSetups.Remove(&admitted);
+        Platform::Delete(&admitted);
+        mAdmissionStats.inFlight--;
+    }
+}
+
+void CASESessionManager::NotifySessionSetupFailure(SessionSetupCallbackList & callbacks, const ScopedNodeId & peerId,
+                                                   CHIP_ERROR error)
+{
+    Callback::Callback<OnDeviceConnected> * onConnected;
+    Callback::Callback<OnDeviceConnectionFailure> * onFailure;
+    Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure;
+    while (callbacks.Take(onConnected, onFailure, onSetupFailure))
+    {
+        if (onFailure != nullptr)
+        {
+            onFailure->mCall(onFailure->mContext, peerId, error);
+        }
+        if (onSetupFailure != nullptr)
+        {
+            OperationalSessionSetup::ConnectionFailureInfo failureInfo(peerId, error, SessionEstablishmentStage::kUnknown);
+            onSetupFailure->mCall(onSetupFailure->mContext, failureInfo);
+        }
+    }
+}
+
+void CASESessionManager::HandleAdmittedSessionConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                        const SessionHandle & sessionHandle)
+{
+    auto * admitted = static_cast<AdmittedSessionSetup *>(context);
+
+    SessionSetupCallbackList ready;
+    ready.EnqueueTakeAll(admitted->mCallbacks);
+    ScopedNodeId peerId = admitted->mPeerId;
+    admitted->mManager.CompleteSessionSetup(*admitted);
+
+    // Same as OperationalSessionSetup::NotifyConnectionCallbacks, for the requests that waited in the queue.
+    Callback::Callback<OnDeviceConnected> * onConnected;
+    Callback::Callback<OnDeviceConnectionFailure> * onFailure;
+    Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure;
+    while (ready.Take(onConnected, onFailure, onSetupFailure))
+    {
+        if (!sessionHandle->AsSecureSession()->IsActiveSession())
+        {
+            // A previous success callback tore down the session.
+            SessionSetupCallbackList aborted;
+            aborted.Enqueue(onConnected, onFailure, onSetupFailure);
+            aborted.EnqueueTakeAll(ready);
+            NotifySessionSetupFailure(aborted, peerId, CHIP_ERROR_CONNECTION_ABORTED);
+            return;
+        }
+        if (onConnected != nullptr)
+        {
+            onConnected->mCall(onConnected->mContext, exchangeMgr, sessionHandle);
+        }
+    }
+}
+
+void CASESessionManager::HandleAdmittedSessionSetupFailure(void * context,
+                                                           const OperationalSessionSetup::ConnectionFailureInfo & failureInfo)
+{
+    auto * admitted = static_cast<AdmittedSessionSetup *>(context);
+
+    SessionSetupCallbackList ready;
+    ready.EnqueueTakeAll(admitted->mCallbacks);
+    admitted->mManager.CompleteSessionSetup(*admitted);
+
+    Callback::Callback<OnDeviceConnected> * onConnected;
+    Callback::Callback<OnDeviceConnectionFailure> * onFailure;
+    Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure;
+    while (ready.Take(onConnected, onFailure, onSetupFailure))
+    {
+        if (onFailure != nullptr)
+        {
+            onFailure->mCall(onFailure->mContext, failureInfo.peerId, failureInfo.error);
+        }
+        if (onSetupFailure != nullptr)
+        {
+            onSetupFailure->mCall(onSetupFailure->mContext, failureInfo);
+        }
+    }
+}
+
+void CASESessionManager::HandleAdmissionTimer(System::Layer * systemLayer, void * appState)
+{
+    auto * self                = static_cast<CASESessionManager *>(appState);
+    self->mAdmissionTimerArmed = false;
+    self->AdmitSessionSetups();
+}
+
 void CASESessionManager::ReleaseSessionsForFabric(FabricIndex fabricIndex)
 {
+    CancelPendingSessionSetups([fabricIndex](const PendingSessionSetup & pending) {
+        return pending.mPeerId.GetFabricIndex() == fabricIndex;
+    });
     mConfig.sessionSetupPool->ReleaseAllSessionSetupsForFabric(fabricIndex);
 }
 
 void CASESessionManager::ReleaseAllSessions()
 {
+    CancelPendingSessionSetups([](const PendingSessionSetup &) { return true; });
     mConfig.sessionSetupPool->ReleaseAllSessionSetup();
 }
 
@@ -211,6 +621,7 @@ Optional<SessionHandle> CASESessionManager::FindExistingSession(const ScopedNode
 
 void CASESessionManager::ReleaseSession(const ScopedNodeId & peerId)
 {
+    CancelPendingSessionSetups([&peerId](const PendingSessionSetup & pending) { return pending.mPeerId == peerId; });
     auto * session = mConfig.sessionSetupPool->FindSessionSetup(peerId, false);
     ReleaseSession(session);
 }
@@ -24,6 +24,7 @@
 #include <lib/address_resolve/AddressResolve.h>
 #include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPCore.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/Pool.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <transport/SessionDelegate.h>
@@ -32,11 +33,48 @@
 
 namespace chip {
 
+/**
+ * Priority of a request for a new session in the admission queue of CASESessionManager.  Waiting requests are admitted
+ * by priority, then in the order in which they were made.
+ */
+enum class SessionSetupPriority : uint8_t
+{
+    kHigh,       ///< e.g. a session needed for a command the user is waiting for
+    kNormal,     ///< default
+    kBackground, ///< e.g. re-establishing subscriptions after a restart
+};
+
 struct CASESessionManagerConfig
 {
     CASEClientInitParams sessionInitParams;
     CASEClientPoolDelegate * clientPool                    = nullptr;
     OperationalSessionSetupPoolDelegate * sessionSetupPool = nullptr;
+
+    // Pacing of new session setups, see CHIP_CONFIG_CASE_SESSION_ADMISSION_MAX_CONCURRENT,
+    // CHIP_CONFIG_CASE_SESSION_ADMISSION_QUEUE_SIZE and CHIP_CONFIG_CASE_SESSION_ADMISSION_INTERVAL_MS.  If
+    // maxConcurrentSessionSetups is 0, new session setups start right away and are not paced.  If maxPendingSessionSetups
+    // is 0, the number of peers waiting in the queue is not limited.
+    uint16_t maxConcurrentSessionSetups = CHIP_CONFIG_CASE_SESSION_ADMISSION_MAX_CONCURRENT;
+    uint16_t maxPendingSessionSetups    = CHIP_CONFIG_CASE_SESSION_ADMISSION_QUEUE_SIZE;
+    System::Clock::Milliseconds32 sessionSetupAdmissionInterval{ CHIP_CONFIG_CASE_SESSION_ADMISSION_INTERVAL_MS };
+    System::Clock::Milliseconds32 sessionSetupAdmissionJitter{ CHIP_CONFIG_CASE_SESSION_ADMISSION_JITTER_MS };
+};
+
+/**
+ * Counters of the admission queue of CASESessionManager.
+ */
+struct SessionSetupAdmissionStats
+{
+    // Number of peers waiting in the admission queue, and the largest number since Init.
+    size_t queueDepth     = 0;
+    size_t peakQueueDepth = 0;
+    // Number of admitted session setups that have not completed yet.
+    size_t inFlight = 0;
+    // Number of admitted session setups that completed, successfully or not, and the time from the first request for each
+    // of them to its completion.
+    uint32_t completedSetups                        = 0;
+    System::Clock::Milliseconds32 lastTimeToSession = System::Clock::kZero;
+    System::Clock::Milliseconds32 maxTimeToSession  = System::Clock::kZero;
 };
 
 /**
@@ -46,6 +84,11 @@ struct CASESessionManagerConfig
  * 3. API to lookup an existing proxy object, or allocate a new one by triggering session establishment with the peer node.
  * 4. During session establishment, trigger node ID resolution (if needed), and update the DNS-SD cache (if resolution is
  * successful)
+ * 5. Admission of new session setups, if maxConcurrentSessionSetups is not 0: at most that many of them run at once, and
+ * they are started at least sessionSetupAdmissionInterval apart.  Further requests wait in a queue, ordered by
+ * SessionSetupPriority, where the requests for the same peer share one entry, up to maxPendingSessionSetups peers.  Requests
+ * for a peer with a session, or with a session setup in progress, are not queued.  The entries of the queue and of the
+ * admitted setups are allocated as needed.
  */
 class CASESessionManager : public OperationalSessionReleaseDelegate, public SessionUpdateDelegate
 {
@@ -57,6 +100,8 @@ public:
         {
             mConfig.sessionInitParams.exchangeMgr->GetReliableMessageMgr()->RegisterSessionUpdateDelegate(nullptr);
         }
+        ClearSessionSetupAdmission();
+        ReleaseAdmittedSessionSetups();
     }
 
     CHIP_ERROR Init(chip::System::Layer * systemLayer, const CASESessionManagerConfig & params);
@@ -78,6 +123,8 @@ public:
      *
      * attemptCount can be set to a value greater than 1 to automatically make at least
      * attemptCount session establishment attempts until session setup is successful.
+     *
+     * priority orders the request in the admission queue, if it has to wait there.
      */
     void FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
                                 Callback::Callback<OnDeviceConnectionFailure> * onFailure,
@@ -85,7 +132,8 @@ public:
                                 uint8_t attemptCount = 1, Callback::Callback<OnDeviceConnectionRetry> * onRetry = nullptr,
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                 TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload,
-                                const Optional<AddressResolve::ResolveResult> & fallbackResolveResult = NullOptional);
+                                const Optional<AddressResolve::ResolveResult> & fallbackResolveResult = NullOptional,
+                                SessionSetupPriority priority = SessionSetupPriority::kNormal);
 
     /**
      * Find an existing session for the given node ID or trigger a new session request.
@@ -110,13 +158,15 @@ public:
      *                     a session setup failure will lead to a retry, with at least attemptCount total attempts.
      * @param onRetry A callback to be called on a retry attempt (enabled by a config flag).
      * @param transportPayloadCapability An indicator of what payload types the session needs to be able to transport.
+     * @param priority The priority of the request in the admission queue, if it has to wait there.
      */
     void FindOrEstablishSession(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
                                 Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure,
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                 uint8_t attemptCount = 1, Callback::Callback<OnDeviceConnectionRetry> * onRetry = nullptr,
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
-                                TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload);
+                                TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload,
+                                SessionSetupPriority priority                         = SessionSetupPriority::kNormal);
 
     /**
      * Find an existing session for the given node ID or trigger a new session request.
@@ -174,6 +224,11 @@ public:
 
     void ReleaseAllSessions();
 
+    /**
+     * Counters of the admission queue, see SessionSetupAdmissionStats.
+     */
+    const SessionSetupAdmissionStats & GetSessionSetupAdmissionStats() const { return mAdmissionStats; }
+
     /**
      * This API returns the address for the given node ID.
      * If the CASESessionManager is configured with a DNS-SD cache, the cache is looked up
@@ -205,9 +260,86 @@ private:
                                       uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
 #endif
                                       TransportPayloadCapability transportPayloadCapability,
-                                      const Optional<AddressResolve::ResolveResult> & fallbackResolveResult = NullOptional);
+                                      const Optional<AddressResolve::ResolveResult> & fallbackResolveResult = NullOptional,
+                                      SessionSetupPriority priority = SessionSetupPriority::kNormal);
+
+    using SessionSetupCallbackList =
+        Callback::GroupedCallbackList<OnDeviceConnected, OnDeviceConnectionFailure, OperationalSessionSetup::OnSetupFailure>;
+
+    static constexpr size_t kSessionSetupPriorityCount = static_cast<size_t>(SessionSetupPriority::kBackground) + 1;
+
+    // A peer waiting in the admission queue, with the requests made for it meanwhile.
+    struct PendingSessionSetup : public IntrusiveListNodeBase<>
+    {
+        PendingSessionSetup(const ScopedNodeId & peerId, System::Clock::Timestamp requestTime) :
+            mPeerId(peerId), mRequestTime(requestTime)
+        {}
+        ~PendingSessionSetup();
+
+        const ScopedNodeId mPeerId;
+        const System::Clock::Timestamp mRequestTime;
+        SessionSetupPriority mPriority                         = SessionSetupPriority::kNormal;
+        TransportPayloadCapability mTransportPayloadCapability = TransportPayloadCapability::kMRPPayload;
+        SessionSetupCallbackList mCallbacks;
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+        uint8_t mAttemptCount = 1;
+        Callback::CallbackDeque mRetryCallbacks;
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+#if CHIP_CONFIG_ENABLE_ADDRESS_RESOLVE_FALLBACK
+        Optional<AddressResolve::ResolveResult> mFallbackResolveResult;
+#endif // CHIP_CONFIG_ENABLE_ADDRESS_RESOLVE_FALLBACK
+    };
+
+    // A session setup started by the admission queue.  Its callbacks are the only ones it registers with the
+    // OperationalSessionSetup, so that it knows when the setup completes; they forward the outcome to the requests.
+    struct AdmittedSessionSetup : public IntrusiveListNodeBase<>
+    {
+        AdmittedSessionSetup(CASESessionManager & manager, const PendingSessionSetup & pending);
+
+        CASESessionManager & mManager;
+        const ScopedNodeId mPeerId;
+        const System::Clock::Timestamp mRequestTime;
+        SessionSetupCallbackList mCallbacks;
+        Callback::Callback<OnDeviceConnected> mOnConnected;
+        Callback::Callback<OperationalSessionSetup::OnSetupFailure> mOnSetupFailure;
+    };
+
+    void EnqueueSessionSetup(const ScopedNodeId & peerId, Callback::Callback<OnDeviceConnected> * onConnection,
+                             Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                             Callback::Callback<OperationalSessionSetup::OnSetupFailure> * onSetupFailure,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                             uint8_t attemptCount, Callback::Callback<OnDeviceConnectionRetry> * onRetry,
+#endif
+                             TransportPayloadCapability transportPayloadCapability,
+                             const Optional<AddressResolve::ResolveResult> & fallbackResolveResult, SessionSetupPriority priority);
+    void AdmitSessionSetups();
+    CHIP_ERROR StartSessionSetup(PendingSessionSetup & pending);
+    void ScheduleSessionSetupAdmission();
+    void CompleteSessionSetup(AdmittedSessionSetup & admitted);
+    PendingSessionSetup * FindPendingSessionSetup(const ScopedNodeId & peerId);
+    PendingSessionSetup * NextPendingSessionSetup();
+    void RemovePendingSessionSetup(PendingSessionSetup & pending);
+    template <typename Predicate>
+    void CancelPendingSessionSetups(Predicate && predicate);
+    void ClearSessionSetupAdmission();
+    // Detaches the setups still in progress from this manager; their requests are not notified.
+    void ReleaseAdmittedSessionSetups();
+
+    static void NotifySessionSetupFailure(SessionSetupCallbackList & callbacks, const ScopedNodeId & peerId, CHIP_ERROR error);
+    static void HandleAdmittedSessionConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                               const SessionHandle & sessionHandle);
+    static void HandleAdmittedSessionSetupFailure(void * context,
+                                                  const OperationalSessionSetup::ConnectionFailureInfo & failureInfo);
+    static void HandleAdmissionTimer(System::Layer * systemLayer, void * appState);
 
     CASESessionManagerConfig mConfig;
+
+    System::Layer * mSystemLayer = nullptr;
+    IntrusiveList<PendingSessionSetup> mPendingSetups[kSessionSetupPriorityCount];
+    IntrusiveList<AdmittedSessionSetup> mAdmittedSetups;
+    System::Clock::Timestamp mNextAdmissionTime = System::Clock::kZero;
+    bool mAdmissionTimerArmed                   = false;
+    SessionSetupAdmissionStats mAdmissionStats;
 };
 
 } // namespace chip
@@ -19,7 +19,9 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
-#include <tuple>
+
+#include <algorithm>
+#include <cstring>
 
 namespace chip {
 namespace app {
@@ -47,80 +49,185 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
     return size;
 }
 
+// Find where the state with the given ID is, or would be inserted, in a vector of states sorted by that ID.
+template <typename States, typename Id, typename IdField>
+auto LowerBound(States & states, Id id, IdField idField)
+{
+    return std::lower_bound(states.begin(), states.end(), id,
+                            [idField](const auto & state, Id value) { return state.*idField < value; });
+}
+
 } // anonymous namespace
 
 template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::CopyElement(TLV::TLVReader * apData, ByteSpan & aElement)
 {
-    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
     TLV::TLVReader reader;
     reader.Init(*apData);
     size_t totalBufSize = reader.GetTotalLength();
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
+    if (mElementBuffer.AllocatedSize() < totalBufSize)
+    {
+        mElementBuffer.Calloc(totalBufSize);
+        VerifyOrReturnError(mElementBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    TLV::TLVWriter writer;
+    writer.Init(mElementBuffer.Get(), mElementBuffer.AllocatedSize());
     ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    aSize = writer.GetLengthWritten();
-    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+    ReturnErrorOnFailure(writer.Finalize());
+    aElement = ByteSpan(mElementBuffer.Get(), writer.GetLengthWritten());
     return CHIP_NO_ERROR;
 }
 
 template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                                 const StatusIB & aStatus)
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::ReserveAttributeData(const ClusterState * apClusterState,
+                                                                          const AttributeState * apAttributeState, uint32_t aSize,
+                                                                          DataBlock & aBlock)
 {
-    AttributeState state;
-    bool endpointIsNew = false;
+    // Values that keep their size (most of them, for numbers) are updated in place.
+    if (apAttributeState != nullptr && apAttributeState->mType == AttributeStateType::kData && apAttributeState->mSize == aSize)
+    {
+        return CHIP_NO_ERROR;
+    }
 
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
+    if (apClusterState != nullptr && !apClusterState->mDataBlocks.empty() &&
+        apClusterState->mDataBlocks.back().mCapacity - apClusterState->mDataBlocks.back().mUsed >= aSize)
     {
-        //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
-        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
-        // we can appropriately notify our clients of the addition of a new endpoint.
-        //
-        endpointIsNew = true;
+        return CHIP_NO_ERROR;
     }
 
+    aBlock.mCapacity = std::max(aSize, kDataBlockSize);
+    VerifyOrReturnError(aBlock.mBuffer.Alloc(aBlock.mCapacity), CHIP_ERROR_NO_MEMORY);
+    return CHIP_NO_ERROR;
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::StoreAttributeData(ClusterState & clusterState, AttributeState & attributeState,
+                                                                  ByteSpan aElement, DataBlock && aReservedBlock)
+{
+    const auto size = static_cast<uint32_t>(aElement.size());
+
+    if (attributeState.mType == AttributeStateType::kData && attributeState.mSize == size)
+    {
+        memcpy(attributeState.mData, aElement.data(), size);
+        return;
+    }
+
+    auto & blocks = clusterState.mDataBlocks;
+    if (aReservedBlock.mBuffer.Get() != nullptr)
+    {
+        blocks.push_back(std::move(aReservedBlock));
+    }
+
+    DataBlock & block = blocks.back();
+    uint8_t * data    = block.mBuffer.Get() + block.mUsed;
+    memcpy(data, aElement.data(), size);
+    block.mUsed += size;
+    block.mLive += size;
+
+    // The previous value is released last, so that its block is not freed under the new one.
+    ReleaseAttributeData(clusterState, attributeState);
+    attributeState.mType = AttributeStateType::kData;
+    attributeState.mSize = size;
+    attributeState.mData = data;
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::ReleaseAttributeData(ClusterState & clusterState, AttributeState & attributeState)
+{
+    if (attributeState.mType != AttributeStateType::kData)
+    {
+        return;
+    }
+
+    auto & blocks = clusterState.mDataBlocks;
+    for (auto block = blocks.begin(); block != blocks.end(); ++block)
+    {
+        const uint8_t * start = block->mBuffer.Get();
+        if (attributeState.mData < start || attributeState.mData >= start + block->mUsed)
+        {
+            continue;
+        }
+
+        block->mLive -= attributeState.mSize;
+        if (block->mLive == 0)
+        {
+            // Moving the following blocks down does not free the buffer they are moved over.
+            block->mBuffer.Free();
+            blocks.erase(block);
+        }
+        break;
+    }
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                                                 const StatusIB & aStatus)
+{
+    ByteSpan element;
+    DataBlock dataBlock;
+
     if (apData)
     {
-        uint32_t elementSize = 0;
-        ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
+        ReturnErrorOnFailure(CopyElement(apData, element));
 
-        if constexpr (CanEnableDataCaching)
+        // Room for the data is allocated before the cache changes, so that the cache is left as it was if there is no memory.
+        if (CanEnableDataCaching && mCacheData)
         {
-            if (mCacheData)
-            {
-                Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-                backingBuffer.Calloc(elementSize);
-                VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-                TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-                ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-                ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-                state.template Set<AttributeData>(std::move(backingBuffer));
-            }
-            else
+            const ClusterState * existingClusterState     = FindClusterState(aPath);
+            const AttributeState * existingAttributeState = nullptr;
+            if (existingClusterState != nullptr)
             {
-                state.template Set<uint32_t>(elementSize);
+                CHIP_ERROR err;
+                existingAttributeState = GetAttributeState(*existingClusterState, aPath.mAttributeId, err);
             }
+            ReturnErrorOnFailure(ReserveAttributeData(existingClusterState, existingAttributeState,
+                                                      static_cast<uint32_t>(element.size()), dataBlock));
+        }
+
+        // This commits a pending data version if the last report path is valid and it is different from the current path.
+        if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
+        {
+            CommitPendingDataVersion();
+        }
+    }
+
+    //
+    // if the endpoint didn't exist previously, let's track the insertion
+    // so that we can inform our callback of a new endpoint being added appropriately.
+    //
+    if (FindEndpointState(aPath.mEndpointId) == nullptr)
+    {
+        mAddedEndpoints.push_back(aPath.mEndpointId);
+    }
+
+    ClusterState & clusterState = GetOrCreateClusterState(aPath);
+
+    auto attributeIter = LowerBound(clusterState.mAttributes, aPath.mAttributeId, &AttributeState::mAttributeId);
+    if (attributeIter == clusterState.mAttributes.end() || attributeIter->mAttributeId != aPath.mAttributeId)
+    {
+        attributeIter               = clusterState.mAttributes.emplace(attributeIter);
+        attributeIter->mAttributeId = aPath.mAttributeId;
+    }
+    AttributeState & attributeState = *attributeIter;
+
+    if (apData)
+    {
+        if (CanEnableDataCaching && mCacheData)
+        {
+            StoreAttributeData(clusterState, attributeState, element, std::move(dataBlock));
         }
         else
         {
-            state = elementSize;
+            attributeState.mType = AttributeStateType::kSize;
+            attributeState.mSize = static_cast<uint32_t>(element.size());
         }
 
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
-
-        // This commits a pending data version if the last report path is valid and it is different from the current path.
-        if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
-        {
-            CommitPendingDataVersion();
-        }
+        clusterState.mCommittedDataVersion.ClearValue();
 
         bool foundEncompassingWildcardPath = false;
         for (const auto & path : mRequestPathSet)
@@ -135,44 +242,22 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            clusterState.mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
     }
     else
     {
-        if constexpr (CanEnableDataCaching)
-        {
-            if (mCacheData)
-            {
-                state.template Set<StatusIB>(aStatus);
-            }
-            else
-            {
-                state.template Set<uint32_t>(SizeOfStatusIB(aStatus));
-            }
-        }
-        else
-        {
-            state = SizeOfStatusIB(aStatus);
-        }
+        ReleaseAttributeData(clusterState, attributeState);
+        attributeState.mType   = (CanEnableDataCaching && mCacheData) ? AttributeStateType::kStatus : AttributeStateType::kSize;
+        attributeState.mSize   = SizeOfStatusIB(aStatus);
+        attributeState.mStatus = aStatus;
     }
 
-    //
-    // if the endpoint didn't exist previously, let's track the insertion
-    // so that we can inform our callback of a new endpoint being added appropriately.
-    //
-    if (endpointIsNew)
-    {
-        mAddedEndpoints.push_back(aPath.mEndpointId);
-    }
-
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
-
     if (mCacheData)
     {
-        mChangedAttributeSet.insert(aPath);
+        mChangedAttributes.push_back(aPath);
     }
 
     return CHIP_NO_ERROR;
@@ -212,7 +297,12 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
             eventData.first  = aEventHeader;
             eventData.second = std::move(handle);
 
-            mEventDataCache.insert(std::move(eventData));
+            // Events normally arrive in order, so this is an append.
+            auto position = std::lower_bound(mEventDataCache.begin(), mEventDataCache.end(), eventData, EventDataCompare());
+            if (position == mEventDataCache.end() || position->first.mEventNumber != aEventHeader.mEventNumber)
+            {
+                mEventDataCache.insert(position, std::move(eventData));
+            }
         }
         mHighestReceivedEventNumber.SetValue(aEventHeader.mEventNumber);
     }
@@ -237,7 +327,7 @@ template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
 {
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
-    mChangedAttributeSet.clear();
+    mChangedAttributes.clear();
     mAddedEndpoints.clear();
     mCallback.OnReportBegin();
 }
@@ -250,11 +340,11 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
-    if (lastClusterInfo.mPendingDataVersion.HasValue())
+    auto lastClusterInfo = FindClusterState(mLastReportDataPath);
+    if (lastClusterInfo != nullptr && lastClusterInfo->mPendingDataVersion.HasValue())
     {
-        lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
-        lastClusterInfo.mPendingDataVersion.ClearValue();
+        lastClusterInfo->mCommittedDataVersion = lastClusterInfo->mPendingDataVersion;
+        lastClusterInfo->mPendingDataVersion.ClearValue();
     }
 }
 
@@ -263,21 +353,29 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
 {
     CommitPendingDataVersion();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
-    std::set<std::tuple<EndpointId, ClusterId>> changedClusters;
+    mElementBuffer.Free();
 
     //
-    // Add the EndpointId and ClusterId into a set so that we only
-    // convey unique combinations in the subsequent OnClusterChanged callback.
+    // Sort the changed paths so that each one is only conveyed once, and so that the paths
+    // of a cluster are next to each other for the subsequent OnClusterChanged callback.
     //
-    for (auto & path : mChangedAttributeSet)
+    std::sort(mChangedAttributes.begin(), mChangedAttributes.end());
+    mChangedAttributes.erase(std::unique(mChangedAttributes.begin(), mChangedAttributes.end()), mChangedAttributes.end());
+
+    for (auto & path : mChangedAttributes)
     {
         mCallback.OnAttributeChanged(this, path);
-        changedClusters.insert(std::make_tuple(path.mEndpointId, path.mClusterId));
     }
 
-    for (auto & item : changedClusters)
+    for (size_t i = 0; i < mChangedAttributes.size(); i++)
     {
-        mCallback.OnClusterChanged(this, std::get<0>(item), std::get<1>(item));
+        const ConcreteAttributePath & path = mChangedAttributes[i];
+        if (i > 0 && ConcreteClusterPath(mChangedAttributes[i - 1]) == ConcreteClusterPath(path))
+        {
+            continue;
+        }
+
+        mCallback.OnClusterChanged(this, path.mEndpointId, path.mClusterId);
     }
 
     for (auto endpoint : mAddedEndpoints)
@@ -285,6 +383,9 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
         mCallback.OnEndpointAdded(this, endpoint);
     }
 
+    // Do not hold on to the changed paths of a large report until the next one.
+    std::vector<ConcreteAttributePath>().swap(mChangedAttributes);
+
     mCallback.OnReportEnd();
 }
 
@@ -292,20 +393,22 @@ template <>
 CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
 {
     CHIP_ERROR err;
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+    auto clusterState = GetClusterState(path.mEndpointId, path.mClusterId, err);
+    ReturnErrorOnFailure(err);
+    auto attributeState = GetAttributeState(*clusterState, path.mAttributeId, err);
     ReturnErrorOnFailure(err);
 
-    if (attributeState->template Is<StatusIB>())
+    if (attributeState->mType == AttributeStateType::kStatus)
     {
         return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
     }
 
-    if (!attributeState->template Is<AttributeData>())
+    if (attributeState->mType != AttributeStateType::kData)
     {
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
 
-    reader.Init(attributeState->template Get<AttributeData>().Get(), attributeState->template Get<AttributeData>().AllocatedSize());
+    reader.Init(attributeState->mData, attributeState->mSize);
     return reader.Next();
 }
 
@@ -336,15 +439,15 @@ template <bool CanEnableDataCaching>
 const typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
 ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
 {
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
+    auto endpointIter = LowerBound(mCache, endpointId, &EndpointState::mEndpointId);
+    if (endpointIter == mCache.end() || endpointIter->mEndpointId != endpointId)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
     err = CHIP_NO_ERROR;
-    return &endpointIter->second;
+    return &(*endpointIter);
 }
 
 template <bool CanEnableDataCaching>
@@ -357,37 +460,88 @@ ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId,
         return nullptr;
     }
 
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
+    auto clusterState = FindClusterState(*endpointState, clusterId);
+    if (clusterState == nullptr)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
     err = CHIP_NO_ERROR;
-    return &clusterState->second;
+    return clusterState;
 }
 
 template <bool CanEnableDataCaching>
 const typename ClusterStateCacheT<CanEnableDataCaching>::AttributeState *
-ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
+ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(const ClusterState & clusterState, AttributeId attributeId,
                                                             CHIP_ERROR & err) const
 {
-    auto clusterState = GetClusterState(endpointId, clusterId, err);
-    if (err != CHIP_NO_ERROR)
+    auto attributeIter = LowerBound(clusterState.mAttributes, attributeId, &AttributeState::mAttributeId);
+    if (attributeIter == clusterState.mAttributes.end() || attributeIter->mAttributeId != attributeId)
     {
+        err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
-    auto attributeState = clusterState->mAttributes.find(attributeId);
-    if (attributeState == clusterState->mAttributes.end())
+    err = CHIP_NO_ERROR;
+    return &(*attributeIter);
+}
+
+template <bool CanEnableDataCaching>
+const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
+ClusterStateCacheT<CanEnableDataCaching>::FindClusterState(const EndpointState & endpointState, ClusterId clusterId)
+{
+    auto clusterIter = LowerBound(endpointState.mClusters, clusterId, &ClusterState::mClusterId);
+    if (clusterIter == endpointState.mClusters.end() || clusterIter->mClusterId != clusterId)
     {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
+    return &(*clusterIter);
+}
 
-    err = CHIP_NO_ERROR;
-    return &attributeState->second;
+template <bool CanEnableDataCaching>
+typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
+ClusterStateCacheT<CanEnableDataCaching>::FindEndpointState(EndpointId endpointId)
+{
+    auto endpointIter = LowerBound(mCache, endpointId, &EndpointState::mEndpointId);
+    if (endpointIter == mCache.end() || endpointIter->mEndpointId != endpointId)
+    {
+        return nullptr;
+    }
+    return &(*endpointIter);
+}
+
+template <bool CanEnableDataCaching>
+typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
+ClusterStateCacheT<CanEnableDataCaching>::FindClusterState(const ConcreteClusterPath & path)
+{
+    auto endpointState = FindEndpointState(path.mEndpointId);
+    if (endpointState == nullptr)
+    {
+        return nullptr;
+    }
+    return const_cast<ClusterState *>(FindClusterState(*endpointState, path.mClusterId));
+}
+
+template <bool CanEnableDataCaching>
+typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState &
+ClusterStateCacheT<CanEnableDataCaching>::GetOrCreateClusterState(const ConcreteClusterPath & path)
+{
+    auto endpointIter = LowerBound(mCache, path.mEndpointId, &EndpointState::mEndpointId);
+    if (endpointIter == mCache.end() || endpointIter->mEndpointId != path.mEndpointId)
+    {
+        endpointIter              = mCache.emplace(endpointIter);
+        endpointIter->mEndpointId = path.mEndpointId;
+    }
+
+    auto & clusters  = endpointIter->mClusters;
+    auto clusterIter = LowerBound(clusters, path.mClusterId, &ClusterState::mClusterId);
+    if (clusterIter == clusters.end() || clusterIter->mClusterId != path.mClusterId)
+    {
+        clusterIter             = clusters.emplace(clusterIter);
+        clusterIter->mClusterId = path.mClusterId;
+    }
+    return *clusterIter;
 }
 
 template <bool CanEnableDataCaching>
@@ -397,8 +551,8 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber,
     EventData compareKey;
 
     compareKey.first.mEventNumber = eventNumber;
-    auto eventData                = mEventDataCache.find(std::move(compareKey));
-    if (eventData == mEventDataCache.end())
+    auto eventData = std::lower_bound(mEventDataCache.begin(), mEventDataCache.end(), compareKey, EventDataCompare());
+    if (eventData == mEventDataCache.end() || eventData->first.mEventNumber != eventNumber)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
@@ -473,15 +627,17 @@ CHIP_ERROR ClusterStateCacheT<true>::GetStatus(const ConcreteAttributePath & pat
 {
     CHIP_ERROR err;
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+    auto clusterState = GetClusterState(path.mEndpointId, path.mClusterId, err);
+    ReturnErrorOnFailure(err);
+    auto attributeState = GetAttributeState(*clusterState, path.mAttributeId, err);
     ReturnErrorOnFailure(err);
 
-    if (!attributeState->template Is<StatusIB>())
+    if (attributeState->mType != AttributeStateType::kStatus)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    status = attributeState->template Get<StatusIB>();
+    status = attributeState->mStatus;
     return CHIP_NO_ERROR;
 }
 
@@ -507,49 +663,20 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
+    for (auto const & endpointState : mCache)
     {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
+        for (auto const & clusterState : endpointState.mClusters)
         {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
+            if (!clusterState.mCommittedDataVersion.HasValue())
             {
                 continue;
             }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
+            DataVersion dataVersion = clusterState.mCommittedDataVersion.Value();
             size_t clusterSize      = 0;
-            ClusterId clusterId     = clusterIter.first;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
+            for (auto const & attributeState : clusterState.mAttributes)
             {
-                if constexpr (CanEnableDataCaching)
-                {
-                    if (attributeIter.second.template Is<StatusIB>())
-                    {
-                        clusterSize += SizeOfStatusIB(attributeIter.second.template Get<StatusIB>());
-                    }
-                    else if (attributeIter.second.template Is<uint32_t>())
-                    {
-                        clusterSize += attributeIter.second.template Get<uint32_t>();
-                    }
-                    else
-                    {
-                        VerifyOrDie(attributeIter.second.template Is<AttributeData>());
-                        TLV::TLVReader bufReader;
-                        bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
-                                       attributeIter.second.template Get<AttributeData>().AllocatedSize());
-                        ReturnOnFailure(bufReader.Next());
-                        // Skip to the end of the element.
-                        ReturnOnFailure(bufReader.Skip());
-
-                        // Compute the amount of value data
-                        clusterSize += bufReader.GetLengthRead();
-                    }
-                }
-                else
-                {
-                    clusterSize += attributeIter.second;
-                }
+                clusterSize += attributeState.mSize;
             }
 
             if (clusterSize == 0)
@@ -559,7 +686,7 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
                 continue;
             }
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
+            DataVersionFilter filter(endpointState.mEndpointId, clusterState.mClusterId, dataVersion);
 
             aVector.push_back(std::make_pair(filter, clusterSize));
         }
@@ -649,42 +776,46 @@ exit:
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
 {
-    mCache.erase(endpointId);
+    auto endpointIter = LowerBound(mCache, endpointId, &EndpointState::mEndpointId);
+    if (endpointIter != mCache.end() && endpointIter->mEndpointId == endpointId)
+    {
+        mCache.erase(endpointIter);
+    }
 }
 
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
-    // Can't use GetEndpointState here, since that only handles const things.
-    auto endpointIter = mCache.find(cluster.mEndpointId);
-    if (endpointIter == mCache.end())
+    auto endpointState = FindEndpointState(cluster.mEndpointId);
+    if (endpointState == nullptr)
     {
         return;
     }
 
-    auto & endpointState = endpointIter->second;
-    endpointState.erase(cluster.mClusterId);
+    auto & clusters  = endpointState->mClusters;
+    auto clusterIter = LowerBound(clusters, cluster.mClusterId, &ClusterState::mClusterId);
+    if (clusterIter != clusters.end() && clusterIter->mClusterId == cluster.mClusterId)
+    {
+        clusters.erase(clusterIter);
+    }
 }
 
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
-    // Can't use GetClusterState here, since that only handles const things.
-    auto endpointIter = mCache.find(attribute.mEndpointId);
-    if (endpointIter == mCache.end())
+    auto clusterState = FindClusterState(attribute);
+    if (clusterState == nullptr)
     {
         return;
     }
 
-    auto & endpointState = endpointIter->second;
-    auto clusterIter     = endpointState.find(attribute.mClusterId);
-    if (clusterIter == endpointState.end())
+    auto & attributes  = clusterState->mAttributes;
+    auto attributeIter = LowerBound(attributes, attribute.mAttributeId, &AttributeState::mAttributeId);
+    if (attributeIter != attributes.end() && attributeIter->mAttributeId == attribute.mAttributeId)
     {
-        return;
+        ReleaseAttributeData(*clusterState, *attributeIter);
+        attributes.erase(attributeIter);
     }
-
-    auto & clusterState = clusterIter->second;
-    clusterState.mAttributes.erase(attribute.mAttributeId);
 }
 
 template <bool CanEnableDataCaching>
@@ -28,7 +28,6 @@
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
-#include <lib/support/Variant.h>
 #include <list>
 #include <map>
 #include <queue>
@@ -378,9 +377,9 @@ public:
         auto clusterState = GetClusterState(endpointId, clusterId, err);
         ReturnErrorOnFailure(err);
 
-        for (auto & attributeIter : clusterState->mAttributes)
+        for (const auto & attribute : clusterState->mAttributes)
         {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
+            const ConcreteAttributePath path(endpointId, clusterId, attribute.mAttributeId);
             ReturnErrorOnFailure(func(path));
         }
 
@@ -403,18 +402,18 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
-        for (auto & endpointIter : mCache)
+        for (const auto & endpointState : mCache)
         {
-            for (auto & clusterIter : endpointIter.second)
+            auto clusterState = FindClusterState(endpointState, clusterId);
+            if (clusterState == nullptr)
             {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
+                continue;
+            }
+
+            for (const auto & attribute : clusterState->mAttributes)
+            {
+                const ConcreteAttributePath path(endpointState.mEndpointId, clusterId, attribute.mAttributeId);
+                ReturnErrorOnFailure(func(path));
             }
         }
         return CHIP_NO_ERROR;
@@ -435,13 +434,13 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(IteratorFunc func) const
     {
-        for (const auto & [endpointId, endpointState] : mCache)
+        for (const auto & endpointState : mCache)
         {
-            for (const auto & [clusterId, clusterState] : endpointState)
+            for (const auto & clusterState : endpointState.mClusters)
             {
-                for (const auto & attributeIter : clusterState.mAttributes)
+                for (const auto & attribute : clusterState.mAttributes)
                 {
-                    const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
+                    const ConcreteAttributePath path(endpointState.mEndpointId, clusterState.mClusterId, attribute.mAttributeId);
                     ReturnErrorOnFailure(func(path));
                 }
             }
@@ -465,12 +464,13 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        CHIP_ERROR err;
+        auto endpointState = GetEndpointState(endpointId, err);
+        if (endpointState != nullptr)
         {
-            for (auto & clusterIter : endpointIter->second)
+            for (const auto & clusterState : endpointState->mClusters)
             {
-                ReturnErrorOnFailure(func(clusterIter.first));
+                ReturnErrorOnFailure(func(clusterState.mClusterId));
             }
         }
         return CHIP_NO_ERROR;
@@ -586,12 +586,44 @@ private:
     // * If we got data for the attribute and we are not storing data
     //   oureselves, the size of the data, so we can still prioritize sending
     //   DataVersions correctly.
+    enum class AttributeStateType : uint8_t
+    {
+        kStatus,
+        kData,
+        kSize,
+    };
+
+    // The data of an attribute is stored as an anonymous TLV element at mData, in one of the data blocks of its cluster.
+    //
+    // mSize is the size of the TLV element for data (whether it is stored or not), and the size of the StatusIB for
+    // a status, so that DataVersions can be prioritized without looking at the data. The data for a single attribute
+    // is not going to be gigabytes in size, so using uint32_t for the size is fine.
+    struct AttributeState
+    {
+        AttributeId mAttributeId;
+        uint32_t mSize  = 0;
+        uint8_t * mData = nullptr;
+        StatusIB mStatus;
+        AttributeStateType mType = AttributeStateType::kSize;
+    };
+
+    // A fixed-size chunk of the data of a cluster. Data is appended to the last block of a cluster and never moved, so
+    // that the data of an attribute stays valid until that attribute is updated; a block is freed once none of the
+    // data it holds is live any more.
+    struct DataBlock
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> mBuffer;
+        uint32_t mCapacity = 0;
+        uint32_t mUsed     = 0; // Bytes handed out, from the start of the block.
+        uint32_t mLive     = 0; // Bytes that still hold the data of an attribute.
+    };
+
+    // Default capacity of a data block; larger elements get a block of their own.
+    static constexpr uint32_t kDataBlockSize = 128;
+
+    // The attributes of a cluster are kept sorted by ID in a flat vector, and the data of its attributes is packed
+    // into a few data blocks, so that caching a cluster costs a handful of allocations instead of a few per attribute.
     //
-    // The data for a single attribute is not going to be gigabytes in size, so
-    // using uint32_t for the size is fine; on 64-bit systems this can save
-    // quite a bit of space.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
-    using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
@@ -599,12 +631,28 @@ private:
     // and we must not be in the middle of receiving reports for that cluster.
     struct ClusterState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
+        ClusterState() = default;
+
+        // Cluster states live in a vector, which must move rather than copy them when it grows.
+        ClusterState(ClusterState &&) noexcept             = default;
+        ClusterState & operator=(ClusterState &&) noexcept = default;
+
+        ClusterId mClusterId;
+        std::vector<AttributeState> mAttributes;
+        std::vector<DataBlock> mDataBlocks;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+
+    // Clusters sorted by ID.
+    struct EndpointState
+    {
+        EndpointId mEndpointId;
+        std::vector<ClusterState> mClusters;
+    };
+
+    // Endpoints sorted by ID.
+    using NodeState = std::vector<EndpointState>;
 
     struct Comparator
     {
@@ -617,7 +665,7 @@ private:
     using EventData = std::pair<EventHeader, System::PacketBufferHandle>;
 
     //
-    // This is a custom comparator for use with the std::set<EventData> below. Uniqueness
+    // This is a custom comparator for keeping the mEventDataCache below sorted. Uniqueness
     // is determined solely by the event number associated with each event.
     //
     struct EventDataCompare
@@ -642,8 +690,31 @@ private:
      */
     const EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const;
     const ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const;
-    const AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                             CHIP_ERROR & err) const;
+    const AttributeState * GetAttributeState(const ClusterState & clusterState, AttributeId attributeId, CHIP_ERROR & err) const;
+
+    static const ClusterState * FindClusterState(const EndpointState & endpointState, ClusterId clusterId);
+
+    // Mutable lookups, returning nullptr if the endpoint or cluster is not in the cache.
+    EndpointState * FindEndpointState(EndpointId endpointId);
+    ClusterState * FindClusterState(const ConcreteClusterPath & path);
+
+    // Returns the state of a cluster, adding it (and its endpoint) to the cache if needed. This invalidates references
+    // to other cluster states.
+    ClusterState & GetOrCreateClusterState(const ConcreteClusterPath & path);
+
+    // Allocates into aBlock the data block that a value of aSize bytes needs, if it does not fit in the current data of
+    // the attribute or in the last data block of the cluster, so that storing it cannot fail. apClusterState and
+    // apAttributeState are null if they are not in the cache yet.
+    static CHIP_ERROR ReserveAttributeData(const ClusterState * apClusterState, const AttributeState * apAttributeState,
+                                           uint32_t aSize, DataBlock & aBlock);
+
+    // Sets the data of an attribute to the TLV element in aElement, in the data block reserved for it, if any.
+    static void StoreAttributeData(ClusterState & clusterState, AttributeState & attributeState, ByteSpan aElement,
+                                   DataBlock && aReservedBlock);
+
+    // Releases the data of an attribute, if any, freeing its data block if nothing else lives in it. This does not
+    // change the type of the attribute state.
+    static void ReleaseAttributeData(ClusterState & clusterState, AttributeState & attributeState);
 
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
@@ -716,15 +787,20 @@ private:
     // on the wire if not all filters can be applied.
     void GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const;
 
-    CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
+    // Copies the TLV element apData is positioned on into mElementBuffer, as an anonymous element.
+    CHIP_ERROR CopyElement(TLV::TLVReader * apData, ByteSpan & aElement);
 
     Callback & mCallback;
     NodeState mCache;
-    std::set<ConcreteAttributePath> mChangedAttributeSet;
+    // Attributes changed by the current report; may contain duplicates until it ends.
+    std::vector<ConcreteAttributePath> mChangedAttributes;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
+    // Scratch space for CopyElement, released at the end of every report.
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mElementBuffer;
 
-    std::set<EventData, EventDataCompare> mEventDataCache;
+    // Sorted by event number.
+    std::vector<EventData> mEventDataCache;
     Optional<EventNumber> mHighestReceivedEventNumber;
     std::map<ConcreteEventPath, StatusIB> mEventStatusCache;
     BufferedReadCallback mBufferedReader;
@@ -103,6 +103,17 @@ public:
      */
     virtual void ResponseDropped() = 0;
 
+    /**
+     * @brief Called when a command of a batched InvokeRequestMessage completed while other commands of the
+     * same request are still being processed asynchronously.
+     *
+     * Called by CommandHandler. Responders able to send InvokeResponseMessages before the whole request is
+     * processed may then send the ones queued so far, after pulling the responses not yet in a queued message
+     * with CommandHandlerImpl::FlushInvokeResponses. By default, every InvokeResponseMessage is sent once the
+     * whole request is processed.
+     */
+    virtual void OnPartialInvokeResponsesAvailable() {}
+
     /**
      * @brief Gets the maximum size of a packet buffer to encode a Command
      * Response message. This size depends on the underlying session used
@@ -319,6 +319,7 @@ Status CommandHandlerImpl::ProcessInvokeRequest(System::PacketBufferHandle && pa
     size_t commandCount = 0;
     VerifyOrReturnError(TLV::Utilities::Count(invokeRequestsReader, commandCount, false /* recurse */) == CHIP_NO_ERROR,
                         Status::InvalidAction);
+    mNumCommands = commandCount;
     if (commandCount > 1)
     {
         mReserveSpaceForMoreChunkMessages = true;
@@ -417,6 +418,12 @@ void CommandHandlerImpl::DecrementHoldOff(Handle * apHandle)
 
     if (mPendingWork != 0)
     {
+        // Once the request was dispatched, let the responder send what the commands completed so far responded rather
+        // than hold it back until the slowest command of the batch completes.
+        if (mGoneAsync && mpResponder != nullptr && mReserveSpaceForMoreChunkMessages)
+        {
+            mpResponder->OnPartialInvokeResponsesAvailable();
+        }
         return;
     }
 
@@ -752,6 +759,7 @@ CHIP_ERROR CommandHandlerImpl::FinishCommand(bool aStartDataStruct)
 
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB());
+    mNumResponses++;
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -797,6 +805,7 @@ CHIP_ERROR CommandHandlerImpl::FinishStatus()
 
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus().EndOfCommandStatusIB());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB());
+    mNumResponses++;
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -861,6 +870,19 @@ CHIP_ERROR CommandHandlerImpl::FinalizeInvokeResponseMessageAndPrepareNext()
     return err;
 }
 
+CHIP_ERROR CommandHandlerImpl::FlushInvokeResponses()
+{
+    // MoreChunkedMessages can only be set when space was reserved for it, i.e. in batched requests. The last message must not
+    // be empty: keep the responses if no other command is left to respond.
+    VerifyOrReturnError(ResponsesAccepted() && mReserveSpaceForMoreChunkMessages, CHIP_NO_ERROR);
+    VerifyOrReturnError(mBufferAllocated && mState == State::AddedCommand && mNumResponses < mNumCommands, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(FinalizeInvokeResponseMessage(/* aHasMoreChunks = */ true));
+    // The next response starts a new InvokeResponseMessage.
+    MoveToState(State::DispatchResponses);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR CommandHandlerImpl::FinalizeInvokeResponseMessage(bool aHasMoreChunks)
 {
     System::PacketBufferHandle packet;
@@ -240,6 +240,16 @@ public:
 
     TLV::TLVWriter * GetCommandDataIBTLVWriter();
 
+    /**
+     * Finalizes the InvokeResponseMessage being built, with MoreChunkedMessages set, and queues it with the
+     * responder, so that the responses of the commands completed so far can be sent while other commands of a
+     * batched request are still being processed asynchronously.
+     *
+     * Does nothing if there is no such response, if the request is not batched, or if every command of the
+     * request already has a response (in which case the last InvokeResponseMessage is about to be queued).
+     */
+    CHIP_ERROR FlushInvokeResponses();
+
 #if CHIP_WITH_NLFAULTINJECTION
 
     enum class NlFaultInjectionType : uint8_t
@@ -523,6 +533,10 @@ private:
     // time.
     bool mGoneAsync = false;
 
+    // Number of commands in the request, and of responses added for them so far.
+    size_t mNumCommands  = 0;
+    size_t mNumResponses = 0;
+
     static constexpr size_t kMaxTargetedEndpoints = CHIP_CONFIG_MAX_PATHS_PER_INVOKE;
     uint16_t mNumTargetedEndpoints                = 0;
     EndpointId mTargetedEndpoints[kMaxTargetedEndpoints];
@@ -38,6 +38,14 @@ CHIP_ERROR CommandResponseSender::OnMessageReceived(Messaging::ExchangeContext *
         err = statusError;
         VerifyOrExit(err == CHIP_NO_ERROR, failureStatusToSend.SetValue(Status::InvalidAction));
 
+        if (!mCommandHandlerDone)
+        {
+            // Commands of the request are still being processed: send what they responded so far, if anything.
+            err = SendPartialCommandResponses();
+            VerifyOrExit(err == CHIP_NO_ERROR, failureStatusToSend.SetValue(Status::Failure));
+            return CHIP_NO_ERROR;
+        }
+
         err = SendCommandResponse();
         // If SendCommandResponse() fails, we must close the exchange. We signal the failure to the
         // requester with a StatusResponse ('Failure'). Since we're in the middle of processing an
@@ -115,6 +123,7 @@ void CommandResponseSender::StartSendingCommandResponses()
 
 void CommandResponseSender::OnDone(CommandHandlerImpl & apCommandObj)
 {
+    mCommandHandlerDone = true;
     if (mState == State::ErrorSentDelayCloseUntilOnDone || apCommandObj.IsGroupRequest() || apCommandObj.IsResponseSuppressed())
     {
         // We either have already sent a message to the client indicating that we are not expecting
@@ -122,9 +131,51 @@ void CommandResponseSender::OnDone(CommandHandlerImpl & apCommandObj)
         Close();
         return;
     }
+    if (mState == State::AwaitingStatusResponse)
+    {
+        // Some responses were sent while commands were still being processed: the remaining ones are
+        // sent once the requester acknowledges the message in flight.
+        return;
+    }
     StartSendingCommandResponses();
 }
 
+void CommandResponseSender::OnPartialInvokeResponsesAvailable()
+{
+    // Nothing is sent until the whole request was dispatched, since it may still fail as a whole, and only one
+    // InvokeResponseMessage is in flight at a time.
+    VerifyOrReturn(mState == State::ReadyForInvokeResponses && !mProcessingInvokeRequest && mExchangeCtx);
+
+    CHIP_ERROR err = SendPartialCommandResponses();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to send InvokeResponseMessage: %" CHIP_ERROR_FORMAT, err.Format());
+        SendStatusResponse(Status::Failure);
+        MoveToState(State::ErrorSentDelayCloseUntilOnDone);
+    }
+}
+
+CHIP_ERROR CommandResponseSender::SendPartialCommandResponses()
+{
+    if (mChunks.IsNull())
+    {
+        ReturnErrorOnFailure(mCommandHandler.FlushInvokeResponses());
+    }
+
+    if (mChunks.IsNull())
+    {
+        // Wait for more commands to complete, keeping the exchange open meanwhile.
+        MoveToState(State::ReadyForInvokeResponses);
+        mExchangeCtx->WillSendMessage();
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(SendCommandResponse());
+    MoveToState(State::AwaitingStatusResponse);
+    mExchangeCtx->SetDelegate(this);
+    return CHIP_NO_ERROR;
+}
+
 void CommandResponseSender::DispatchCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
                                             TLV::TLVReader & apPayload)
 {
@@ -151,7 +202,7 @@ CHIP_ERROR CommandResponseSender::SendCommandResponse()
     System::PacketBufferHandle commandResponsePayload = mChunks.PopHead();
 
     Messaging::SendFlags sendFlag = Messaging::SendMessageFlags::kNone;
-    if (HasMoreToSend())
+    if (HasMoreToSend() || !mCommandHandlerDone)
     {
         sendFlag = Messaging::SendMessageFlags::kExpectResponse;
         ReturnErrorOnFailure(mExchangeCtx->UseSuggestedResponseTimeout(app::kExpectedIMProcessingTime));
@@ -196,6 +247,12 @@ void CommandResponseSender::MoveToState(const State aTargetState)
 
 void CommandResponseSender::Close()
 {
+    if (!mCommandHandlerDone)
+    {
+        // mCommandHandler must outlive the commands it is still processing: finish closing once they complete.
+        MoveToState(State::ErrorSentDelayCloseUntilOnDone);
+        return;
+    }
     MoveToState(State::AllInvokeResponsesSent);
     mpCallback->OnDone(*this);
 }
@@ -214,7 +271,11 @@ void CommandResponseSender::OnInvokeCommandRequest(Messaging::ExchangeContext *
     // Grabbing Handle to prevent mCommandHandler from calling OnDone before OnInvokeCommandRequest returns.
     // This allows us to send a StatusResponse error instead of any potentially queued up InvokeResponseMessages.
     CommandHandler::Handle workHandle(&mCommandHandler);
-    Status status = mCommandHandler.OnInvokeCommandRequest(*this, std::move(payload), isTimedInvoke);
+    Status status;
+    {
+        ScopedChange<bool> processingInvokeRequest(mProcessingInvokeRequest, true);
+        status = mCommandHandler.OnInvokeCommandRequest(*this, std::move(payload), isTimedInvoke);
+    }
     if (status != Status::Success)
     {
         VerifyOrDie(mState == State::ReadyForInvokeResponses);
@@ -124,12 +124,16 @@ public:
 
     void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override
     {
-        VerifyOrDie(mState == State::ReadyForInvokeResponses);
+        // Responses of commands completing after the interaction failed have nowhere to go.
+        VerifyOrReturn(mState != State::ErrorSentDelayCloseUntilOnDone);
+        VerifyOrDie(mState == State::ReadyForInvokeResponses || mState == State::AwaitingStatusResponse);
         mChunks.AddToEnd(std::move(aPacket));
     }
 
     void ResponseDropped() override { mReportResponseDropped = true; }
 
+    void OnPartialInvokeResponsesAvailable() override;
+
     size_t GetCommandResponseMaxBufferSize() override;
 
     /*
@@ -161,6 +165,7 @@ public:
 #endif // CHIP_WITH_NLFAULTINJECTION
 
 private:
+    friend class TestCommandInteraction;
     friend class TestSessionRelease;
 
     enum class State : uint8_t
@@ -179,6 +184,13 @@ private:
      */
     void StartSendingCommandResponses();
 
+    /**
+     * @brief Sends the next InvokeResponseMessage while commands of the request are still being processed, after
+     * pulling the responses added so far from mCommandHandler if none is queued. If there is none either, waits
+     * for more commands to complete.
+     */
+    CHIP_ERROR SendPartialCommandResponses();
+
     void SendStatusResponse(Protocols::InteractionModel::Status aStatus)
     {
         VerifyOrReturn(!mCommandHandler.IsResponseSuppressed(),
@@ -201,6 +213,8 @@ private:
     State mState = State::ReadyForInvokeResponses;
 
     bool mReportResponseDropped                    = false;
+    bool mProcessingInvokeRequest                  = false;
+    bool mCommandHandlerDone                       = false;
     reporting::ReportScheduler * mpReportScheduler = nullptr;
 };
 
@@ -0,0 +1,173 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/EventPathParams.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/FibonacciHash.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * An index of the events stored in a circular event buffer, so that fetching events does not need to decode every
+ * event of the buffer.
+ *
+ * Events are grouped in blocks of consecutive events, oldest first. Each block records where its first event starts in
+ * the buffer storage, the number of its last (highest-numbered) event, and which endpoints, clusters and (endpoint,
+ * cluster) pairs its events belong to, as one bit per hash bucket. A fetch can skip the blocks whose events are all
+ * older than the ones it wants or whose paths it is not interested in, and start reading at the first block that may
+ * hold an event it wants.
+ *
+ * Blocks hold up to kEventsPerBlock events. When all the blocks are in use, the two oldest ones are merged, so that the
+ * index always covers the whole buffer at the cost of a coarser summary of its oldest events.
+ *
+ * The owner of the buffer must call Append() for every event written at the tail of the buffer and RemoveOldest() for
+ * every event evicted from its head.
+ *
+ * @tparam kMaxBlocks  Number of blocks of the index.
+ */
+template <size_t kMaxBlocks>
+class EventBufferIndex
+{
+public:
+    static_assert(kMaxBlocks >= 2, "Merging blocks needs at least two of them");
+
+    static constexpr uint32_t kEventsPerBlock = 8;
+
+    struct Block
+    {
+        EventNumber lastEventNumber;
+        // Offset of the first event of the block in the buffer storage.
+        uint32_t offset;
+        uint32_t eventCount;
+        uint32_t endpointBits;
+        uint32_t clusterBits;
+        uint32_t pathBits;
+
+        /**
+         * Whether the block may hold events of @a path. There may be false positives, but no false negatives.
+         */
+        bool MayContain(const EventPathParams & path) const
+        {
+            if (path.HasWildcardEndpointId())
+            {
+                return path.HasWildcardClusterId() || (clusterBits & ClusterBit(path.mClusterId)) != 0;
+            }
+            if (path.HasWildcardClusterId())
+            {
+                return (endpointBits & EndpointBit(path.mEndpointId)) != 0;
+            }
+            return (pathBits & PathBit(path.mEndpointId, path.mClusterId)) != 0;
+        }
+    };
+
+    void Clear()
+    {
+        mFirstBlock = 0;
+        mBlockCount = 0;
+        mEventCount = 0;
+    }
+
+    /**
+     * Record that the event @a eventNumber of @a endpoint and @a cluster was written at @a offset, after all the
+     * events already in the index.
+     */
+    void Append(uint32_t offset, EventNumber eventNumber, EndpointId endpoint, ClusterId cluster)
+    {
+        if (mBlockCount == 0 || GetBlock(mBlockCount - 1).eventCount >= kEventsPerBlock)
+        {
+            if (mBlockCount == kMaxBlocks)
+            {
+                MergeOldestBlocks();
+            }
+            mBlocks[(mFirstBlock + mBlockCount) % kMaxBlocks] = Block{ 0, offset, 0, 0, 0, 0 };
+            mBlockCount++;
+        }
+
+        Block & block         = mBlocks[(mFirstBlock + mBlockCount - 1) % kMaxBlocks];
+        block.lastEventNumber = eventNumber;
+        block.eventCount++;
+        block.endpointBits |= EndpointBit(endpoint);
+        block.clusterBits |= ClusterBit(cluster);
+        block.pathBits |= PathBit(endpoint, cluster);
+        mEventCount++;
+    }
+
+    /**
+     * Record that the oldest event was evicted, and that the next one starts at @a nextOffset.
+     */
+    void RemoveOldest(uint32_t nextOffset)
+    {
+        if (mBlockCount == 0)
+        {
+            return;
+        }
+
+        Block & oldest = mBlocks[mFirstBlock];
+        oldest.offset  = nextOffset;
+        oldest.eventCount--;
+        mEventCount--;
+        if (oldest.eventCount == 0)
+        {
+            mFirstBlock = (mFirstBlock + 1) % kMaxBlocks;
+            mBlockCount--;
+        }
+    }
+
+    size_t GetBlockCount() const { return mBlockCount; }
+
+    /**
+     * Returns the @a index-th oldest block.
+     */
+    const Block & GetBlock(size_t index) const { return mBlocks[(mFirstBlock + index) % kMaxBlocks]; }
+
+    size_t GetEventCount() const { return mEventCount; }
+
+private:
+    static uint32_t Bit(uint32_t key) { return 1u << (FibonacciHash(key) >> 27); }
+
+    static uint32_t EndpointBit(EndpointId endpoint) { return Bit(endpoint); }
+    static uint32_t ClusterBit(ClusterId cluster) { return Bit(cluster); }
+    static uint32_t PathBit(EndpointId endpoint, ClusterId cluster) { return Bit(FibonacciHashCombine(cluster, endpoint)); }
+
+    void MergeOldestBlocks()
+    {
+        const Block & oldest = mBlocks[mFirstBlock];
+        mFirstBlock          = (mFirstBlock + 1) % kMaxBlocks;
+        mBlockCount--;
+
+        Block & next = mBlocks[mFirstBlock];
+        next.offset  = oldest.offset;
+        next.eventCount += oldest.eventCount;
+        next.endpointBits |= oldest.endpointBits;
+        next.clusterBits |= oldest.clusterBits;
+        next.pathBits |= oldest.pathBits;
+    }
+
+    Block mBlocks[kMaxBlocks] = {};
+    size_t mFirstBlock        = 0;
+    size_t mBlockCount        = 0;
+    size_t mEventCount        = 0;
+};
+
+} // namespace app
+} // namespace chip
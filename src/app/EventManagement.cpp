@@ -25,8 +25,10 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <cstdint>
 
 using namespace chip::TLV;
 
@@ -66,6 +68,71 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+
+    // Number and path of the event to move, for the index of the next buffer.
+    EventNumber mMovedEventNumber  = 0;
+    EndpointId mMovedEventEndpoint = kInvalidEndpointId;
+    ClusterId mMovedEventCluster   = kInvalidClusterId;
+};
+
+/**
+ * @brief
+ *   A read-only view of a CircularEventBuffer from the event at a given offset of its storage to its tail, so that a
+ *   TLVReader can start reading in the middle of the buffer.
+ */
+class CircularEventBufferView : public TLV::TLVBackingStore
+{
+public:
+    CircularEventBufferView(const CircularEventBuffer & aBuffer, uint32_t aOffset) : mBuffer(aBuffer), mOffset(aOffset) {}
+
+    /**
+     * The number of bytes from the offset to the tail of the buffer.
+     */
+    uint32_t GetLength() const
+    {
+        const uint32_t size = mBuffer.GetTotalDataLength();
+        return mBuffer.DataLength() - (mOffset + size - mBuffer.GetHeadOffset()) % size;
+    }
+
+    CHIP_ERROR OnInit(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        aBufStart = mBuffer.GetQueue() + mOffset;
+        aBufLen   = std::min(GetLength(), mBuffer.GetTotalDataLength() - mOffset);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        // The events wrap around the end of the storage at most once.
+        const uint32_t firstPartLength = mBuffer.GetTotalDataLength() - mOffset;
+        if (aBufStart == mBuffer.GetQueue() + mBuffer.GetTotalDataLength() && GetLength() > firstPartLength)
+        {
+            aBufStart = mBuffer.GetQueue();
+            aBufLen   = GetLength() - firstPartLength;
+        }
+        else
+        {
+            aBufLen = 0;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & aWriter, uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR GetNewBuffer(TLVWriter & aWriter, uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & aWriter, uint8_t * aBufStart, uint32_t aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const CircularEventBuffer & mBuffer;
+    const uint32_t mOffset;
 };
 
 /**
@@ -119,11 +186,89 @@ CHIP_ERROR EventManagement::Init(Messaging::ExchangeManager * apExchangeManager,
 
     mMonotonicStartupTime = aMonotonicStartupTime;
 
-    mpEventReporter = apEventReporter;
+    mpEventReporter   = apEventReporter;
+    mpStorageDelegate = nullptr;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::RestoreEvents(EventStorageDelegate & aDelegate)
+{
+    VerifyOrReturnError(mState == EventManagementStates::Idle && mBytesWritten == 0, CHIP_ERROR_INCORRECT_STATE);
+
+    uint32_t bufferIndex = 0;
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer(), bufferIndex++)
+    {
+        uint32_t headOffset = 0;
+        uint32_t dataLength = 0;
+        CHIP_ERROR err      = aDelegate.LoadBufferState(bufferIndex, headOffset, dataLength);
+        if (err == CHIP_ERROR_NOT_FOUND)
+        {
+            continue;
+        }
+        ReturnErrorOnFailure(err);
+        RestoreBuffer(*buffer, headOffset, dataLength);
+    }
 
+    mpStorageDelegate = &aDelegate;
+    SaveBufferStates();
     return CHIP_NO_ERROR;
 }
 
+void EventManagement::RestoreBuffer(CircularEventBuffer & aBuffer, uint32_t aHeadOffset, uint32_t aDataLength)
+{
+    if (aBuffer.Restore(aHeadOffset, aDataLength) != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Dropped persisted events of buffer with priority %u: invalid state",
+                     static_cast<unsigned>(aBuffer.GetPriority()));
+        return;
+    }
+
+    CircularEventBufferView view(aBuffer, aBuffer.GetHeadOffset());
+    TLVReader reader;
+    uint32_t validLength = 0;
+    size_t eventCount    = 0;
+    EventNumber previous = 0;
+    VerifyOrExit(reader.Init(view, view.GetLength()) == CHIP_NO_ERROR, /* keep no event */);
+
+    // Keep the events up to the first one that is incomplete or does not belong to the log.
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        const uint32_t eventOffset = (aBuffer.GetHeadOffset() + validLength) % aBuffer.GetTotalDataLength();
+        EventEnvelopeContext event;
+        VerifyOrExit(ReadEventEnvelope(reader, event) == CHIP_NO_ERROR, /* drop the event */);
+        VerifyOrExit((event.mFieldsToRead & kRequiredEventField) == kRequiredEventField, /* drop the event */);
+        VerifyOrExit(event.mEventNumber < mLastEventNumber && (eventCount == 0 || event.mEventNumber > previous),
+                     /* drop the event */);
+
+        aBuffer.OnEventWritten(eventOffset, event.mEventNumber, event.mEndpointId, event.mClusterId);
+        validLength = reader.GetLengthRead();
+        previous    = event.mEventNumber;
+        eventCount++;
+    }
+
+exit:
+    if (validLength != aDataLength)
+    {
+        ChipLogError(EventLogging, "Dropped %" PRIu32 " bytes of invalid persisted events from buffer with priority %u",
+                     aDataLength - validLength, static_cast<unsigned>(aBuffer.GetPriority()));
+    }
+    TEMPORARY_RETURN_IGNORED aBuffer.Restore(aBuffer.GetHeadOffset(), validLength);
+    ChipLogProgress(EventLogging, "Restored %u persisted events in buffer with priority %u", static_cast<unsigned>(eventCount),
+                    static_cast<unsigned>(aBuffer.GetPriority()));
+}
+
+void EventManagement::SaveBufferStates()
+{
+    VerifyOrReturn(mpStorageDelegate != nullptr);
+
+    uint32_t bufferIndex = 0;
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer(), bufferIndex++)
+    {
+        mpStorageDelegate->SaveBufferState(bufferIndex, buffer->GetHeadOffset(), buffer->DataLength());
+    }
+}
+
 CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
 {
     CircularTLVWriter writer;
@@ -134,7 +279,8 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    CircularEventBuffer backup = *nextBuffer;
+    // Only the state of the circular buffer changes while copying, not the index of its events.
+    TLVCircularBuffer backup = *nextBuffer;
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -157,7 +303,7 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
 exit:
     if (err != CHIP_NO_ERROR)
     {
-        *nextBuffer = backup;
+        static_cast<TLVCircularBuffer &>(*nextBuffer) = backup;
     }
     return err;
 }
@@ -198,6 +344,10 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
             err                                 = eventBuffer->EvictHead();
+            if (err == CHIP_NO_ERROR)
+            {
+                eventBuffer->OnHeadEvicted();
+            }
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -215,8 +365,12 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    CircularEventBuffer * nextBuffer = eventBuffer->GetNextCircularEventBuffer();
+                    const uint32_t movedEventOffset  = nextBuffer->GetTailOffset();
+                    err                              = CopyToNextBuffer(eventBuffer);
                     SuccessOrExit(err);
+                    nextBuffer->OnEventWritten(movedEventOffset, ctx.mMovedEventNumber, ctx.mMovedEventEndpoint,
+                                               ctx.mMovedEventCluster);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
                     err                                 = eventBuffer->EvictHead();
@@ -226,6 +380,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // caller know that we could not honor the
                     // request
                     SuccessOrExit(err);
+                    eventBuffer->OnHeadEvicted();
                     continue;
                 }
                 // we cannot copy event outright. We remember the
@@ -353,9 +508,10 @@ void EventManagement::CreateEventManagement(Messaging::ExchangeManager * apExcha
  */
 void EventManagement::DestroyEventManagement()
 {
-    sInstance.mState        = EventManagementStates::Shutdown;
-    sInstance.mpEventBuffer = nullptr;
-    sInstance.mpExchangeMgr = nullptr;
+    sInstance.mState            = EventManagementStates::Shutdown;
+    sInstance.mpEventBuffer     = nullptr;
+    sInstance.mpExchangeMgr     = nullptr;
+    sInstance.mpStorageDelegate = nullptr;
 }
 
 CircularEventBuffer * EventManagement::GetPriorityBuffer(PriorityLevel aPriority) const
@@ -380,8 +536,11 @@ CHIP_ERROR EventManagement::CopyAndAdjustDeltaTime(const TLVReader & aReader, si
         // Does not go on the wire.
         return CHIP_NO_ERROR;
     }
+    // Events restored from a previous boot may have later system timestamps than the events logged since, which cannot be
+    // encoded as deltas.
     if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kSystemTimestamp)) && !(ctx->mpContext->mFirst) &&
-        (ctx->mpContext->mCurrentTime.mType == ctx->mpContext->mPreviousTime.mType))
+        (ctx->mpContext->mCurrentTime.mType == ctx->mpContext->mPreviousTime.mType) &&
+        (ctx->mpContext->mCurrentTime.mValue >= ctx->mpContext->mPreviousTime.mValue))
     {
         return ctx->mpWriter->Put(TLV::ContextTag(EventDataIB::Tag::kDeltaSystemTimestamp),
                                   ctx->mpContext->mCurrentTime.mValue - ctx->mpContext->mPreviousTime.mValue);
@@ -424,6 +583,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     CircularTLVWriter writer;
     CHIP_ERROR err               = CHIP_NO_ERROR;
     uint32_t requestSize         = 0;
+    uint32_t eventOffset         = 0;
     aEventNumber                 = 0;
     CircularTLVWriter checkpoint = writer;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
@@ -465,12 +625,18 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = EnsureSpaceInCircularBuffer(requestSize, aEventOptions.mPriority);
     SuccessOrExit(err);
 
-    err = ConstructEvent(&ctxt, apDelegate, &opts);
+    // Evicting events only moves the head of the buffer, the event is written at its tail.
+    eventOffset = mpEventBuffer->GetTailOffset();
+    err         = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
+    mpEventBuffer->OnEventWritten(eventOffset, ctxt.mCurrentEventNumber, opts.mPath.mEndpointId, opts.mPath.mClusterId);
 
     mBytesWritten += writer.GetLengthWritten();
 
 exit:
+    // Events may have been evicted even if logging failed.
+    SaveBufferStates();
+
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(EventLogging, "Log event with error %" CHIP_ERROR_FORMAT, err.Format());
@@ -653,23 +819,83 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
     return err;
 }
 
+CHIP_ERROR EventManagement::CopyEventsFromBuffer(const CircularEventBuffer & aBuffer, EventLoadOutContext & aContext)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    const CircularEventBuffer::Index * index = aBuffer.GetIndex();
+    if (index != nullptr)
+    {
+        auto mayMatch = [&aContext](const CircularEventBuffer::Index::Block & block) {
+            VerifyOrReturnValue(block.lastEventNumber >= aContext.mStartingEventNumber, false);
+            for (auto * path = aContext.mpInterestedEventPaths; path != nullptr; path = path->mpNext)
+            {
+                if (block.MayContain(path->mValue))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        size_t blockIndex = 0;
+        while (blockIndex < index->GetBlockCount())
+        {
+            const CircularEventBuffer::Index::Block & block = index->GetBlock(blockIndex++);
+            if (!mayMatch(block))
+            {
+                // Same as decoding the events of the block and leaving them out.
+                aContext.mCurrentEventNumber = block.lastEventNumber;
+                continue;
+            }
+
+            // Read the events of this block and of the following ones that may match in one go.
+            size_t eventCount = block.eventCount;
+            while (blockIndex < index->GetBlockCount() && mayMatch(index->GetBlock(blockIndex)))
+            {
+                eventCount += index->GetBlock(blockIndex++).eventCount;
+            }
+            ReturnErrorOnFailure(CopyEventsFromOffset(aBuffer, block.offset, eventCount, aContext));
+        }
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
+    return CopyEventsFromOffset(aBuffer, aBuffer.GetHeadOffset(), SIZE_MAX, aContext);
+}
+
+CHIP_ERROR EventManagement::CopyEventsFromOffset(const CircularEventBuffer & aBuffer, uint32_t aOffset, size_t aEventCount,
+                                                 EventLoadOutContext & aContext)
+{
+    CircularEventBufferView view(aBuffer, aOffset);
+    TLVReader reader;
+    ReturnErrorOnFailure(reader.Init(view, view.GetLength()));
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (size_t i = 0; i < aEventCount && (err = reader.Next()) == CHIP_NO_ERROR; i++)
+    {
+        ReturnErrorOnFailure(CopyEventsSince(reader, 0, &aContext));
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
 CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLinkedListNode<EventPathParams> * apEventPathList,
                                              EventNumber & aEventMin, size_t & aEventCount,
                                              const Access::SubjectDescriptor & aSubjectDescriptor)
 {
-    // TODO: Add particular set of event Paths in FetchEventsSince so that we can filter the interested paths
-    CHIP_ERROR err     = CHIP_NO_ERROR;
-    const bool recurse = false;
-    TLVReader reader;
-    CircularEventBufferWrapper bufWrapper;
+    CHIP_ERROR err = CHIP_NO_ERROR;
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
 
-    err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
+    // Events are read in the order they were logged: the most important buffer holds the oldest ones, and the least important
+    // one the newest.
+    CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical);
+    VerifyOrExit(buffer != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
+    for (; buffer != nullptr && err == CHIP_NO_ERROR; buffer = buffer->GetPreviousCircularEventBuffer())
+    {
+        err = CopyEventsFromBuffer(*buffer, context);
+    }
     if (err == CHIP_END_OF_TLV)
     {
         err = CHIP_NO_ERROR;
@@ -816,20 +1042,16 @@ CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAppData, TLVReader & aReader)
+CHIP_ERROR EventManagement::ReadEventEnvelope(TLVReader & aReader, EventEnvelopeContext & aEvent)
 {
-    // pull out the delta time, pull out the priority
-    ReturnErrorOnFailure(aReader.Next());
-
     TLVType containerType;
     TLVType containerType1;
     ReturnErrorOnFailure(aReader.EnterContainer(containerType));
     ReturnErrorOnFailure(aReader.Next());
 
     ReturnErrorOnFailure(aReader.EnterContainer(containerType1));
-    EventEnvelopeContext context;
     constexpr bool recurse = false;
-    CHIP_ERROR err         = TLV::Utilities::Iterate(aReader, FetchEventParameters, &context, recurse);
+    CHIP_ERROR err         = TLV::Utilities::Iterate(aReader, FetchEventParameters, &aEvent, recurse);
     if (err == CHIP_END_OF_TLV)
     {
         err = CHIP_NO_ERROR;
@@ -837,7 +1059,16 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
     ReturnErrorOnFailure(err);
 
     ReturnErrorOnFailure(aReader.ExitContainer(containerType1));
-    ReturnErrorOnFailure(aReader.ExitContainer(containerType));
+    return aReader.ExitContainer(containerType);
+}
+
+CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAppData, TLVReader & aReader)
+{
+    // pull out the delta time, pull out the priority
+    ReturnErrorOnFailure(aReader.Next());
+
+    EventEnvelopeContext context;
+    ReturnErrorOnFailure(ReadEventEnvelope(aReader, context));
     const PriorityLevel imp = static_cast<PriorityLevel>(context.mPriority);
 
     ReclaimEventCtx * const ctx             = static_cast<ReclaimEventCtx *>(apAppData);
@@ -855,6 +1086,9 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
 
     // event is not getting dropped. Note how much space it requires, and return.
     ctx->mSpaceNeededForMovedEvent = aReader.GetLengthRead();
+    ctx->mMovedEventNumber         = context.mEventNumber;
+    ctx->mMovedEventEndpoint       = context.mEndpointId;
+    ctx->mMovedEventCluster        = context.mClusterId;
     return CHIP_END_OF_TLV;
 }
 
@@ -887,7 +1121,37 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    mIndex.Clear();
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+}
+
+void CircularEventBuffer::OnEventWritten(uint32_t aOffset, EventNumber aEventNumber, EndpointId aEndpointId, ClusterId aClusterId)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    if (aOffset == GetHeadOffset())
+    {
+        // The event is the only one of the buffer: start over, in case the index was out of sync.
+        mIndex.Clear();
+    }
+    mIndex.Append(aOffset, aEventNumber, aEndpointId, aClusterId);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+}
+
+void CircularEventBuffer::OnHeadEvicted()
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    mIndex.RemoveOldest(GetHeadOffset());
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+}
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+const CircularEventBuffer::Index * CircularEventBuffer::GetIndex() const
+{
+    const bool inSync = (mIndex.GetEventCount() == 0) ? (DataLength() == 0) : (mIndex.GetBlock(0).offset == GetHeadOffset());
+    return inSync ? &mIndex : nullptr;
 }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
 {
@@ -28,6 +28,7 @@
 
 #include "EventLoggingDelegate.h"
 #include <access/SubjectDescriptor.h>
+#include <app/EventBufferIndex.h>
 #include <app/EventLoggingTypes.h>
 #include <app/EventReporter.h>
 #include <app/MessageDef/EventDataIB.h>
@@ -66,6 +67,13 @@
  * old CRITICAL events will not start getting dropped until both buffers are
  * full, while old DEBUG events will start getting dropped once the DEBUG
  * LogStorageResource buffer is full.
+ *
+ * Since events only move from a buffer to the next one when they are the
+ * oldest event of their buffer, the buffers hold increasing event numbers
+ * from the most important one back to the least important one.  When
+ * CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS is not 0, each buffer keeps an
+ * EventBufferIndex of its events, which lets FetchEventsSince skip the
+ * events that cannot be part of a report without decoding them.
  */
 
 #define CHIP_CONFIG_EVENT_GLOBAL_PRIORITY PriorityLevel::Debug
@@ -130,6 +138,46 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Offsets, in the storage of the buffer, of its oldest event and of where the next event will be written.
+     */
+    uint32_t GetHeadOffset() const
+    {
+        // The head is left at the end of the storage when the oldest event ends there.
+        const uint32_t offset = static_cast<uint32_t>(QueueHead() - GetQueue());
+        return (offset == GetTotalDataLength()) ? 0 : offset;
+    }
+    uint32_t GetTailOffset() const { return static_cast<uint32_t>(QueueTail() - GetQueue()); }
+
+    /**
+     * @brief
+     *   Record, in the index of the buffer, that an event was written at its tail (internal API).
+     *
+     * @param[in] aOffset      The tail offset of the buffer before the event was written.
+     * @param[in] aEventNumber The number of the event.
+     * @param[in] aEndpointId  The endpoint of the event.
+     * @param[in] aClusterId   The cluster of the event.
+     */
+    void OnEventWritten(uint32_t aOffset, EventNumber aEventNumber, EndpointId aEndpointId, ClusterId aClusterId);
+
+    /**
+     * @brief
+     *   Record, in the index of the buffer, that its oldest event was evicted (internal API).
+     */
+    void OnHeadEvicted();
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    using Index = EventBufferIndex<CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS>;
+
+    /**
+     * @brief
+     *   The index of the events of the buffer, or nullptr if it does not match the content of the buffer (e.g. because
+     *   the buffer evicted events on its own), in which case the buffer must be read from its head.
+     */
+    const Index * GetIndex() const;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -141,6 +189,10 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    Index mIndex;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -191,6 +243,36 @@ struct LogStorageResources
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
 };
 
+/**
+ * @brief
+ *   Interface to a persistent store backing the buffers of the LogStorageResources, e.g. a memory-mapped file, so that
+ *   logged events survive a restart.
+ *
+ * Events are written in place in the buffers, which the store persists on its own.  The delegate persists where the
+ * events of each buffer start and how many bytes they span.  Buffers are identified by their index in the array of
+ * LogStorageResources.
+ */
+class EventStorageDelegate
+{
+public:
+    virtual ~EventStorageDelegate() = default;
+
+    /**
+     * @brief
+     *   Load the state of a buffer, as last saved.
+     *
+     * @retval #CHIP_ERROR_NOT_FOUND No state was saved for the buffer, which is then empty.
+     */
+    virtual CHIP_ERROR LoadBufferState(uint32_t aBufferIndex, uint32_t & aHeadOffset, uint32_t & aDataLength) = 0;
+
+    /**
+     * @brief
+     *   Save the state of a buffer.  Called every time events are logged, so implementations should batch writes to the
+     *   store.
+     */
+    virtual void SaveBufferState(uint32_t aBufferIndex, uint32_t aHeadOffset, uint32_t aDataLength) = 0;
+};
+
 /**
  * @brief
  *   A class for managing the in memory event logs.  See documentation at the
@@ -279,6 +361,20 @@ public:
 
     static void DestroyEventManagement();
 
+    /**
+     * @brief
+     *   Restore the events persisted in the buffers by a persistent store, and keep the store updated as events are logged.
+     *
+     * Must be called right after Init, before any event is logged.  The events of each buffer are checked from its head;
+     * the events following the first one that is truncated or corrupted, or that has an event number not lower than the
+     * next one to vend, are dropped.
+     *
+     * @param[in] aDelegate  The delegate persisting the state of the buffers.  Must outlive the EventManagement.
+     *
+     * @retval #CHIP_ERROR_INCORRECT_STATE EventManagement is not initialized, or events were already logged.
+     */
+    CHIP_ERROR RestoreEvents(EventStorageDelegate & aDelegate);
+
     /**
      * @brief
      *   Log an event via a EventLoggingDelegate, with options.
@@ -507,6 +603,24 @@ private:
      */
     static CHIP_ERROR CopyEventsSince(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+    /**
+     * @brief
+     *   Internal API used to implement #FetchEventsSince
+     *
+     * Copies the events of @a aBuffer that match @a aContext into its TLVWriter. When the buffer is indexed, the events
+     * that cannot match are skipped without being decoded.
+     */
+    static CHIP_ERROR CopyEventsFromBuffer(const CircularEventBuffer & aBuffer, EventLoadOutContext & aContext);
+
+    /**
+     * @brief
+     *   Internal API used to implement #FetchEventsSince
+     *
+     * Same as CopyEventsFromBuffer, for at most @a aEventCount events of @a aBuffer starting with the one at @a aOffset.
+     */
+    static CHIP_ERROR CopyEventsFromOffset(const CircularEventBuffer & aBuffer, uint32_t aOffset, size_t aEventCount,
+                                           EventLoadOutContext & aContext);
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      *
@@ -525,6 +639,22 @@ private:
      */
     static CHIP_ERROR FetchEventParameters(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+    /**
+     * @brief Fetch the parameters of the event the reader is positioned on into an EventEnvelopeContext, and move the reader
+     * past the event.
+     */
+    static CHIP_ERROR ReadEventEnvelope(TLV::TLVReader & aReader, EventEnvelopeContext & aEvent);
+
+    /**
+     * @brief Restore the state of a buffer whose storage holds persisted events, keeping only the valid ones.
+     */
+    void RestoreBuffer(CircularEventBuffer & aBuffer, uint32_t aHeadOffset, uint32_t aDataLength);
+
+    /**
+     * @brief Save the state of every buffer through the storage delegate, if any.
+     */
+    void SaveBufferStates();
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      * First event gets a timestamp, subsequent ones get a delta T
@@ -580,6 +710,8 @@ private:
     System::Clock::Milliseconds64 mMonotonicStartupTime{};
 
     EventReporter * mpEventReporter = nullptr;
+
+    EventStorageDelegate * mpStorageDelegate = nullptr;
 };
 
 } // namespace app
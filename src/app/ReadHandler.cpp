@@ -148,6 +148,8 @@ ReadHandler::~ReadHandler()
 {
     mObserver->OnReadHandlerDestroyed(this);
 
+    ClearPendingAttributeValue();
+
     auto * appCallback = mManagementCallback.GetAppCallback();
     if (mFlags.Has(ReadHandlerFlags::ActiveSubscription) && appCallback)
     {
@@ -360,6 +362,7 @@ CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, b
     {
         mPreviousReportsBeginGeneration = mCurrentReportsBeginGeneration;
         ClearForceDirtyFlag();
+        ClearPendingAttributeValue();
         mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
     }
 
@@ -623,6 +626,8 @@ const char * ReadHandler::GetStateStr() const
 
     case HandlerState::AwaitingReportResponse:
         return "AwaitingReportResponse";
+    case HandlerState::AwaitingAttributeValue:
+        return "AwaitingAttributeValue";
     }
 #endif // CHIP_DETAIL_LOGGING
     return "N/A";
@@ -930,6 +935,73 @@ void ReadHandler::ClearStateFlag(ReadHandlerFlags aFlag)
     SetStateFlag(aFlag, false);
 }
 
+void ReadHandler::OnAttributeValuePending(const ConcreteAttributePath & aPath)
+{
+    if (mFlags.Has(ReadHandlerFlags::AttributeValuePending) && mPendingAttributePath == aPath)
+    {
+        return;
+    }
+
+    ClearPendingAttributeValue();
+    mPendingAttributePath = aPath;
+    mFlags.Set(ReadHandlerFlags::AttributeValuePending);
+
+    System::Layer * systemLayer =
+        mManagementCallback.GetInteractionModelEngine()->GetExchangeManager()->GetSessionManager()->SystemLayer();
+    CHIP_ERROR err = systemLayer->StartTimer(System::Clock::Milliseconds32(CHIP_IM_SERVER_PENDING_READ_TIMEOUT_MS),
+                                             OnPendingAttributeValueTimeout, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Without a timer, give up on the value right away rather than risk waiting for it forever.
+        ChipLogError(DataManagement, "Failed to start pending read timer: %" CHIP_ERROR_FORMAT, err.Format());
+        mFlags.Set(ReadHandlerFlags::AttributeValueTimedOut);
+    }
+}
+
+void ReadHandler::ClearPendingAttributeValue()
+{
+    VerifyOrReturn(mFlags.Has(ReadHandlerFlags::AttributeValuePending));
+
+    mManagementCallback.GetInteractionModelEngine()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
+        OnPendingAttributeValueTimeout, this);
+    mFlags.Clear(ReadHandlerFlags::AttributeValuePending).Clear(ReadHandlerFlags::AttributeValueTimedOut);
+}
+
+void ReadHandler::AwaitAttributeValue()
+{
+    VerifyOrReturn(mState == HandlerState::CanStartReporting && mFlags.Has(ReadHandlerFlags::AttributeValuePending));
+
+    ChipLogDetail(DataManagement, "Report waits for the value of " ChipLogFormatMEI "/" ChipLogFormatMEI " on endpoint %u",
+                  ChipLogValueMEI(mPendingAttributePath.mClusterId), ChipLogValueMEI(mPendingAttributePath.mAttributeId),
+                  mPendingAttributePath.mEndpointId);
+    MoveToState(HandlerState::AwaitingAttributeValue);
+}
+
+void ReadHandler::OnAttributeValueAvailable(const AttributePathParams & aPath)
+{
+    VerifyOrReturn(mFlags.Has(ReadHandlerFlags::AttributeValuePending) && aPath.IsAttributePathSupersetOf(mPendingAttributePath));
+
+    // The pending read stays recorded (and its timer running) until the engine reads the value successfully.
+    if (mState == HandlerState::AwaitingAttributeValue)
+    {
+        MoveToState(HandlerState::CanStartReporting);
+    }
+}
+
+void ReadHandler::OnPendingAttributeValueTimeout(System::Layer * apSystemLayer, void * apAppState)
+{
+    ReadHandler * const readHandler = static_cast<ReadHandler *>(apAppState);
+
+    ChipLogError(DataManagement, "Pending read of " ChipLogFormatMEI "/" ChipLogFormatMEI " on endpoint %u timed out",
+                 ChipLogValueMEI(readHandler->mPendingAttributePath.mClusterId),
+                 ChipLogValueMEI(readHandler->mPendingAttributePath.mAttributeId), readHandler->mPendingAttributePath.mEndpointId);
+    readHandler->mFlags.Set(ReadHandlerFlags::AttributeValueTimedOut);
+    if (readHandler->mState == HandlerState::AwaitingAttributeValue)
+    {
+        readHandler->MoveToState(HandlerState::CanStartReporting);
+    }
+}
+
 size_t ReadHandler::GetReportBufferMaxSize()
 {
     Transport::SecureSession * session = GetSession();
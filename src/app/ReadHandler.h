@@ -374,6 +374,12 @@ private:
 
         // Don't need the response for report data if true
         SuppressResponse = (1 << 5),
+
+        // The data model provider could not read mPendingAttributePath synchronously, the report will resume when its value
+        // is available.
+        AttributeValuePending = (1 << 6),
+        // The value of mPendingAttributePath did not become available within CHIP_IM_SERVER_PENDING_READ_TIMEOUT_MS.
+        AttributeValueTimedOut = (1 << 7),
     };
 
     /**
@@ -435,6 +441,30 @@ private:
         return CanStartReporting() && (IsType(ReadHandler::InteractionType::Read) || IsPriming());
     }
     bool IsAwaitingReportResponse() const { return mState == HandlerState::AwaitingReportResponse; }
+    bool IsAwaitingAttributeValue() const { return mState == HandlerState::AwaitingAttributeValue; }
+
+    /// @brief Records that the data model provider could not read @a aPath synchronously, and starts the pending read timer
+    /// unless it already runs for that path. If the timer cannot be started, the read is considered timed out.
+    void OnAttributeValuePending(const ConcreteAttributePath & aPath);
+    /// @brief Whether the pending read of @a aPath timed out, in which case a Timeout status should be reported for it.
+    bool HasAttributeValueTimedOut(const ConcreteAttributePath & aPath) const
+    {
+        return mFlags.Has(ReadHandlerFlags::AttributeValueTimedOut) && mPendingAttributePath == aPath;
+    }
+    /// @brief Forgets the pending read of @a aPath, if any, once its value or status was reported.
+    void ClearPendingAttributeValue(const ConcreteAttributePath & aPath)
+    {
+        if (mFlags.Has(ReadHandlerFlags::AttributeValuePending) && mPendingAttributePath == aPath)
+        {
+            ClearPendingAttributeValue();
+        }
+    }
+    /// @brief Parks the handler until the value of the pending attribute is available or its read times out: nothing could
+    /// be added to the current report without it.
+    void AwaitAttributeValue();
+    /// @brief Notifies the read handler that the value of the attributes of @a aPath changed, which resumes the report if it
+    /// was waiting for one of them.
+    void OnAttributeValueAvailable(const AttributePathParams & aPath);
 
     // Resets the path iterator to the beginning of the whole report for generating a series of new reports.
     void ResetPathIterator();
@@ -530,6 +560,8 @@ private:
         CanStartReporting,      ///< The handler has is now capable of generating reports and may generate one immediately
                                 ///< or later when other criteria are satisfied (e.g hold-off for min reporting interval).
         AwaitingReportResponse, ///< The handler has sent the report to the client and is awaiting a status response.
+        AwaitingAttributeValue, ///< The handler cannot continue the report until the data model provides the value of a
+                                ///< pending attribute read.
         AwaitingDestruction,    ///< The object has completed its work and is awaiting destruction by the application.
     };
 
@@ -575,6 +607,9 @@ private:
     /// @param aFlag Flag to clear
     void ClearStateFlag(ReadHandlerFlags aFlag);
 
+    void ClearPendingAttributeValue();
+    static void OnPendingAttributeValueTimeout(System::Layer * apSystemLayer, void * apAppState);
+
     SubscriptionId mSubscriptionId = 0;
 
     // The current generation of the reporting engine dirty set the last time we were notified that a path we're interested in was
@@ -647,6 +682,9 @@ private:
     // The size of AttributeEncoderState is 2 bytes for now.
     AttributeEncodeState mAttributeEncoderState;
 
+    // The attribute the report is waiting for, valid while ReadHandlerFlags::AttributeValuePending is set.
+    ConcreteAttributePath mPendingAttributePath;
+
     uint16_t mMinIntervalFloorSeconds        = 0;
     uint16_t mMaxInterval                    = 0;
     uint16_t mSubscriberRequestedMaxInterval = 0;
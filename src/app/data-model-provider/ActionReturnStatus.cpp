@@ -182,6 +182,16 @@ bool ActionReturnStatus::IsOutOfSpaceEncodingResponse() const
     return false;
 }
 
+bool ActionReturnStatus::IsPendingResponse() const
+{
+    if (const CHIP_ERROR * err = std::get_if<CHIP_ERROR>(&mReturnStatus))
+    {
+        return *err == CHIP_ERROR_IN_PROGRESS;
+    }
+
+    return false;
+}
+
 const char * ActionReturnStatus::c_str(ActionReturnStatus::StringStorage & storage) const
 {
     if (const CHIP_ERROR * err = std::get_if<CHIP_ERROR>(&mReturnStatus))
@@ -98,6 +98,12 @@ public:
     /// Generally this is when the return is based on CHIP_ERROR_NO_MEMORY or CHIP_ERROR_BUFFER_TOO_SMALL
     bool IsOutOfSpaceEncodingResponse() const;
 
+    /// Checks if the underlying error means that the value is not available yet (i.e. a read
+    /// that the data model provider completes asynchronously, for example from a bridged device).
+    ///
+    /// Generally this is when the return is based on CHIP_ERROR_IN_PROGRESS
+    bool IsPendingResponse() const;
+
     /// Check if the operation was successful but shouldn't trigger any specific operation
     /// (e.g. overwriting an attribute with the same value).
     bool IsNoOpSuccess() const;
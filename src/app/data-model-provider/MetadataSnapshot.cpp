@@ -0,0 +1,144 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/data-model-provider/MetadataSnapshot.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+uint32_t MetadataSnapshot::Validate(ProviderMetadataTree * provider)
+{
+    std::optional<uint32_t> generation = (kMaxEntries > 0 && provider != nullptr) ? provider->MetadataGeneration() : std::nullopt;
+    if (provider != mProvider || generation != mGeneration)
+    {
+        Clear();
+        mProvider   = provider;
+        mGeneration = generation;
+    }
+    return mEpoch;
+}
+
+std::optional<Span<const EndpointEntry>> MetadataSnapshot::Endpoints(ProviderMetadataTree * provider)
+{
+    VerifyOrReturnValue(IsCaching(provider), std::nullopt);
+
+    if (!mHasEndpoints)
+    {
+        ReadOnlyBuffer<EndpointEntry> endpoints = provider->EndpointsIgnoreError();
+        VerifyOrReturnValue(Reserve(endpoints.size()), std::nullopt);
+        mEndpoints    = std::move(endpoints);
+        mHasEndpoints = true;
+    }
+    return mEndpoints;
+}
+
+std::optional<Span<const ServerClusterEntry>> MetadataSnapshot::ServerClusters(ProviderMetadataTree * provider,
+                                                                               EndpointId endpointId)
+{
+    VerifyOrReturnValue(IsCaching(provider), std::nullopt);
+
+    ClusterList *& bucket = mClusterLists[Bucket(endpointId, kInvalidClusterId)];
+    for (ClusterList * list = bucket; list != nullptr; list = list->next)
+    {
+        if (list->endpointId == endpointId)
+        {
+            return list->clusters;
+        }
+    }
+
+    ReadOnlyBuffer<ServerClusterEntry> clusters = provider->ServerClustersIgnoreError(endpointId);
+    VerifyOrReturnValue(Reserve(clusters.size()), std::nullopt);
+
+    ClusterList * list = Platform::New<ClusterList>();
+    VerifyOrReturnValue(list != nullptr, std::nullopt);
+    list->endpointId = endpointId;
+    list->clusters   = std::move(clusters);
+    list->next       = bucket;
+    bucket           = list;
+    return list->clusters;
+}
+
+std::optional<Span<const AttributeEntry>> MetadataSnapshot::Attributes(ProviderMetadataTree * provider,
+                                                                       const ConcreteClusterPath & path)
+{
+    VerifyOrReturnValue(IsCaching(provider), std::nullopt);
+
+    AttributeList *& bucket = mAttributeLists[Bucket(path.mEndpointId, path.mClusterId)];
+    for (AttributeList * list = bucket; list != nullptr; list = list->next)
+    {
+        if (list->path == path)
+        {
+            return list->attributes;
+        }
+    }
+
+    ReadOnlyBuffer<AttributeEntry> attributes = provider->AttributesIgnoreError(path);
+    VerifyOrReturnValue(Reserve(attributes.size()), std::nullopt);
+
+    AttributeList * list = Platform::New<AttributeList>();
+    VerifyOrReturnValue(list != nullptr, std::nullopt);
+    list->path       = path;
+    list->attributes = std::move(attributes);
+    list->next       = bucket;
+    bucket           = list;
+    return list->attributes;
+}
+
+void MetadataSnapshot::Clear()
+{
+    VerifyOrReturn(mEntryCount > 0);
+
+    for (auto & bucket : mClusterLists)
+    {
+        while (bucket != nullptr)
+        {
+            ClusterList * next = bucket->next;
+            Platform::Delete(bucket);
+            bucket = next;
+        }
+    }
+    for (auto & bucket : mAttributeLists)
+    {
+        while (bucket != nullptr)
+        {
+            AttributeList * next = bucket->next;
+            Platform::Delete(bucket);
+            bucket = next;
+        }
+    }
+    mEndpoints    = ReadOnlyBuffer<EndpointEntry>();
+    mHasEndpoints = false;
+    mEntryCount   = 0;
+
+    // Spans handed out so far are no longer valid.
+    mEpoch++;
+}
+
+bool MetadataSnapshot::Reserve(size_t size)
+{
+    // Every list counts for at least one entry, so that empty lists are bounded as well.
+    const size_t needed = size + 1;
+    VerifyOrReturnValue(needed <= kMaxEntries - mEntryCount, false);
+    mEntryCount += needed;
+    return true;
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteClusterPath.h>
+#include <app/data-model-provider/MetadataTypes.h>
+#include <app/data-model-provider/ProviderMetadataTree.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/FibonacciHash.h>
+#include <lib/support/ReadOnlyBuffer.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+namespace detail {
+
+/// Power-of-two number of hash buckets for a snapshot of `maxEntries` entries.
+constexpr size_t SnapshotBucketCount(size_t maxEntries)
+{
+    size_t count = (maxEntries > 0) ? 8 : 1;
+    while (count < maxEntries / 8)
+    {
+        count <<= 1;
+    }
+    return count;
+}
+
+} // namespace detail
+
+/// A cache of the endpoint, server cluster and attribute lists of a ProviderMetadataTree, so that walking
+/// the composition of a data model (e.g. to expand wildcard paths) does not allocate a new list every time.
+///
+/// The snapshot is stamped with the `MetadataGeneration` of the provider and is cleared as soon as that
+/// generation changes. Lists are fetched from the provider on first use and kept until then, up to
+/// CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES entries in total; past that, or for providers that do not
+/// track their generation, the snapshot returns std::nullopt and callers query the provider directly.
+///
+/// Only the composition is tracked: fields that change without a composition change (like the data
+/// version of a ServerClusterEntry) may be stale and must not be used from the snapshot.
+///
+/// Usage:
+///
+///   - call `Validate` before using the snapshot, and whenever the provider may have changed since
+///   - spans returned by the snapshot stay valid for as long as the epoch returned by `Validate` does not change
+class MetadataSnapshot
+{
+public:
+    MetadataSnapshot() = default;
+    ~MetadataSnapshot() { Clear(); }
+
+    MetadataSnapshot(const MetadataSnapshot &)             = delete;
+    MetadataSnapshot & operator=(const MetadataSnapshot &) = delete;
+
+    /// Clears the snapshot if it does not match the current metadata generation of `provider`.
+    ///
+    /// Returns the epoch of the snapshot, which changes every time cached lists are released.
+    uint32_t Validate(ProviderMetadataTree * provider);
+
+    std::optional<Span<const EndpointEntry>> Endpoints(ProviderMetadataTree * provider);
+    std::optional<Span<const ServerClusterEntry>> ServerClusters(ProviderMetadataTree * provider, EndpointId endpointId);
+    std::optional<Span<const AttributeEntry>> Attributes(ProviderMetadataTree * provider, const ConcreteClusterPath & path);
+
+    /// Releases all cached lists.
+    void Clear();
+
+private:
+    static constexpr size_t kMaxEntries = CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES;
+
+    static constexpr size_t kBucketCount = detail::SnapshotBucketCount(kMaxEntries);
+
+    struct ClusterList
+    {
+        EndpointId endpointId;
+        ReadOnlyBuffer<ServerClusterEntry> clusters;
+        ClusterList * next;
+    };
+
+    struct AttributeList
+    {
+        ConcreteClusterPath path;
+        ReadOnlyBuffer<AttributeEntry> attributes;
+        AttributeList * next;
+    };
+
+    static size_t Bucket(EndpointId endpointId, ClusterId clusterId)
+    {
+        return FibonacciHashIndex(FibonacciHashCombine(clusterId, endpointId), kBucketCount);
+    }
+
+    /// Whether `provider` is the one the snapshot was validated for, and can be cached.
+    bool IsCaching(ProviderMetadataTree * provider) const { return mGeneration.has_value() && provider == mProvider; }
+
+    /// Accounts for a new list of `size` entries, returning false if it does not fit.
+    bool Reserve(size_t size);
+
+    ProviderMetadataTree * mProvider = nullptr;
+    std::optional<uint32_t> mGeneration;
+    uint32_t mEpoch    = 0;
+    size_t mEntryCount = 0;
+    bool mHasEndpoints = false;
+
+    ReadOnlyBuffer<EndpointEntry> mEndpoints;
+    ClusterList * mClusterLists[kBucketCount]     = {};
+    AttributeList * mAttributeLists[kBucketCount] = {};
+};
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -16,6 +16,7 @@
  */
 #include "platform/LockTracker.h"
 #include <app/data-model-provider/Provider.h>
+#include <clusters/shared/GlobalIds.h>
 
 namespace chip::app::DataModel {
 
@@ -67,6 +68,11 @@ void Provider::NotifyAttributeChanged(const ConcreteAttributePath & path, Attrib
 {
     assertChipStackLockedByCurrentThread();
 
+    if (path.mAttributeId == Clusters::Globals::Attributes::AttributeList::Id)
+    {
+        mNotifiedCompositionChanges++;
+    }
+
     // Register this iteration on the stack of active iterators.
     // This allows UnregisterAttributeChangeListener to update us if needed.
     ActiveIterator iter;
@@ -88,6 +94,8 @@ void Provider::NotifyEndpointChanged(EndpointId endpointId, EndpointChangeType t
 {
     assertChipStackLockedByCurrentThread();
 
+    mNotifiedCompositionChanges++;
+
     // Register this iteration on the stack of active iterators.
     // This allows UnregisterAttributeChangeListener to update us if needed.
     ActiveIterator iter;
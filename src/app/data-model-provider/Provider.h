@@ -67,6 +67,12 @@ public:
     ///      - Indicates that list encoding had insufficient buffer space to encode elements.
     ///      - encoder::GetState().AllowPartialData() determines if these errors are permanent (no partial
     ///        data allowed) or further encoding can be retried (AllowPartialData true for list encoding)
+    ///   ActionReturnStatus::IsPendingResponse
+    ///      - Indicates that the value is not available yet (e.g. it is being fetched from a bridged device)
+    ///        and nothing was encoded.
+    ///      - The provider must call NotifyAttributeChanged for `request.path` once the value is available,
+    ///        after this call returned. The reporting engine keeps serving other reads meanwhile and retries
+    ///        the read then, or reports a Timeout status after CHIP_IM_SERVER_PENDING_READ_TIMEOUT_MS.
     virtual ActionReturnStatus ReadAttribute(const ReadAttributeRequest & request, AttributeValueEncoder & encoder) = 0;
 
     /// Requests a write of an attribute.
@@ -128,6 +134,11 @@ public:
     void NotifyAttributeChanged(const ConcreteAttributePath & path, AttributeChangeType type);
     void NotifyEndpointChanged(EndpointId endpointId, EndpointChangeType type);
 
+protected:
+    /// Number of endpoint changes and AttributeList changes notified so far. Providers may use it as part
+    /// of their `MetadataGeneration`.
+    uint32_t GetNotifiedCompositionChanges() const { return mNotifiedCompositionChanges; }
+
 private:
     /// Represents an active iteration over the listener list.
     /// Since listeners can be unregistered during notification, and notifications
@@ -144,6 +155,7 @@ private:
 
     AttributeChangeListener * mAttributeChangeListenersHead = nullptr;
     ActiveIterator * mActiveIterators                       = nullptr; // Head of the stack of active iterators
+    uint32_t mNotifiedCompositionChanges                    = 0;
 };
 
 } // namespace DataModel
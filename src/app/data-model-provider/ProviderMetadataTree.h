@@ -80,6 +80,14 @@ public:
     virtual CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path,
                                         ReadOnlyBufferBuilder<AcceptedCommandEntry> & builder)                         = 0;
 
+    /// Returns a value that changes whenever the composition returned by `Endpoints`, `ServerClusters` and
+    /// `Attributes` (i.e. which endpoints, clusters and attributes exist) may have changed, so that callers
+    /// can cache it until then.
+    ///
+    /// Implementations that do not track composition changes return std::nullopt, in which case callers
+    /// MUST NOT cache the composition.
+    virtual std::optional<uint32_t> MetadataGeneration() { return std::nullopt; }
+
     // "convenience" functions that just return the data and ignore the error
     // This returns the `ReadOnlyBufferBuilder<..>::TakeBuffer` from their equivalent fuctions as-is,
     // even after an error (e.g. not found would return empty data).
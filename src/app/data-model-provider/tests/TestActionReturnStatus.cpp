@@ -90,6 +90,18 @@ TEST(TestActionReturnStatus, TestIsError)
     ASSERT_FALSE(ActionReturnStatus(CHIP_NO_ERROR).IsError());
 }
 
+TEST(TestActionReturnStatus, TestIsPendingResponse)
+{
+    ASSERT_TRUE(ActionReturnStatus(CHIP_ERROR_IN_PROGRESS).IsPendingResponse());
+    ASSERT_TRUE(ActionReturnStatus(CHIP_ERROR_IN_PROGRESS).IsError());
+    ASSERT_FALSE(ActionReturnStatus(CHIP_ERROR_IN_PROGRESS).IsOutOfSpaceEncodingResponse());
+
+    ASSERT_FALSE(ActionReturnStatus(CHIP_NO_ERROR).IsPendingResponse());
+    ASSERT_FALSE(ActionReturnStatus(CHIP_ERROR_NO_MEMORY).IsPendingResponse());
+    ASSERT_FALSE(ActionReturnStatus(Status::Busy).IsPendingResponse());
+    ASSERT_FALSE(ActionReturnStatus(Status::Timeout).IsPendingResponse());
+}
+
 TEST(TestActionReturnStatus, TestUnderlyingError)
 {
     ASSERT_EQ(ActionReturnStatus(ClusterStatusCode::ClusterSpecificFailure(123)).GetUnderlyingError(), CHIP_IM_CLUSTER_STATUS(123));
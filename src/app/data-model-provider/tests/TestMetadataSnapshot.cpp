@@ -0,0 +1,186 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <app/data-model-provider/MetadataSnapshot.h>
+#include <app/data-model-provider/ProviderMetadataTree.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::DataModel;
+
+constexpr EndpointId kEndpointCount = 3;
+constexpr ClusterId kClusterCount   = 4;
+
+// Metadata tree of kEndpointCount endpoints with kClusterCount clusters each, counting how many
+// lists it had to build.
+class CountingMetadataTree : public ProviderMetadataTree
+{
+public:
+    std::optional<uint32_t> generation = 1;
+    unsigned endpointsCalls            = 0;
+    unsigned serverClustersCalls       = 0;
+    unsigned attributesCalls           = 0;
+
+    std::optional<uint32_t> MetadataGeneration() override { return generation; }
+
+    CHIP_ERROR Endpoints(ReadOnlyBufferBuilder<EndpointEntry> & builder) override
+    {
+        endpointsCalls++;
+        for (EndpointId id = 1; id <= kEndpointCount; id++)
+        {
+            ReturnErrorOnFailure(builder.EnsureAppendCapacity(1));
+            ReturnErrorOnFailure(builder.Append({ id, kInvalidEndpointId, EndpointCompositionPattern::kFullFamily }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ServerClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ServerClusterEntry> & builder) override
+    {
+        serverClustersCalls++;
+        for (ClusterId id = 1; id <= kClusterCount; id++)
+        {
+            ReturnErrorOnFailure(builder.EnsureAppendCapacity(1));
+            ReturnErrorOnFailure(builder.Append({ id, 0, {} }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AttributeEntry> & builder) override
+    {
+        attributesCalls++;
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(1));
+        return builder.Append(AttributeEntry(path.mClusterId * 100, {}, Access::Privilege::kView, std::nullopt));
+    }
+
+    CHIP_ERROR DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<DeviceTypeEntry> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & builder) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR EventInfo(const ConcreteEventPath & path, EventEntry & eventInfo) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AcceptedCommandEntry> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+#if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
+    CHIP_ERROR EndpointUniqueID(EndpointId endpointId, MutableCharSpan & EndpointUniqueId) override { return CHIP_NO_ERROR; }
+#endif
+};
+
+class TestMetadataSnapshot : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        if (CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES < 64)
+        {
+            GTEST_SKIP() << "Skipping test: metadata snapshot disabled";
+        }
+    }
+};
+
+// Walks the whole composition through the snapshot.
+size_t Walk(MetadataSnapshot & snapshot, ProviderMetadataTree & tree)
+{
+    size_t attributeCount = 0;
+    auto endpoints        = snapshot.Endpoints(&tree);
+    EXPECT_TRUE(endpoints.has_value());
+    for (const auto & endpoint : endpoints.value_or(Span<const EndpointEntry>()))
+    {
+        auto clusters = snapshot.ServerClusters(&tree, endpoint.id);
+        EXPECT_TRUE(clusters.has_value());
+        for (const auto & cluster : clusters.value_or(Span<const ServerClusterEntry>()))
+        {
+            auto attributes = snapshot.Attributes(&tree, ConcreteClusterPath(endpoint.id, cluster.clusterId));
+            EXPECT_TRUE(attributes.has_value());
+            if (attributes.has_value())
+            {
+                EXPECT_EQ(attributes->size(), 1u);
+                EXPECT_EQ((*attributes)[0].attributeId, cluster.clusterId * 100);
+                attributeCount += attributes->size();
+            }
+        }
+    }
+    return attributeCount;
+}
+
+TEST_F(TestMetadataSnapshot, TestListsAreFetchedOnce)
+{
+    CountingMetadataTree tree;
+    MetadataSnapshot snapshot;
+
+    const uint32_t epoch = snapshot.Validate(&tree);
+    EXPECT_EQ(Walk(snapshot, tree), kEndpointCount * kClusterCount);
+    EXPECT_EQ(Walk(snapshot, tree), kEndpointCount * kClusterCount);
+    EXPECT_EQ(snapshot.Validate(&tree), epoch);
+
+    EXPECT_EQ(tree.endpointsCalls, 1u);
+    EXPECT_EQ(tree.serverClustersCalls, kEndpointCount);
+    EXPECT_EQ(tree.attributesCalls, kEndpointCount * kClusterCount);
+}
+
+TEST_F(TestMetadataSnapshot, TestGenerationChangeClearsSnapshot)
+{
+    CountingMetadataTree tree;
+    MetadataSnapshot snapshot;
+
+    const uint32_t epoch = snapshot.Validate(&tree);
+    Walk(snapshot, tree);
+
+    tree.generation = 2;
+    EXPECT_NE(snapshot.Validate(&tree), epoch);
+    Walk(snapshot, tree);
+
+    EXPECT_EQ(tree.endpointsCalls, 2u);
+    EXPECT_EQ(tree.serverClustersCalls, 2u * kEndpointCount);
+    EXPECT_EQ(tree.attributesCalls, 2u * kEndpointCount * kClusterCount);
+
+    // Another provider is another composition.
+    CountingMetadataTree otherTree;
+    snapshot.Validate(&otherTree);
+    EXPECT_FALSE(snapshot.Endpoints(&tree).has_value());
+    Walk(snapshot, otherTree);
+    EXPECT_EQ(otherTree.endpointsCalls, 1u);
+}
+
+TEST_F(TestMetadataSnapshot, TestUntrackedProviderIsNotCached)
+{
+    CountingMetadataTree tree;
+    MetadataSnapshot snapshot;
+
+    tree.generation      = std::nullopt;
+    const uint32_t epoch = snapshot.Validate(&tree);
+    EXPECT_FALSE(snapshot.Endpoints(&tree).has_value());
+    EXPECT_FALSE(snapshot.ServerClusters(&tree, 1).has_value());
+    EXPECT_FALSE(snapshot.Attributes(&tree, ConcreteClusterPath(1, 1)).has_value());
+    EXPECT_EQ(tree.endpointsCalls, 0u);
+
+    // Nothing was cached, so nothing was released.
+    EXPECT_EQ(snapshot.Validate(&tree), epoch);
+}
+
+} // namespace
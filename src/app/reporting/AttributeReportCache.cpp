@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/AttributeReportCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+#if CHIP_CONFIG_IM_REPORT_CACHE_SIZE > 0
+
+void AttributeReportCache::Begin()
+{
+    mActive     = true;
+    mEntryCount = 0;
+    mArenaUsed  = 0;
+    mRunStats   = Stats();
+}
+
+AttributeReportCache::Stats AttributeReportCache::End()
+{
+    mActive     = false;
+    mEntryCount = 0;
+    mArenaUsed  = 0;
+    return mRunStats;
+}
+
+AttributeReportCache::LookupResult AttributeReportCache::Find(const Key & key, ByteSpan & encoded)
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        const Entry & entry = mEntries[i];
+        if (!(entry.key == key))
+        {
+            continue;
+        }
+        if (entry.length == 0)
+        {
+            Bypass();
+            return LookupResult::kUncacheable;
+        }
+        encoded = ByteSpan(&mArena[entry.offset], entry.length);
+        mStats.hits++;
+        mRunStats.hits++;
+        return LookupResult::kHit;
+    }
+
+    if (mEntryCount < kMaxEntries)
+    {
+        return LookupResult::kMiss;
+    }
+
+    Bypass();
+    return LookupResult::kUncacheable;
+}
+
+MutableByteSpan AttributeReportCache::FreeSpace()
+{
+    return MutableByteSpan(&mArena[mArenaUsed], kArenaSize - mArenaUsed);
+}
+
+void AttributeReportCache::Bypass()
+{
+    mStats.bypassed++;
+    mRunStats.bypassed++;
+}
+
+void AttributeReportCache::Insert(const Key & key, size_t encodedLength)
+{
+    VerifyOrReturn(encodedLength > 0 && encodedLength <= kArenaSize - mArenaUsed);
+
+    Entry * entry = AddEntry(key);
+    VerifyOrReturn(entry != nullptr);
+    entry->offset = static_cast<uint16_t>(mArenaUsed);
+    entry->length = static_cast<uint16_t>(encodedLength);
+    mArenaUsed += encodedLength;
+    mStats.misses++;
+    mRunStats.misses++;
+}
+
+void AttributeReportCache::InsertUncacheable(const Key & key)
+{
+    Bypass();
+
+    Entry * entry = AddEntry(key);
+    VerifyOrReturn(entry != nullptr);
+    entry->offset = 0;
+    entry->length = 0;
+}
+
+AttributeReportCache::Entry * AttributeReportCache::AddEntry(const Key & key)
+{
+    VerifyOrReturnValue(mEntryCount < kMaxEntries, nullptr);
+    Entry * entry = &mEntries[mEntryCount++];
+    entry->key    = key;
+    return entry;
+}
+
+#else
+
+// The cache is never active, so that only Begin() and End() are called.
+void AttributeReportCache::Begin() {}
+
+AttributeReportCache::Stats AttributeReportCache::End()
+{
+    return Stats();
+}
+
+AttributeReportCache::LookupResult AttributeReportCache::Find(const Key &, ByteSpan &)
+{
+    return LookupResult::kUncacheable;
+}
+
+MutableByteSpan AttributeReportCache::FreeSpace()
+{
+    return MutableByteSpan();
+}
+
+void AttributeReportCache::Bypass() {}
+
+void AttributeReportCache::Insert(const Key &, size_t) {}
+
+void AttributeReportCache::InsertUncacheable(const Key &) {}
+
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_SIZE > 0
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/OperationTypes.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/BitFlags.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * A cache of encoded attribute reports, shared by the ReadHandlers served during one run of the reporting engine.
+ *
+ * When several subscribers report the same attribute in the same run, the first one reads it from the data model and
+ * encodes it into the cache, and the others copy the encoded AttributeReportIBs instead of reading and encoding the
+ * attribute again. Access checks are not cached: they are done for every subscriber before looking up the cache.
+ *
+ * The encoded report depends on the data version of the cluster and on the fabric it is read for (fabric-scoped
+ * attributes and fabric-sensitive fields), so both are part of the key along with the read flags. The cache is
+ * cleared at the end of every run, so it never outlives the attribute values it holds.
+ *
+ * Entries live in a fixed arena of CHIP_CONFIG_IM_REPORT_CACHE_SIZE bytes; the cache is disabled, and takes no space, when
+ * it is 0.
+ */
+class AttributeReportCache
+{
+public:
+    struct Key
+    {
+        ConcreteAttributePath path;
+        DataVersion dataVersion;
+        FabricIndex accessingFabricIndex;
+        BitFlags<DataModel::ReadFlags> readFlags;
+
+        bool operator==(const Key & other) const
+        {
+            return path == other.path && dataVersion == other.dataVersion &&
+                accessingFabricIndex == other.accessingFabricIndex && readFlags == other.readFlags;
+        }
+    };
+
+    struct Stats
+    {
+        // Reports copied from the cache.
+        uint32_t hits = 0;
+        // Reports read from the data model and added to the cache.
+        uint32_t misses = 0;
+        // Reports read from the data model without being cached, because they did not fit.
+        uint32_t bypassed = 0;
+    };
+
+    enum class LookupResult : uint8_t
+    {
+        kHit,         ///< The encoded report is in the cache.
+        kMiss,        ///< The report is not in the cache; it may be encoded into FreeSpace() and added with Insert().
+        kUncacheable, ///< The report does not fit in the cache, it must be read without it.
+    };
+
+    /**
+     * Enable the cache for a run of the reporting engine.
+     */
+    void Begin();
+
+    /**
+     * Clear and disable the cache at the end of a run of the reporting engine.
+     *
+     * Returns the statistics of the run.
+     */
+    Stats End();
+
+    bool IsActive() const
+    {
+#if CHIP_CONFIG_IM_REPORT_CACHE_SIZE > 0
+        return mActive;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Look up the encoded AttributeReportIBs array of @a key. On a hit, @a encoded is set to it.
+     */
+    LookupResult Find(const Key & key, ByteSpan & encoded);
+
+    /**
+     * Space where the report of a missed key can be encoded before calling Insert().
+     */
+    MutableByteSpan FreeSpace();
+
+    /**
+     * Count a report read from the data model without looking up the cache, e.g. because FreeSpace() is too small.
+     */
+    void Bypass();
+
+    /**
+     * Add the report of @a key, encoded in the first @a encodedLength bytes of FreeSpace().
+     */
+    void Insert(const Key & key, size_t encodedLength);
+
+    /**
+     * Remember that the report of @a key does not fit in the cache, so later lookups skip encoding it again.
+     */
+    void InsertUncacheable(const Key & key);
+
+    /**
+     * Statistics accumulated over all runs.
+     */
+    const Stats & GetStats() const
+    {
+#if CHIP_CONFIG_IM_REPORT_CACHE_SIZE > 0
+        return mStats;
+#else
+        static constexpr Stats kNoStats;
+        return kNoStats;
+#endif
+    }
+
+    static constexpr size_t kMaxEntries = 32;
+
+private:
+    static constexpr size_t kArenaSize = CHIP_CONFIG_IM_REPORT_CACHE_SIZE;
+    static_assert(kArenaSize <= UINT16_MAX, "Cache entries use 16-bit offsets");
+
+    struct Entry
+    {
+        Key key;
+        uint16_t offset;
+        // Zero for an uncacheable report.
+        uint16_t length;
+    };
+
+#if CHIP_CONFIG_IM_REPORT_CACHE_SIZE > 0
+    Entry * AddEntry(const Key & key);
+
+    Entry mEntries[kMaxEntries];
+    size_t mEntryCount = 0;
+    size_t mArenaUsed  = 0;
+    bool mActive       = false;
+    Stats mStats;
+    Stats mRunStats;
+    uint8_t mArena[kArenaSize];
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_SIZE > 0
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,277 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/Generations.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/FibonacciHash.h>
+#include <lib/support/Pool.h>
+
+#include <utility>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * Number of buckets of the index of a DirtyPathSet with at least @a size buckets: the smallest power of two
+ * that is at least @a size.
+ */
+constexpr size_t DirtyPathIndexSize(size_t size)
+{
+    size_t indexSize = 1;
+    while (indexSize < size)
+    {
+        indexSize <<= 1;
+    }
+    return indexSize;
+}
+
+template <size_t N, size_t IndexSize, ObjectPoolMem P>
+class DirtyPathSet;
+
+struct AttributePathParamsWithGeneration : public AttributePathParams
+{
+    AttributePathParamsWithGeneration() = default;
+    AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
+
+    AttributeGeneration mGeneration;
+
+private:
+    template <size_t N, size_t IndexSize, ObjectPoolMem P>
+    friend class DirtyPathSet;
+
+    // Next path in the same bucket of the DirtyPathSet index.
+    AttributePathParamsWithGeneration * mNextInBucket = nullptr;
+};
+
+/**
+ * The set of attribute paths marked dirty for reporting purposes.
+ *
+ * Besides the pool of paths, the set keeps an index of the paths by endpoint and cluster, where a wildcard
+ * endpoint or cluster is part of the key like any other value. A path is a superset of another one only if
+ * its endpoint and cluster are either wildcards or equal to the other path's, so the paths covering a given
+ * path are found by looking up at most four keys instead of walking the whole set.
+ *
+ * The endpoint and cluster of a path in the set must only be changed through UpdatePath(), or followed by a
+ * call to Reindex(), so that the path stays in the right bucket.
+ *
+ * @tparam N          Maximum number of paths in the set, ignored when the pool is heap-allocated.
+ * @tparam IndexSize  Number of buckets of the index, rounded up to a power of two.
+ * @tparam P          Storage of the pool of paths.
+ */
+template <size_t N, size_t IndexSize, ObjectPoolMem P = ObjectPoolMem::kDefault>
+class DirtyPathSet
+{
+public:
+    /**
+     * Add a path with the given generation to the set.
+     *
+     * Returns nullptr if the set is full.
+     */
+    AttributePathParamsWithGeneration * CreatePath(const AttributePathParams & aPath, AttributeGeneration aGeneration);
+
+    void ReleasePath(AttributePathParamsWithGeneration * aPath);
+
+    void ReleaseAll();
+
+    /**
+     * Replace the endpoint, cluster, attribute and list index of a path in the set with those of @a aNewPath.
+     */
+    void UpdatePath(AttributePathParamsWithGeneration * aPath, const AttributePathParams & aNewPath);
+
+    /**
+     * Rebuild the index after the endpoint or cluster of paths in the set changed in place.
+     */
+    void Reindex();
+
+    size_t Allocated() const { return mPaths.Allocated(); }
+    bool Exhausted() const { return mPaths.Exhausted(); }
+
+    /**
+     * Call @a function on every path in the set. The function must not change the endpoint or cluster of the
+     * paths without calling Reindex() afterwards.
+     */
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function)
+    {
+        return mPaths.ForEachActiveObject(std::forward<Function>(function));
+    }
+
+    /**
+     * Call @a function on every path in the set that is a superset of @a aPath, until it returns Loop::Break.
+     *
+     * @a aPath is either an AttributePathParams or a ConcreteAttributePath.
+     */
+    template <typename PathType, typename Function>
+    Loop ForEachPathCovering(const PathType & aPath, Function && function)
+    {
+        // A superset of the path has the same endpoint and cluster as the path, or wildcards in their place.
+        const EndpointId endpoints[] = { aPath.mEndpointId, kInvalidEndpointId };
+        const ClusterId clusters[]   = { aPath.mClusterId, kInvalidClusterId };
+        const size_t endpointCount   = (aPath.mEndpointId == kInvalidEndpointId) ? 1 : 2;
+        const size_t clusterCount    = (aPath.mClusterId == kInvalidClusterId) ? 1 : 2;
+
+        for (size_t e = 0; e < endpointCount; e++)
+        {
+            for (size_t c = 0; c < clusterCount; c++)
+            {
+                for (AttributePathParamsWithGeneration * path = mIndex[Bucket(endpoints[e], clusters[c])]; path != nullptr;)
+                {
+                    // The function may release the path.
+                    AttributePathParamsWithGeneration * next = path->mNextInBucket;
+                    if (path->mEndpointId == endpoints[e] && path->mClusterId == clusters[c] &&
+                        path->IsAttributePathSupersetOf(aPath) && function(path) == Loop::Break)
+                    {
+                        return Loop::Break;
+                    }
+                    path = next;
+                }
+            }
+        }
+        return Loop::Finish;
+    }
+
+    /**
+     * Call @a function on every path in the set that is a subset of @a aPath, until it returns Loop::Break.
+     *
+     * Only a path with a concrete endpoint and cluster is looked up in the index, the whole set is walked
+     * otherwise.
+     */
+    template <typename Function>
+    Loop ForEachPathCoveredBy(const AttributePathParams & aPath, Function && function)
+    {
+        if (aPath.HasWildcardEndpointId() || aPath.HasWildcardClusterId())
+        {
+            return mPaths.ForEachActiveObject([&](AttributePathParamsWithGeneration * path) {
+                return aPath.IsAttributePathSupersetOf(*path) ? function(path) : Loop::Continue;
+            });
+        }
+
+        for (AttributePathParamsWithGeneration * path = mIndex[Bucket(aPath.mEndpointId, aPath.mClusterId)]; path != nullptr;)
+        {
+            AttributePathParamsWithGeneration * next = path->mNextInBucket;
+            if (aPath.IsAttributePathSupersetOf(*path) && function(path) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+            path = next;
+        }
+        return Loop::Finish;
+    }
+
+private:
+    static constexpr size_t kIndexSize = DirtyPathIndexSize(IndexSize);
+
+    static size_t Bucket(EndpointId aEndpointId, ClusterId aClusterId)
+    {
+        return FibonacciHashIndex(FibonacciHashCombine(aClusterId, aEndpointId), kIndexSize);
+    }
+
+    void AddToIndex(AttributePathParamsWithGeneration * aPath);
+    void RemoveFromIndex(AttributePathParamsWithGeneration * aPath);
+
+    ObjectPool<AttributePathParamsWithGeneration, N, P> mPaths;
+
+    // Each bucket is a list of paths linked through AttributePathParamsWithGeneration::mNextInBucket.
+    AttributePathParamsWithGeneration * mIndex[kIndexSize] = {};
+};
+
+template <size_t N, size_t IndexSize, ObjectPoolMem P>
+AttributePathParamsWithGeneration * DirtyPathSet<N, IndexSize, P>::CreatePath(const AttributePathParams & aPath,
+                                                                          AttributeGeneration aGeneration)
+{
+    AttributePathParamsWithGeneration * path = mPaths.CreateObject(aPath);
+    if (path != nullptr)
+    {
+        path->mGeneration = aGeneration;
+        AddToIndex(path);
+    }
+    return path;
+}
+
+template <size_t N, size_t IndexSize, ObjectPoolMem P>
+void DirtyPathSet<N, IndexSize, P>::ReleasePath(AttributePathParamsWithGeneration * aPath)
+{
+    RemoveFromIndex(aPath);
+    mPaths.ReleaseObject(aPath);
+}
+
+template <size_t N, size_t IndexSize, ObjectPoolMem P>
+void DirtyPathSet<N, IndexSize, P>::ReleaseAll()
+{
+    mPaths.ReleaseAll();
+    for (auto & bucket : mIndex)
+    {
+        bucket = nullptr;
+    }
+}
+
+template <size_t N, size_t IndexSize, ObjectPoolMem P>
+void DirtyPathSet<N, IndexSize, P>::UpdatePath(AttributePathParamsWithGeneration * aPath, const AttributePathParams & aNewPath)
+{
+    RemoveFromIndex(aPath);
+    aPath->mEndpointId  = aNewPath.mEndpointId;
+    aPath->mClusterId   = aNewPath.mClusterId;
+    aPath->mAttributeId = aNewPath.mAttributeId;
+    aPath->mListIndex   = aNewPath.mListIndex;
+    AddToIndex(aPath);
+}
+
+template <size_t N, size_t IndexSize, ObjectPoolMem P>
+void DirtyPathSet<N, IndexSize, P>::Reindex()
+{
+    for (auto & bucket : mIndex)
+    {
+        bucket = nullptr;
+    }
+    mPaths.ForEachActiveObject([this](AttributePathParamsWithGeneration * path) {
+        AddToIndex(path);
+        return Loop::Continue;
+    });
+}
+
+template <size_t N, size_t IndexSize, ObjectPoolMem P>
+void DirtyPathSet<N, IndexSize, P>::AddToIndex(AttributePathParamsWithGeneration * aPath)
+{
+    AttributePathParamsWithGeneration *& bucket = mIndex[Bucket(aPath->mEndpointId, aPath->mClusterId)];
+    aPath->mNextInBucket                        = bucket;
+    bucket                                      = aPath;
+}
+
+template <size_t N, size_t IndexSize, ObjectPoolMem P>
+void DirtyPathSet<N, IndexSize, P>::RemoveFromIndex(AttributePathParamsWithGeneration * aPath)
+{
+    AttributePathParamsWithGeneration ** link = &mIndex[Bucket(aPath->mEndpointId, aPath->mClusterId)];
+    while (*link != nullptr)
+    {
+        if (*link == aPath)
+        {
+            *link                = aPath->mNextInBucket;
+            aPath->mNextInBucket = nullptr;
+            return;
+        }
+        link = &(*link)->mNextInBucket;
+    }
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
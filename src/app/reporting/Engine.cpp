@@ -37,6 +37,7 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CodeUtils.h>
 #include <protocols/interaction_model/StatusCode.h>
+#include <tracing/metric_event.h>
 
 #include <optional>
 
@@ -106,9 +107,142 @@ std::optional<Status> ValidateAttributeIsReadable(DataModel::Provider * dataMode
     return std::nullopt;
 }
 
+DataModel::ActionReturnStatus ReadAttribute(DataModel::Provider * dataModel, const DataModel::ReadAttributeRequest & readRequest,
+                                            AttributeValueEncoder & encoder)
+{
+    if (IsSupportedGlobalAttributeNotInMetadata(readRequest.path.mAttributeId))
+    {
+        // Global attributes are NOT directly handled by data model providers, instead
+        // they are routed through metadata.
+        return ReadGlobalAttributeFromMetadata(dataModel, readRequest.path, encoder);
+    }
+    return dataModel->ReadAttribute(readRequest, encoder);
+}
+
+/// Copies the attribute reports of an encoded AttributeReportIBs array into `reportBuilder`.
+CHIP_ERROR CopyEncodedAttributeReports(ByteSpan encoded, AttributeReportIBs::Builder & reportBuilder)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    reader.Init(encoded);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(reportBuilder.GetWriter()->CopyElement(TLV::AnonymousTag(), reader));
+    }
+    return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+}
+
+/// Reads an attribute into the report cache, and copies its report to `reportBuilder`.
+///
+/// The report is encoded in the cache with as much space as is left in `reportBuilder`, so that it runs out of space
+/// exactly when reading it directly would: the attribute is read once either way, and the list items that fit are kept
+/// to be chunked. Errors are not cached, they are returned with `encoderState` updated like for a direct read.
+///
+/// Returns std::nullopt, without reading the attribute, if the cache has less free space than `reportBuilder`.
+std::optional<DataModel::ActionReturnStatus> ReadAttributeIntoCache(DataModel::Provider * dataModel,
+                                                                    const DataModel::ReadAttributeRequest & readRequest,
+                                                                    DataVersion version, const AttributeReportCache::Key & key,
+                                                                    AttributeReportCache & cache,
+                                                                    AttributeReportIBs::Builder & reportBuilder,
+                                                                    AttributeEncodeState * encoderState)
+{
+    const uint32_t reportSpace = reportBuilder.GetWriter()->GetRemainingFreeLength();
+    MutableByteSpan space      = cache.FreeSpace();
+    TLV::TLVWriter writer;
+    AttributeReportIBs::Builder cacheBuilder;
+    writer.Init(space);
+
+    // Anything beyond the space of the report, which includes the end of the array, is reserved. A later report may
+    // have less space, so the attribute is not marked uncacheable when the cache is too small for this one.
+    uint32_t reserved = 0;
+    if (cacheBuilder.Init(&writer) != CHIP_NO_ERROR || writer.GetRemainingFreeLength() <= reportSpace ||
+        writer.ReserveBuffer(reserved = writer.GetRemainingFreeLength() - reportSpace) != CHIP_NO_ERROR)
+    {
+        cache.Bypass();
+        return std::nullopt;
+    }
+
+    AttributeValueEncoder encoder(cacheBuilder, readRequest.subjectDescriptor, readRequest.path, version,
+                                  readRequest.readFlags.Has(ReadFlags::kFabricFiltered), encoderState);
+    DataModel::ActionReturnStatus status = ReadAttribute(dataModel, readRequest, encoder);
+    if (!status.IsSuccess())
+    {
+        if (encoderState != nullptr)
+        {
+            *encoderState = encoder.GetState();
+        }
+        VerifyOrReturnValue(status.IsOutOfSpaceEncodingResponse(), status);
+        cache.InsertUncacheable(key);
+        VerifyOrReturnValue(encoder.GetState().AllowPartialData(), status);
+    }
+
+    TLV::TLVWriter checkpoint;
+    reportBuilder.Checkpoint(checkpoint);
+    CHIP_ERROR err = writer.UnreserveBuffer(reserved);
+    SuccessOrExit(err);
+    SuccessOrExit(err = cacheBuilder.EndOfAttributeReportIBs());
+    SuccessOrExit(err = writer.Finalize());
+    SuccessOrExit(err = CopyEncodedAttributeReports(ByteSpan(space.data(), writer.GetLengthWritten()), reportBuilder));
+    if (status.IsSuccess())
+    {
+        cache.Insert(key, writer.GetLengthWritten());
+    }
+    return status;
+
+exit:
+    // Should not happen, since the report has as much space as the cache had. Nothing is copied then, so that the list
+    // is not resumed past items that were not sent.
+    reportBuilder.Rollback(checkpoint);
+    if (encoderState != nullptr)
+    {
+        encoderState->Reset();
+    }
+    return DataModel::ActionReturnStatus(err);
+}
+
+/// Reads an attribute through the report cache: the encoded report is copied from the cache if another
+/// subscriber already read it in this run, or read into the cache and copied from there otherwise.
+///
+/// Returns std::nullopt if the attribute was not read and nothing was written to `reportBuilder`, in which case
+/// the attribute should be read directly.
+std::optional<DataModel::ActionReturnStatus> ReadAttributeThroughCache(DataModel::Provider * dataModel,
+                                                                       const DataModel::ReadAttributeRequest & readRequest,
+                                                                       DataVersion version, AttributeReportCache & cache,
+                                                                       AttributeReportIBs::Builder & reportBuilder,
+                                                                       AttributeEncodeState * encoderState)
+{
+    const AttributeReportCache::Key key{ readRequest.path, version, readRequest.GetAccessingFabricIndex(), readRequest.readFlags };
+
+    ByteSpan encoded;
+    switch (cache.Find(key, encoded))
+    {
+    case AttributeReportCache::LookupResult::kHit:
+        break;
+    case AttributeReportCache::LookupResult::kUncacheable:
+        return std::nullopt;
+    case AttributeReportCache::LookupResult::kMiss:
+        return ReadAttributeIntoCache(dataModel, readRequest, version, key, cache, reportBuilder, encoderState);
+    }
+
+    TLV::TLVWriter checkpoint;
+    reportBuilder.Checkpoint(checkpoint);
+    if (CopyEncodedAttributeReports(encoded, reportBuilder) != CHIP_NO_ERROR)
+    {
+        // Most likely out of space in this report. Reading the attribute directly lets lists be chunked.
+        reportBuilder.Rollback(checkpoint);
+        return std::nullopt;
+    }
+    return DataModel::ActionReturnStatus(CHIP_NO_ERROR);
+}
+
 DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
                                                   BitFlags<ReadFlags> flags, AttributeReportIBs::Builder & reportBuilder,
-                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
+                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState,
+                                                  AttributeReportCache * cache)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
@@ -135,7 +269,9 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     reportBuilder.Checkpoint(checkpoint);
 
     DataModel::ActionReturnStatus status(CHIP_NO_ERROR);
-    bool isFabricFiltered = flags.Has(ReadFlags::kFabricFiltered);
+    // Whether the attribute was read through the cache, which then updated the encoder state itself.
+    bool encoderStateUpdated = false;
+    bool isFabricFiltered    = flags.Has(ReadFlags::kFabricFiltered);
     AttributeValueEncoder attributeValueEncoder(reportBuilder, subjectDescriptor, path, version, isFabricFiltered, encoderState);
 
     // TODO: we explicitly DO NOT validate that path is a valid cluster path (even more, above serverClusterFinder
@@ -168,15 +304,16 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     {
         status = *required_privilege_status;
     }
-    else if (IsSupportedGlobalAttributeNotInMetadata(readRequest.path.mAttributeId))
-    {
-        // Global attributes are NOT directly handled by data model providers, instead
-        // they are routed through metadata.
-        status = ReadGlobalAttributeFromMetadata(dataModel, readRequest.path, attributeValueEncoder);
-    }
     else
     {
-        status = dataModel->ReadAttribute(readRequest, attributeValueEncoder);
+        // The cache only holds complete reports, so it cannot be used to resume a chunked list.
+        std::optional<DataModel::ActionReturnStatus> cachedStatus;
+        if (cache != nullptr && (encoderState == nullptr || encoderState->CurrentEncodingListIndex() == kInvalidListIndex))
+        {
+            cachedStatus = ReadAttributeThroughCache(dataModel, readRequest, version, *cache, reportBuilder, encoderState);
+        }
+        encoderStateUpdated = cachedStatus.has_value();
+        status = cachedStatus.has_value() ? *cachedStatus : ReadAttribute(dataModel, readRequest, attributeValueEncoder);
     }
 
     if (status.IsSuccess())
@@ -195,16 +332,16 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     //
     // Generally only out of space encoding errors would be retryable, however we save the state
     // for all errors in case this is information that is useful (retry or error position).
-    if (encoderState != nullptr)
+    if (encoderState != nullptr && !encoderStateUpdated)
     {
         *encoderState = attributeValueEncoder.GetState();
     }
 
 #if CHIP_CONFIG_DATA_MODEL_EXTRA_LOGGING
     // Out of space errors may be chunked data, reporting those cases would be very confusing
-    // as they are not fully errors. Report only others (which presumably are not recoverable
-    // and will be sent to the client as well).
-    if (!status.IsOutOfSpaceEncodingResponse())
+    // as they are not fully errors. Neither are pending values. Report only others (which presumably
+    // are not recoverable and will be sent to the client as well).
+    if (!status.IsOutOfSpaceEncodingResponse() && !status.IsPendingResponse())
     {
         DataModel::ActionReturnStatus::StringStorage storage;
         ChipLogError(DataManagement, "Failed to read attribute: %s", status.c_str(storage));
@@ -320,6 +457,7 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+    mMetadataSnapshot.Clear();
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -351,11 +489,12 @@ static bool IsOutOfWriterSpaceError(CHIP_ERROR err)
 
 CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
                                                            ReadHandler * apReadHandler, bool * apHasMoreChunks,
-                                                           bool * apHasEncodedData)
+                                                           bool * apHasEncodedData, bool * apHasPendingValue)
 {
     CHIP_ERROR err            = CHIP_NO_ERROR;
     bool attributeDataWritten = false;
     bool hasMoreChunks        = true;
+    bool hasPendingValue      = false;
     TLV::TLVWriter backup;
     const uint32_t kReservedSizeEndOfReportIBs = 1;
     bool reservedEndOfReportIBs                = false;
@@ -396,23 +535,20 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
 
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
-                                                          apReadHandler->AttributeIterationPosition());
+                                                          apReadHandler->AttributeIterationPosition(), &mMetadataSnapshot);
              iterator.Next(readPath); iterator.MarkCompleted())
         {
             if (!apReadHandler->IsPriming())
             {
                 bool concretePathDirty = false;
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
+                mGlobalDirtySet.ForEachPathCovering(readPath, [&](auto * dirtyPath) {
+                    // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                    // started a report that it completed: those paths already got reported.
+                    if (dirtyPath->mGeneration.After(apReadHandler->mPreviousReportsBeginGeneration))
                     {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration.After(apReadHandler->mPreviousReportsBeginGeneration))
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
+                        concretePathDirty = true;
+                        return Loop::Break;
                     }
                     return Loop::Continue;
                 });
@@ -451,7 +587,25 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             flags.Set(ReadFlags::kAllowsLargePayload, apReadHandler->AllowsLargePayload());
             DataModel::ActionReturnStatus status =
                 RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
-                                    attributeReportIBs, pathForRetrieval, &encodeState);
+                                    attributeReportIBs, pathForRetrieval, &encodeState,
+                                    mReportCache.IsActive() ? &mReportCache : nullptr);
+            if (status.IsPendingResponse())
+            {
+                // The value is not available yet: end this chunk before the attribute, like when it does not fit, and
+                // retry it in the next one. Once the read timed out, a Timeout status is reported for it instead.
+                apReadHandler->OnAttributeValuePending(pathForRetrieval);
+                if (!apReadHandler->HasAttributeValueTimedOut(pathForRetrieval))
+                {
+                    ChipLogDetail(DataManagement,
+                                  "Attribute value is pending, end the chunk before clusterId: " ChipLogFormatMEI
+                                  ", attributeId: " ChipLogFormatMEI,
+                                  ChipLogValueMEI(pathForRetrieval.mClusterId), ChipLogValueMEI(pathForRetrieval.mAttributeId));
+                    attributeReportIBs.Rollback(attributeBackup);
+                    hasPendingValue = true;
+                    ExitNow(err = CHIP_ERROR_IN_PROGRESS);
+                }
+                status = Status::Timeout;
+            }
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -511,6 +665,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             SuccessOrExit(err);
             // Successfully encoded the attribute, clear the internal state.
             apReadHandler->SetAttributeEncodeState(AttributeEncodeState());
+            apReadHandler->ClearPendingAttributeValue(pathForRetrieval);
         }
 
         // We just visited all paths interested by this read handler and did not abort in the middle of iteration, there are no more
@@ -529,15 +684,19 @@ exit:
     {
         *apHasEncodedData = attributeDataWritten;
     }
+    if (apHasPendingValue != nullptr)
+    {
+        *apHasPendingValue = hasPendingValue;
+    }
     //
     // Running out of space is an error that we're expected to handle - the incompletely written DataIB has already been rolled back
-    // earlier to ensure only whole and complete DataIBs are present in the stream.
+    // earlier to ensure only whole and complete DataIBs are present in the stream. So is a pending attribute value.
     //
     // We can safely clear out the error so that the rest of the machinery to close out the reports, etc. will function correctly.
     // These are are guaranteed to not fail since we've already reserved memory for the remaining 'close out' TLV operations in this
     // function and its callers.
     //
-    if (IsOutOfWriterSpaceError(err) && reservedEndOfReportIBs)
+    if ((IsOutOfWriterSpaceError(err) || hasPendingValue) && reservedEndOfReportIBs)
     {
         ChipLogDetail(DataManagement, "<RE:Run> We cannot put more chunks into this report. Enable chunking.");
         err = CHIP_NO_ERROR;
@@ -799,9 +958,10 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
         bool hasMoreChunksForEvents     = false;
         bool hasEncodedAttributes       = false;
         bool hasEncodedEvents           = false;
+        bool hasPendingAttributeValue   = false;
 
         err = BuildSingleReportDataAttributeReportIBs(reportDataBuilder, apReadHandler, &hasMoreChunksForAttributes,
-                                                      &hasEncodedAttributes);
+                                                      &hasEncodedAttributes, &hasPendingAttributeValue);
         SuccessOrExit(err);
         SuccessOrExit(err = reportDataWriter.UnreserveBuffer(kReservedSizeForEventReportIBs));
         err = BuildSingleReportDataEventReports(reportDataBuilder, apReadHandler, hasEncodedAttributes, &hasMoreChunksForEvents,
@@ -810,6 +970,13 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 
         hasMoreChunks = hasMoreChunksForAttributes || hasMoreChunksForEvents;
 
+        if (!hasEncodedAttributes && !hasEncodedEvents && hasPendingAttributeValue)
+        {
+            // Nothing to send until the value is available: keep the report where it is and serve other handlers meanwhile.
+            apReadHandler->AwaitAttributeValue();
+            ExitNow();
+        }
+
         if (!hasEncodedAttributes && !hasEncodedEvents && hasMoreChunks)
         {
             ChipLogError(DataManagement,
@@ -908,6 +1075,13 @@ void Engine::Run()
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
+
+    // Attributes reported to several subscribers in this run are only read and encoded once.
+    if (initialAllocated > 1)
+    {
+        mReportCache.Begin();
+    }
+
     while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
     {
         ReadHandler * readHandler =
@@ -922,6 +1096,7 @@ void Engine::Run()
             mRunningReadHandler = nullptr;
             if (err != CHIP_NO_ERROR)
             {
+                EndReportCache();
                 return;
             }
         }
@@ -933,6 +1108,8 @@ void Engine::Run()
         mCurReadHandlerIdx++;
     }
 
+    EndReportCache();
+
     //
     // If our tracker has exceeded the bounds of the handler list, reset it back to 0.
     // This isn't strictly necessary, but does make it easier to debug issues in this code if they
@@ -963,28 +1140,37 @@ void Engine::Run()
     }
 }
 
+void Engine::EndReportCache()
+{
+    VerifyOrReturn(mReportCache.IsActive());
+
+    AttributeReportCache::Stats stats = mReportCache.End();
+    if (stats.hits + stats.misses + stats.bypassed > 0)
+    {
+        MATTER_LOG_METRIC(Tracing::kMetricReportCacheHits, stats.hits);
+        MATTER_LOG_METRIC(Tracing::kMetricReportCacheMisses, stats.misses);
+        MATTER_LOG_METRIC(Tracing::kMetricReportCacheBypassed, stats.bypassed);
+    }
+}
+
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
+    if (mGlobalDirtySet.ForEachPathCovering(aAttributePath, [&](auto * path) {
             path->mGeneration = GetDirtySetGeneration();
             return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
+        }) == Loop::Break)
+    {
+        return true;
+    }
+
+    return Loop::Break == mGlobalDirtySet.ForEachPathCoveredBy(aAttributePath, [&](auto * path) {
+        // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
+        // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
+        // want.
+        // It is better to eliminate the duplicate wildcard paths in follow-up
+        path->mGeneration = GetDirtySetGeneration();
+        mGlobalDirtySet.UpdatePath(path, aAttributePath);
+        return Loop::Break;
     });
 }
 
@@ -994,7 +1180,7 @@ bool Engine::ClearTombPaths()
     mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
         if (path->mGeneration.IsZero())
         {
-            mGlobalDirtySet.ReleaseObject(path);
+            mGlobalDirtySet.ReleasePath(path);
             pathReleased = true;
         }
         return Loop::Continue;
@@ -1067,6 +1253,9 @@ bool Engine::MergeDirtyPathsUnderSameEndpoint()
         });
         return Loop::Continue;
     });
+
+    // Merged paths moved to a wildcard cluster in place.
+    mGlobalDirtySet.Reindex();
     return ClearTombPaths();
 }
 
@@ -1078,22 +1267,18 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
     {
         ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
         mGlobalDirtySet.ReleaseAll();
-        auto object         = mGlobalDirtySet.CreateObject();
-        object->mGeneration = GetDirtySetGeneration();
+        mGlobalDirtySet.CreatePath(AttributePathParams(), GetDirtySetGeneration());
     }
 
     VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
     ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
 
-    auto object = mGlobalDirtySet.CreateObject();
-    if (object == nullptr)
+    if (mGlobalDirtySet.CreatePath(aAttributePath, GetDirtySetGeneration()) == nullptr)
     {
         // This should not happen, this path should be merged into the wildcard endpoint at least.
         ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
         return CHIP_ERROR_NO_MEMORY;
     }
-    *object             = aAttributePath;
-    object->mGeneration = GetDirtySetGeneration();
 
     return CHIP_NO_ERROR;
 }
@@ -1256,6 +1441,9 @@ void Engine::ScheduleUrgentEventDeliverySync(Optional<FabricIndex> fabricIndex)
 
 void Engine::OnAttributeChanged(const ConcreteAttributePath & path, DataModel::AttributeChangeType type)
 {
+    // Providers notify pending values as changes, reportable or not.
+    ResumePendingReads({ path.mEndpointId, path.mClusterId, path.mAttributeId });
+
     VerifyOrReturn(type == DataModel::AttributeChangeType::kReportable);
 
     CHIP_ERROR err = SetDirty({ path.mEndpointId, path.mClusterId, path.mAttributeId });
@@ -1265,8 +1453,19 @@ void Engine::OnAttributeChanged(const ConcreteAttributePath & path, DataModel::A
     }
 }
 
+void Engine::ResumePendingReads(const AttributePathParams & aPath)
+{
+    mpImEngine->mReadHandlers.ForEachActiveObject([&aPath](ReadHandler * handler) {
+        handler->OnAttributeValueAvailable(aPath);
+        return Loop::Continue;
+    });
+}
+
 void Engine::OnEndpointChanged(EndpointId endpointId, DataModel::EndpointChangeType type)
 {
+    // Values pending on a removed endpoint will not come, the retried reads fail right away.
+    ResumePendingReads(AttributePathParams(endpointId));
+
     CHIP_ERROR err = SetDirty(AttributePathParams(endpointId));
     if (err != CHIP_NO_ERROR)
     {
@@ -29,6 +29,9 @@
 #include <app/EventReporter.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
+#include <app/reporting/AttributeReportCache.h>
+#include <app/reporting/DirtyPathSet.h>
 #include <app/reporting/Generations.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
@@ -131,11 +134,21 @@ public:
     size_t GetGlobalDirtySetSize() { return mGlobalDirtySet.Allocated(); }
 #endif
 
+    /**
+     * Statistics of the cache of encoded attribute reports shared by the ReadHandlers served in a run.
+     */
+    const AttributeReportCache::Stats & GetReportCacheStats() const { return mReportCache.GetStats(); }
+
     // DataModel::AttributeChangeListener implementation
     void OnAttributeChanged(const ConcreteAttributePath & path, DataModel::AttributeChangeType type) override;
     void OnEndpointChanged(EndpointId endpointId, DataModel::EndpointChangeType type) override;
 
 private:
+    /**
+     * Resumes the ReadHandlers waiting for the value of an attribute of aPath.
+     */
+    void ResumePendingReads(const AttributePathParams & aPath);
+
     /**
      * Main work-horse function that executes the run-loop.
      */
@@ -146,14 +159,6 @@ private:
 
     bool IsRunScheduled() const { return mRunScheduled; }
 
-    struct AttributePathParamsWithGeneration : public AttributePathParams
-    {
-        AttributePathParamsWithGeneration() = default;
-        AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
-
-        AttributeGeneration mGeneration;
-    };
-
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -161,7 +166,7 @@ private:
     CHIP_ERROR BuildAndSendSingleReportData(ReadHandler * apReadHandler);
 
     CHIP_ERROR BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
-                                                       bool * apHasMoreChunks, bool * apHasEncodedData);
+                                                       bool * apHasMoreChunks, bool * apHasEncodedData, bool * apHasPendingValue);
     CHIP_ERROR BuildSingleReportDataEventReports(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
                                                  bool aBufferIsUsed, bool * apHasMoreChunks, bool * apHasEncodedData);
 
@@ -219,6 +224,11 @@ private:
      */
     bool MergeDirtyPathsUnderSameCluster();
 
+    /**
+     * Clear the report cache at the end of a run and log its statistics.
+     */
+    void EndReportCache();
+
     /**
      * If we are running out of ObjectPool for the global dirty set and we cannot find a slot after merging the existing items by
      * clusters, we will try to merge the existing items by endpoints.
@@ -264,16 +274,27 @@ private:
     ReadHandler * mRunningReadHandler = nullptr;
 
     /**
-     *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
+     *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes, indexed by
+     *  endpoint and cluster.
      *
      */
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     // For unit tests, always use inline allocation for code coverage.
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
+    DirtyPathSet<CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, CHIP_IM_SERVER_DIRTY_SET_INDEX_SIZE, ObjectPoolMem::kInline> mGlobalDirtySet;
 #else
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
+    DirtyPathSet<CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, CHIP_IM_SERVER_DIRTY_SET_INDEX_SIZE> mGlobalDirtySet;
 #endif
 
+    /**
+     * Encoded attribute reports shared by the ReadHandlers served in the current run.
+     */
+    AttributeReportCache mReportCache;
+
+    /**
+     * Data model composition used to expand the attribute paths of all ReadHandlers, across runs.
+     */
+    DataModel::MetadataSnapshot mMetadataSnapshot;
+
     /**
      * A generation counter for the dirty attrbute set.
      * ReadHandlers can save the generation value when generating reports.
@@ -87,6 +87,9 @@ public:
      *  This flag is used to confirm that the next report timer has fired for a ReadHandler, thus allowing reporting when timers
      *  fire earlier than the minimal timestamp due to mechanisms such as NTP clock adjustments.
      *
+     *  ReportPending: Mechanism to measure how long a report waits to be sent once it is due. This flag is set, along with the
+     *  reportable timestamp, when the ReadHandler first becomes reportable after a report.
+     *
      */
     class ReadHandlerNode : public TimerContext
     {
@@ -98,6 +101,8 @@ public:
             EngineRunScheduled = (1 << 0),
             // Flag to allow the read handler to be synced with other handlers that have an earlier max timestamp
             CanBeSynced = (1 << 1),
+            // Flag to indicate that the read handler became reportable since its last report, at the reportable timestamp
+            ReportPending = (1 << 2),
         };
 
         ReadHandlerNode(ReadHandler * aReadHandler, ReportScheduler * aScheduler, const Timestamp & now) : mScheduler(aScheduler)
@@ -152,11 +157,42 @@ public:
             mScheduler->ReportTimerCallback();
         }
 
-        Timestamp GetMinTimestamp() const { return std::max(mMinTimestamp, mDeferralEndTimestamp); }
+        Timestamp GetMinTimestamp() const { return std::max({ mMinTimestamp, mDeferralEndTimestamp, mPacingEndTimestamp }); }
         Timestamp GetMaxTimestamp() const { return mMaxTimestamp; }
 
         Timestamp GetDeferralEndTimestamp() const { return mDeferralEndTimestamp; }
         void SetDeferralEndTimestamp(const Timestamp & deferralEndTimestamp) { mDeferralEndTimestamp = deferralEndTimestamp; }
+
+        /// @brief Timestamp before which the scheduler holds back the report to pace the reports of all the nodes, or 0 if the
+        /// report is not paced. It is never later than the max timestamp.
+        Timestamp GetPacingEndTimestamp() const { return mPacingEndTimestamp; }
+        void SetPacingEndTimestamp(const Timestamp & pacingEndTimestamp) { mPacingEndTimestamp = pacingEndTimestamp; }
+
+        bool IsReportPending() const { return mFlags.Has(ReadHandlerNodeFlags::ReportPending); }
+
+        /// @brief Record that the read handler is reportable, unless it already was since its last report
+        /// @param now current time, the user must ensure to provide a valid time for this to be reliable
+        void SetReportPending(const Timestamp & now)
+        {
+            VerifyOrReturn(!IsReportPending());
+            mFlags.Set(ReadHandlerNodeFlags::ReportPending);
+            mReportableTimestamp = now;
+        }
+
+        /// @brief Get the timestamp at which the reporting intervals and deferrals allowed the next report to be sent, not
+        /// accounting for pacing. This is the max timestamp unless the read handler became reportable earlier.
+        Timestamp GetReportDueTimestamp() const
+        {
+            VerifyOrReturnValue(IsReportPending(), mMaxTimestamp);
+            return std::min(std::max({ mReportableTimestamp, mMinTimestamp, mDeferralEndTimestamp }), mMaxTimestamp);
+        }
+
+        /// @brief Reset the pacing and pending report state once a report was sent
+        void ClearReportState()
+        {
+            mFlags.Clear(ReadHandlerNodeFlags::ReportPending);
+            mPacingEndTimestamp = Timestamp(0);
+        }
         bool PathListsContainAnyEndpoint(Span<const EndpointId> targetedEndpoints) const
         {
             return mReadHandler->PathListsContainAnyEndpoint(targetedEndpoints);
@@ -168,6 +204,8 @@ public:
         Timestamp mMinTimestamp;
         Timestamp mMaxTimestamp;
         Timestamp mDeferralEndTimestamp = Timestamp(0);
+        Timestamp mPacingEndTimestamp   = Timestamp(0);
+        Timestamp mReportableTimestamp  = Timestamp(0);
 
         BitFlags<ReadHandlerNodeFlags> mFlags;
     };
@@ -117,6 +117,11 @@ void ReportSchedulerImpl::OnBecameReportable(ReadHandler * aReadHandler)
 
     Timestamp now = mTimerDelegate->GetCurrentMonotonicTimestamp();
 
+    if (IsReadHandlerReportable(aReadHandler))
+    {
+        node->SetReportPending(now);
+    }
+
     Milliseconds32 newTimeout;
     TEMPORARY_RETURN_IGNORED CalculateNextReportTimeout(newTimeout, node, now);
     TEMPORARY_RETURN_IGNORED ScheduleReport(newTimeout, node, now);
@@ -129,6 +134,13 @@ void ReportSchedulerImpl::OnSubscriptionReportSent(ReadHandler * aReadHandler)
 
     Timestamp now = mTimerDelegate->GetCurrentMonotonicTimestamp();
 
+    // Reports sent before they were due (e.g. synchronized with other handlers) are not late.
+    Milliseconds32 latency = std::chrono::duration_cast<Milliseconds32>(now - std::min(now, node->GetReportDueTimestamp()));
+    mLatencyStats.reportCount++;
+    mLatencyStats.maxLatency = std::max(mLatencyStats.maxLatency, latency);
+    mLatencyStats.totalLatency += latency;
+    node->ClearReportState();
+
     // This method is called after the report is sent, so the ReadHandler is no longer reportable, and thus CanBeSynced and
     // EngineRunScheduled of the node associated with the ReadHandler are set to false here.
     node->SetCanBeSynced(false);
@@ -194,8 +206,8 @@ CHIP_ERROR ReportSchedulerImpl::CalculateNextReportTimeout(Timeout & timeout, Re
     // If the handler is reportable now, just schedule a report immediately
     if (aNode->IsReportableNow(now))
     {
-        // If the handler is reportable now, just schedule a report immediately
-        timeout = Milliseconds32(0);
+        // If the handler is reportable now, just schedule a report immediately, unless the engine is saturated
+        timeout = CalculatePacingDelay(aNode, now);
     }
     else if (IsReadHandlerReportable(aNode->GetReadHandler()) && (aNode->GetMinTimestamp() > now))
     {
@@ -211,6 +223,32 @@ CHIP_ERROR ReportSchedulerImpl::CalculateNextReportTimeout(Timeout & timeout, Re
     return CHIP_NO_ERROR;
 }
 
+Timeout ReportSchedulerImpl::CalculatePacingDelay(ReadHandlerNode * aNode, const Timestamp & now)
+{
+    VerifyOrReturnValue(mPacingInterval != Milliseconds32(0), Milliseconds32(0));
+    // Nodes whose timer already fired, or which were already paced, report as soon as the engine allows it.
+    VerifyOrReturnValue(!aNode->IsEngineRunScheduled() && aNode->GetPacingEndTimestamp() == kZero, Milliseconds32(0));
+
+    uint32_t load = InteractionModelEngine::GetInstance()->GetReportingEngine().GetNumReportsInFlight();
+    mNodesPool.ForEachActiveObject([aNode, now, &load](ReadHandlerNode * node) {
+        if (node != aNode && node->IsReportableNow(now))
+        {
+            load++;
+        }
+        return Loop::Continue;
+    });
+    VerifyOrReturnValue(load >= CHIP_IM_MAX_REPORTS_IN_FLIGHT, Milliseconds32(0));
+    VerifyOrReturnValue(aNode->GetMaxTimestamp() > now, Milliseconds32(0));
+
+    Timestamp pacingEnd = std::min(std::max(now, mLastPacingEndTimestamp) + mPacingInterval, aNode->GetMaxTimestamp());
+    aNode->SetPacingEndTimestamp(pacingEnd);
+    mLastPacingEndTimestamp = std::max(mLastPacingEndTimestamp, pacingEnd);
+
+    ChipLogDetail(DataManagement, "Pacing report of ReadHandler %p for %" PRIu32 " ms", aNode->GetReadHandler(),
+                  static_cast<uint32_t>(std::chrono::duration_cast<Milliseconds32>(pacingEnd - now).count()));
+    return std::chrono::duration_cast<Milliseconds32>(pacingEnd - now);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -54,14 +54,35 @@ namespace reporting {
  *  ReadHandler is reportable, the timeout is the difference between the next min interval and now. If that min interval is in the
  *  past, the scheduler directly calls the TimerFired() method instead of starting a timer.
  *
+ * ## Report Pacing
  *
-
+ * When a pacing interval is set (see CHIP_IM_REPORT_PACING_INTERVAL_MS), the scheduler also accounts for the load of the
+ * reporting engine, so that many subscriptions becoming reportable together do not all report in one burst and then stall on
+ * CHIP_IM_MAX_REPORTS_IN_FLIGHT:
+ *
+ * - A node that becomes reportable while the reports in flight and the nodes already reportable add up to
+ *   CHIP_IM_MAX_REPORTS_IN_FLIGHT gets a pacing end timestamp, one pacing interval after the one given to the previously paced
+ *   node, and only reports from then on. Paced nodes thus report in the order they became reportable, one per pacing interval.
+ *
+ * - The pacing end timestamp is never later than the max timestamp of the node, and a node is paced at most once per report.
+ *
+ * The scheduler keeps statistics on the delay between the moment a report was due, per the intervals of its ReadHandler, and
+ * the moment it was sent (see GetSchedulingLatencyStats()).
  */
 class ReportSchedulerImpl : public ReportScheduler
 {
 public:
     using Timeout = System::Clock::Timeout;
 
+    struct SchedulingLatencyStats
+    {
+        // Number of subscription reports sent
+        uint32_t reportCount = 0;
+        // Longest and total delay between the moment a report was due and the moment it was sent
+        System::Clock::Milliseconds32 maxLatency   = System::Clock::kZero;
+        System::Clock::Milliseconds64 totalLatency = System::Clock::kZero;
+    };
+
     ReportSchedulerImpl(TimerDelegate * aTimerDelegate);
     ~ReportSchedulerImpl() override { UnregisterAllHandlers(); }
 
@@ -147,6 +168,15 @@ public:
 
     void ReportTimerCallback() override;
 
+    /**
+     * @brief Set the interval at which reports are released once the reporting engine is saturated. An interval of 0 disables
+     *        pacing. Reports already paced keep their pacing end timestamp.
+     */
+    void SetPacingInterval(System::Clock::Milliseconds32 aPacingInterval) { mPacingInterval = aPacingInterval; }
+
+    const SchedulingLatencyStats & GetSchedulingLatencyStats() const { return mLatencyStats; }
+    void ResetSchedulingLatencyStats() { mLatencyStats = SchedulingLatencyStats(); }
+
 protected:
     /**
      * @brief Schedule a report for the ReadHandler associated with a ReadHandlerNode.
@@ -177,6 +207,21 @@ private:
      *
      */
     virtual CHIP_ERROR CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aNode, const Timestamp & now);
+
+    /**
+     * @brief Hold back the report of a node that is reportable now if the reporting engine is saturated.
+     *
+     * @param[in] aNode The node associated to the ReadHandler, which must be reportable now.
+     * @param[in] now The current system timestamp.
+     *
+     * @return The time to wait before reporting, 0 if the report does not need to be paced.
+     */
+    Timeout CalculatePacingDelay(ReadHandlerNode * aNode, const Timestamp & now);
+
+    System::Clock::Milliseconds32 mPacingInterval = System::Clock::Milliseconds32(CHIP_IM_REPORT_PACING_INTERVAL_MS);
+    // Pacing end timestamp given to the last paced node
+    Timestamp mLastPacingEndTimestamp = System::Clock::kZero;
+    SchedulingLatencyStats mLatencyStats;
 };
 
 } // namespace reporting
@@ -69,6 +69,7 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
 
     entry.next     = mRegistrations;
     mRegistrations = &entry;
+    mGeneration++;
 
     return CHIP_NO_ERROR;
 }
@@ -98,6 +99,7 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
             {
                 mCachedInterface = nullptr;
             }
+            mGeneration++;
 
             current->next = nullptr; // Make sure current does not look like part of a list.
             if (mContext.has_value())
@@ -217,6 +217,10 @@ public:
 
     ServerClusterInstances AllServerClusterInstances();
 
+    /// A counter incremented every time a cluster is registered or unregistered, so that
+    /// callers can tell whether the set of registered clusters changed.
+    uint32_t GetGeneration() const { return mGeneration; }
+
 protected:
     ServerClusterRegistration * mRegistrations = nullptr;
 
@@ -226,6 +230,8 @@ protected:
 
     // Managing context for this registry
     std::optional<ServerClusterContext> mContext;
+
+    uint32_t mGeneration = 0;
 };
 
 } // namespace app
@@ -73,6 +73,7 @@ void SingleEndpointServerClusterRegistry::UnregisterAllFromEndpoint(EndpointId e
                 prev->next = current->next;
             }
             ServerClusterRegistration * actual_next = current->next;
+            mGeneration++;
 
             current->next = nullptr; // Make sure current does not look like part of a list.
             if (mContext.has_value())
@@ -38,6 +38,7 @@
 #include <lib/dnssd/Advertiser.h>
 #include <lib/dnssd/ServiceNaming.h>
 #include <lib/support/AutoRelease.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/PersistedCounter.h>
@@ -221,11 +222,43 @@ Server Server::sServer;
 
 #if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 #define CHIP_NUM_EVENT_LOGGING_BUFFERS 3
+#if CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS
 static uint8_t sInfoEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE];
 static uint8_t sDebugEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE];
 static uint8_t sCritEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE];
+#else
+// The Debug, Info and Critical event buffers, one after the other, allocated only if the application does not
+// provide its own.
+static uint8_t * sEventBuffers = nullptr;
+#endif // CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS
 static PersistedCounter<EventNumber> sGlobalEventIdCounter;
 static app::CircularEventBuffer sLoggingBuffer[CHIP_NUM_EVENT_LOGGING_BUFFERS];
+
+// The event log storage used when ServerInitParams::eventLogStorageResources is not provided.
+static CHIP_ERROR GetDefaultEventLogStorage(app::LogStorageResources (&resources)[CHIP_NUM_EVENT_LOGGING_BUFFERS])
+{
+#if CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS
+    uint8_t * debugBuffer = sDebugEventBuffer;
+    uint8_t * infoBuffer  = sInfoEventBuffer;
+    uint8_t * critBuffer  = sCritEventBuffer;
+#else
+    if (sEventBuffers == nullptr)
+    {
+        sEventBuffers = static_cast<uint8_t *>(Platform::MemoryAlloc(CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE +
+                                                                     CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE +
+                                                                     CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE));
+        VerifyOrReturnError(sEventBuffers != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+    uint8_t * debugBuffer = sEventBuffers;
+    uint8_t * infoBuffer  = debugBuffer + CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE;
+    uint8_t * critBuffer  = infoBuffer + CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE;
+#endif // CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS
+
+    resources[0] = { debugBuffer, CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE, app::PriorityLevel::Debug };
+    resources[1] = { infoBuffer, CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE, app::PriorityLevel::Info };
+    resources[2] = { critBuffer, CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE, app::PriorityLevel::Critical };
+    return CHIP_NO_ERROR;
+}
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
 CHIP_ERROR Server::Init(const ServerInitParams & initParams)
@@ -496,18 +529,28 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     SuccessOrExit(err);
 
     {
-        app::LogStorageResources logStorageResources[] = {
-            { &sDebugEventBuffer[0], sizeof(sDebugEventBuffer), app::PriorityLevel::Debug },
-            { &sInfoEventBuffer[0], sizeof(sInfoEventBuffer), app::PriorityLevel::Info },
-            { &sCritEventBuffer[0], sizeof(sCritEventBuffer), app::PriorityLevel::Critical }
-        };
+        VerifyOrExit(initParams.eventStorageDelegate == nullptr || initParams.eventLogStorageResources != nullptr,
+                     err = CHIP_ERROR_INVALID_ARGUMENT);
+        app::LogStorageResources logStorageResources[CHIP_NUM_EVENT_LOGGING_BUFFERS];
+        const app::LogStorageResources * eventLogStorageResources = initParams.eventLogStorageResources;
+        if (eventLogStorageResources == nullptr)
+        {
+            SuccessOrExit(err = GetDefaultEventLogStorage(logStorageResources));
+            eventLogStorageResources = &logStorageResources[0];
+        }
 
         err = app::EventManagement::GetInstance().Init(&mExchangeMgr, CHIP_NUM_EVENT_LOGGING_BUFFERS, &sLoggingBuffer[0],
-                                                       &logStorageResources[0], &sGlobalEventIdCounter,
+                                                       eventLogStorageResources, &sGlobalEventIdCounter,
                                                        std::chrono::duration_cast<System::Clock::Milliseconds64>(mInitTimestamp),
                                                        &app::InteractionModelEngine::GetInstance()->GetReportingEngine());
 
         SuccessOrExit(err);
+
+        if (initParams.eventStorageDelegate != nullptr)
+        {
+            err = app::EventManagement::GetInstance().RestoreEvents(*initParams.eventStorageDelegate);
+            SuccessOrExit(err);
+        }
     }
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
@@ -587,6 +630,8 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
         },
         .clientPool            = &mCASEClientPool,
         .sessionSetupPool      = &mSessionSetupPool,
+        // Outgoing session setups beyond the CASE client pool wait in the admission queue.
+        .maxConcurrentSessionSetups = CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS,
     };
 
     err = mCASESessionManager.Init(&DeviceLayer::SystemLayer(), caseSessionManagerConfig);
@@ -890,6 +935,14 @@ void Server::Shutdown()
     PlatformMgr().RemoveEventHandler(OnPlatformEventWrapper, reinterpret_cast<intptr_t>(this));
     mCASEServer.Shutdown();
     mCASESessionManager.Shutdown();
+    if (mSessionResumptionStorage != nullptr)
+    {
+        CHIP_ERROR err = mSessionResumptionStorage->Flush();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(AppServer, "Failed to flush session resumption storage: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     app::DnssdServer::Instance().SetICDManager(nullptr);
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -919,6 +972,10 @@ void Server::Shutdown()
     // Reset it here (after IME shutdown, which may trigger cluster shutdowns
     // that access EventManagement) so a subsequent Server::Init() can re-initialize it.
     app::EventManagement::DestroyEventManagement();
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT && !CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS
+    Platform::MemoryFree(sEventBuffers);
+    sEventBuffers = nullptr;
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT && !CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS
 
     // Shut down any remaining sessions (and hence exchanges) before we do any
     // futher teardown.  CASE handshakes have been shut down already via
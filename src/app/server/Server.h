@@ -27,6 +27,7 @@
 #include <app/CASEClientPool.h>
 #include <app/CASESessionManager.h>
 #include <app/DefaultSafeAttributePersistenceProvider.h>
+#include <app/EventManagement.h>
 #include <app/FailSafeContext.h>
 #include <app/OperationalSessionSetupPool.h>
 #include <app/SimpleSubscriptionResumptionStorage.h>
@@ -231,6 +232,16 @@ struct ServerInitParams
     // for ember/zap-generated models.
     chip::app::DataModel::Provider * dataModelProvider = nullptr;
 
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    // Event log storage: Optional. When provided, events are logged in these buffers, one per
+    // priority level from Debug to Critical, instead of the server's own ones (see
+    // CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS). Must outlive the Server.
+    const app::LogStorageResources * eventLogStorageResources = nullptr;
+    // Event log persistence: Optional. Restores the events logged before a restart when provided, in
+    // which case eventLogStorageResources must also be provided, with content preserved across restarts.
+    app::EventStorageDelegate * eventStorageDelegate = nullptr;
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+
     bool advertiseCommissionableIfNoFabrics = CHIP_DEVICE_CONFIG_ENABLE_PAIRING_AUTOSTART;
 };
 
@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/AttributeReportCache.h>
+#include <lib/support/Span.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <cstring>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+using Key = AttributeReportCache::Key;
+
+constexpr uint8_t kReport[] = { 0x16, 0x15, 0x24, 0x00, 0x01, 0x18, 0x18 };
+
+Key MakeKey(AttributeId attribute, DataVersion version = 1, FabricIndex fabric = 1)
+{
+    return Key{ ConcreteAttributePath(1, 6, attribute), version, fabric,
+                BitFlags<DataModel::ReadFlags>(DataModel::ReadFlags::kFabricFiltered) };
+}
+
+// Encode kReport into the free space of the cache, as the reporting engine does on a miss.
+void InsertReport(AttributeReportCache & cache, const Key & key)
+{
+    MutableByteSpan space = cache.FreeSpace();
+    ASSERT_GE(space.size(), sizeof(kReport));
+    memcpy(space.data(), kReport, sizeof(kReport));
+    cache.Insert(key, sizeof(kReport));
+}
+
+class TestAttributeReportCache : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        if (CHIP_CONFIG_IM_REPORT_CACHE_SIZE < sizeof(kReport) * AttributeReportCache::kMaxEntries)
+        {
+            GTEST_SKIP() << "Skipping test: report cache too small";
+        }
+    }
+};
+
+TEST_F(TestAttributeReportCache, TestHitAndMiss)
+{
+    AttributeReportCache cache;
+    ByteSpan encoded;
+
+    EXPECT_FALSE(cache.IsActive());
+    cache.Begin();
+    EXPECT_TRUE(cache.IsActive());
+
+    EXPECT_EQ(cache.Find(MakeKey(0), encoded), AttributeReportCache::LookupResult::kMiss);
+    InsertReport(cache, MakeKey(0));
+
+    EXPECT_EQ(cache.Find(MakeKey(0), encoded), AttributeReportCache::LookupResult::kHit);
+    EXPECT_TRUE(encoded.data_equal(ByteSpan(kReport)));
+
+    // Any difference in the key is a different report.
+    EXPECT_EQ(cache.Find(MakeKey(1), encoded), AttributeReportCache::LookupResult::kMiss);
+    EXPECT_EQ(cache.Find(MakeKey(0, 2), encoded), AttributeReportCache::LookupResult::kMiss);
+    EXPECT_EQ(cache.Find(MakeKey(0, 1, 2), encoded), AttributeReportCache::LookupResult::kMiss);
+    Key unfiltered       = MakeKey(0);
+    unfiltered.readFlags = BitFlags<DataModel::ReadFlags>();
+    EXPECT_EQ(cache.Find(unfiltered, encoded), AttributeReportCache::LookupResult::kMiss);
+
+    AttributeReportCache::Stats stats = cache.End();
+    EXPECT_FALSE(cache.IsActive());
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.bypassed, 0u);
+
+    // Nothing survives the end of a run.
+    cache.Begin();
+    EXPECT_EQ(cache.Find(MakeKey(0), encoded), AttributeReportCache::LookupResult::kMiss);
+    stats = cache.End();
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.misses, 0u);
+
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+}
+
+TEST_F(TestAttributeReportCache, TestUncacheable)
+{
+    AttributeReportCache cache;
+    ByteSpan encoded;
+
+    cache.Begin();
+    EXPECT_EQ(cache.Find(MakeKey(0), encoded), AttributeReportCache::LookupResult::kMiss);
+    cache.InsertUncacheable(MakeKey(0));
+    EXPECT_EQ(cache.Find(MakeKey(0), encoded), AttributeReportCache::LookupResult::kUncacheable);
+
+    // Fill the entry table: further reports are not cached.
+    for (AttributeId attribute = 1; attribute < AttributeReportCache::kMaxEntries; attribute++)
+    {
+        EXPECT_EQ(cache.Find(MakeKey(attribute), encoded), AttributeReportCache::LookupResult::kMiss);
+        InsertReport(cache, MakeKey(attribute));
+    }
+    EXPECT_EQ(cache.Find(MakeKey(AttributeReportCache::kMaxEntries), encoded),
+              AttributeReportCache::LookupResult::kUncacheable);
+    EXPECT_EQ(cache.Find(MakeKey(1), encoded), AttributeReportCache::LookupResult::kHit);
+    EXPECT_TRUE(encoded.data_equal(ByteSpan(kReport)));
+
+    AttributeReportCache::Stats stats = cache.End();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, AttributeReportCache::kMaxEntries - 1);
+    EXPECT_EQ(stats.bypassed, 3u);
+}
+
+} // namespace
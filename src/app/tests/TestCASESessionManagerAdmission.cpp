@@ -0,0 +1,338 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the admission queue of CASESessionManager.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/CASEClientPool.h>
+#include <app/CASESessionManager.h>
+#include <app/OperationalSessionSetupPool.h>
+#include <app/tests/AppTestContext.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/Resolver.h>
+#include <system/RAIIMockClock.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint16_t kMaxConcurrentSetups = 2;
+
+// Accepts every operational lookup and never answers, so that the session setups stay in progress.
+class PendingResolver : public Dnssd::Resolver
+{
+public:
+    CHIP_ERROR Init(Inet::EndPointManager<Inet::UDPEndPoint> *) override { return CHIP_NO_ERROR; }
+    bool IsInitialized() override { return true; }
+    void Shutdown() override {}
+    void SetOperationalDelegate(Dnssd::OperationalResolveDelegate *) override {}
+    CHIP_ERROR ResolveNodeId(const PeerId &) override { return CHIP_NO_ERROR; }
+    void NodeIdResolutionNoLongerNeeded(const PeerId &) override {}
+    CHIP_ERROR StartDiscovery(Dnssd::DiscoveryType, Dnssd::DiscoveryFilter, Dnssd::DiscoveryContext &) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR StopDiscovery(Dnssd::DiscoveryContext &) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR ReconfirmRecord(const char *, Inet::IPAddress, Inet::InterfaceId) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+};
+
+struct ConnectionCounter
+{
+    ConnectionCounter() : mOnConnected(OnConnected, this), mOnFailure(OnFailure, this) {}
+
+    static void OnConnected(void * context, Messaging::ExchangeManager &, const SessionHandle &)
+    {
+        static_cast<ConnectionCounter *>(context)->mConnectedCount++;
+    }
+
+    static void OnFailure(void * context, const ScopedNodeId &, CHIP_ERROR error)
+    {
+        auto * self = static_cast<ConnectionCounter *>(context);
+        self->mFailureCount++;
+        self->mLastError = error;
+    }
+
+    Callback::Callback<OnDeviceConnected> mOnConnected;
+    Callback::Callback<OnDeviceConnectionFailure> mOnFailure;
+    int mConnectedCount   = 0;
+    int mFailureCount     = 0;
+    CHIP_ERROR mLastError = CHIP_NO_ERROR;
+};
+
+class TestCASESessionManagerAdmission : public chip::Testing::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        mPreviousResolver = &Dnssd::Resolver::Instance();
+        Dnssd::Resolver::SetInstance(mResolver);
+
+        CASESessionManagerConfig config = {
+            .sessionInitParams =
+                {
+                    .sessionManager    = &GetSecureSessionManager(),
+                    .exchangeMgr       = &GetExchangeManager(),
+                    .fabricTable       = &GetFabricTable(),
+                    .groupDataProvider = &mGroupDataProvider,
+                },
+            .clientPool                 = &mClientPool,
+            .sessionSetupPool           = &mSessionSetupPool,
+            .maxConcurrentSessionSetups = kMaxConcurrentSetups,
+        };
+        Configure(config);
+        ASSERT_EQ(mManager.Init(&GetSystemLayer(), config), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        mManager.ReleaseAllSessions();
+        mManager.Shutdown();
+        Dnssd::Resolver::SetInstance(*mPreviousResolver);
+        AppContext::TearDown();
+    }
+
+protected:
+    virtual void Configure(CASESessionManagerConfig & config) {}
+
+    // Peers on Alice's fabric, without a session.
+    ScopedNodeId Peer(NodeId nodeId) { return ScopedNodeId(0x1000 + nodeId, GetAliceFabricIndex()); }
+
+    void Request(NodeId nodeId, ConnectionCounter & counter, SessionSetupPriority priority)
+    {
+        mManager.FindOrEstablishSession(Peer(nodeId), &counter.mOnConnected, &counter.mOnFailure,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                        1, nullptr,
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                        TransportPayloadCapability::kMRPPayload, NullOptional, priority);
+    }
+
+    bool IsSettingUp(NodeId nodeId) { return mSessionSetupPool.FindSessionSetup(Peer(nodeId), false) != nullptr; }
+
+    PendingResolver mResolver;
+    Dnssd::Resolver * mPreviousResolver = nullptr;
+    Credentials::GroupDataProviderImpl mGroupDataProvider;
+    CASEClientPool<4> mClientPool;
+    OperationalSessionSetupPool<4> mSessionSetupPool;
+    CASESessionManager mManager;
+};
+
+TEST_F(TestCASESessionManagerAdmission, TestQueueByPriorityAndPeer)
+{
+    ConnectionCounter first, second, background, high, backgroundAgain;
+
+    Request(1, first, SessionSetupPriority::kNormal);
+    Request(2, second, SessionSetupPriority::kNormal);
+    Request(3, background, SessionSetupPriority::kBackground);
+    Request(4, high, SessionSetupPriority::kHigh);
+    // A second request for a waiting peer shares its place in the queue.
+    Request(3, backgroundAgain, SessionSetupPriority::kBackground);
+
+    EXPECT_TRUE(IsSettingUp(1));
+    EXPECT_TRUE(IsSettingUp(2));
+    EXPECT_FALSE(IsSettingUp(3));
+    EXPECT_FALSE(IsSettingUp(4));
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().inFlight, 2u);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 2u);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().peakQueueDepth, 2u);
+
+    // Completing a setup admits the waiting peer with the highest priority, from the event loop.
+    mManager.ReleaseSession(Peer(1));
+    EXPECT_EQ(first.mFailureCount, 1);
+    EXPECT_EQ(first.mLastError, CHIP_ERROR_CANCELLED);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().completedSetups, 1u);
+    EXPECT_FALSE(IsSettingUp(4));
+
+    DrainAndServiceIO();
+    EXPECT_TRUE(IsSettingUp(4));
+    EXPECT_FALSE(IsSettingUp(3));
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().inFlight, 2u);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 1u);
+
+    mManager.ReleaseSession(Peer(2));
+    DrainAndServiceIO();
+    EXPECT_TRUE(IsSettingUp(3));
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 0u);
+
+    // Both requests for the shared peer are notified.
+    mManager.ReleaseSession(Peer(3));
+    EXPECT_EQ(background.mFailureCount, 1);
+    EXPECT_EQ(backgroundAgain.mFailureCount, 1);
+    EXPECT_EQ(high.mFailureCount, 0);
+    EXPECT_EQ(second.mFailureCount, 1);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().completedSetups, 3u);
+}
+
+TEST_F(TestCASESessionManagerAdmission, TestCancelWaitingRequests)
+{
+    ConnectionCounter counters[4];
+
+    for (NodeId nodeId = 0; nodeId < 4; nodeId++)
+    {
+        Request(nodeId, counters[nodeId], SessionSetupPriority::kNormal);
+    }
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 2u);
+
+    // A request canceled by its owner while it waits does not start a setup.
+    counters[2].mOnConnected.Cancel();
+    mManager.ReleaseSession(Peer(0));
+    DrainAndServiceIO();
+    EXPECT_FALSE(IsSettingUp(2));
+    EXPECT_TRUE(IsSettingUp(3));
+    EXPECT_EQ(counters[2].mFailureCount, 0);
+
+    mManager.ReleaseAllSessions();
+    for (auto & counter : counters)
+    {
+        EXPECT_EQ(counter.mConnectedCount, 0);
+    }
+    EXPECT_EQ(counters[1].mFailureCount, 1);
+    EXPECT_EQ(counters[3].mFailureCount, 1);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().inFlight, 0u);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 0u);
+}
+
+TEST_F(TestCASESessionManagerAdmission, TestQueueRequestWithoutFailureCallback)
+{
+    ConnectionCounter counters[3];
+
+    Request(0, counters[0], SessionSetupPriority::kNormal);
+    Request(1, counters[1], SessionSetupPriority::kNormal);
+    mManager.FindOrEstablishSession(Peer(2), &counters[2].mOnConnected, nullptr);
+    EXPECT_FALSE(IsSettingUp(2));
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 1u);
+
+    mManager.ReleaseSession(Peer(0));
+    DrainAndServiceIO();
+    EXPECT_TRUE(IsSettingUp(2));
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 0u);
+}
+
+class TestCASESessionManagerAdmissionQueueLimit : public TestCASESessionManagerAdmission
+{
+protected:
+    void Configure(CASESessionManagerConfig & config) override { config.maxPendingSessionSetups = 1; }
+};
+
+TEST_F(TestCASESessionManagerAdmissionQueueLimit, TestQueueFull)
+{
+    ConnectionCounter counters[4];
+
+    for (NodeId nodeId = 0; nodeId < 4; nodeId++)
+    {
+        Request(nodeId, counters[nodeId], SessionSetupPriority::kNormal);
+    }
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 1u);
+    EXPECT_EQ(counters[2].mFailureCount, 0);
+    EXPECT_EQ(counters[3].mFailureCount, 1);
+    EXPECT_EQ(counters[3].mLastError, CHIP_ERROR_NO_MEMORY);
+
+    // Another request for the waiting peer joins its entry.
+    ConnectionCounter again;
+    Request(2, again, SessionSetupPriority::kNormal);
+    EXPECT_EQ(again.mFailureCount, 0);
+}
+
+constexpr System::Clock::Milliseconds32 kAdmissionInterval(100);
+constexpr System::Clock::Milliseconds32 kAdmissionJitter(50);
+constexpr System::Clock::Milliseconds32 kClockStep(10);
+
+class TestCASESessionManagerAdmissionPacing : public TestCASESessionManagerAdmission
+{
+protected:
+    void Configure(CASESessionManagerConfig & config) override
+    {
+        config.maxConcurrentSessionSetups    = 4;
+        config.sessionSetupAdmissionInterval = kAdmissionInterval;
+        config.sessionSetupAdmissionJitter   = kAdmissionJitter;
+    }
+
+    // Advances the clock by steps until the setup for nodeId starts, and returns the time it took.
+    System::Clock::Milliseconds32 WaitForSetup(NodeId nodeId)
+    {
+        System::Clock::Milliseconds32 elapsed(0);
+        while (!IsSettingUp(nodeId) && elapsed < kAdmissionInterval + kAdmissionJitter + kClockStep)
+        {
+            mMockClock.AdvanceMonotonic(kClockStep);
+            elapsed += kClockStep;
+            DrainAndServiceIO();
+        }
+        return elapsed;
+    }
+
+    System::Clock::Internal::RAIIMockClock mMockClock;
+};
+
+TEST_F(TestCASESessionManagerAdmissionPacing, TestIntervalAndJitter)
+{
+    ConnectionCounter counters[3];
+
+    // The first request starts right away, the next ones are spaced out.
+    for (NodeId nodeId = 0; nodeId < 3; nodeId++)
+    {
+        Request(nodeId, counters[nodeId], SessionSetupPriority::kNormal);
+    }
+    EXPECT_TRUE(IsSettingUp(0));
+    EXPECT_FALSE(IsSettingUp(1));
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 2u);
+
+    for (NodeId nodeId = 1; nodeId < 3; nodeId++)
+    {
+        System::Clock::Milliseconds32 elapsed = WaitForSetup(nodeId);
+        EXPECT_TRUE(IsSettingUp(nodeId));
+        EXPECT_GE(elapsed, kAdmissionInterval);
+        EXPECT_LT(elapsed, kAdmissionInterval + kAdmissionJitter + kClockStep);
+        EXPECT_FALSE(IsSettingUp(nodeId + 1));
+    }
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().inFlight, 3u);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().queueDepth, 0u);
+
+    // Once the interval has elapsed, a new request starts right away.
+    mMockClock.AdvanceMonotonic(kAdmissionInterval + kAdmissionJitter);
+    ConnectionCounter late;
+    Request(3, late, SessionSetupPriority::kNormal);
+    EXPECT_TRUE(IsSettingUp(3));
+}
+
+class TestCASESessionManagerAdmissionUnbounded : public TestCASESessionManagerAdmission
+{
+protected:
+    void Configure(CASESessionManagerConfig & config) override { config.maxConcurrentSessionSetups = 0; }
+};
+
+TEST_F(TestCASESessionManagerAdmissionUnbounded, TestNoAdmissionQueue)
+{
+    ConnectionCounter counters[3];
+
+    // As before the admission queue, every request starts its session setup right away.
+    for (NodeId nodeId = 0; nodeId < 3; nodeId++)
+    {
+        Request(nodeId, counters[nodeId], SessionSetupPriority::kBackground);
+        EXPECT_TRUE(IsSettingUp(nodeId));
+    }
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().inFlight, 0u);
+    EXPECT_EQ(mManager.GetSessionSetupAdmissionStats().peakQueueDepth, 0u);
+}
+
+} // namespace
@@ -830,4 +830,166 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+class NoopCacheCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+template <typename AttributeInfo>
+void ReportAttribute(ReadClient::Callback & callback, EndpointId endpoint, const typename AttributeInfo::Type & value)
+{
+    uint8_t buffer[128];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    EXPECT_EQ(DataModel::Encode(writer, TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+    EXPECT_SUCCESS(writer.Finalize());
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    EXPECT_SUCCESS(reader.Next());
+
+    ConcreteDataAttributePath path(endpoint, AttributeInfo::GetClusterId(), AttributeInfo::GetAttributeId());
+    path.mDataVersion.SetValue(1);
+    callback.OnAttributeData(path, &reader, StatusIB());
+}
+
+/*
+ * The attributes of a cluster share their storage in the cache, so updating, clearing or replacing one of
+ * them with a status must leave the others intact, across reports.
+ */
+TEST_F(TestClusterStateCache, TestUpdatesAcrossReports)
+{
+    using namespace Clusters::UnitTesting::Attributes;
+
+    NoopCacheCallback callback;
+    ClusterStateCache cache(callback);
+    ReadClient::Callback & reportCallback = cache.GetBufferedCallback();
+
+    const uint8_t shortString[] = { 'h', 'i' };
+    const uint8_t longString[]  = { 'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd' };
+    StructAttr::TypeInfo::Type structValue;
+    structValue.a = 7;
+    structValue.b = true;
+
+    const ConcreteAttributePath int16uPath(1, Clusters::UnitTesting::Id, Int16u::Id);
+    const ConcreteAttributePath octetStringPath(1, Clusters::UnitTesting::Id, OctetString::Id);
+    const ConcreteAttributePath structPath(1, Clusters::UnitTesting::Id, StructAttr::Id);
+
+    auto expectStruct = [&]() {
+        StructAttr::TypeInfo::DecodableType value;
+        EXPECT_SUCCESS(cache.Get<StructAttr::TypeInfo>(structPath, value));
+        EXPECT_EQ(value.a, 7);
+        EXPECT_TRUE(value.b);
+    };
+    auto expectOctetString = [&](ByteSpan expected) {
+        OctetString::TypeInfo::DecodableType value;
+        EXPECT_SUCCESS(cache.Get<OctetString::TypeInfo>(octetStringPath, value));
+        EXPECT_TRUE(value.data_equal(expected));
+    };
+
+    reportCallback.OnReportBegin();
+    ReportAttribute<Int16u::TypeInfo>(reportCallback, 1, 1);
+    ReportAttribute<OctetString::TypeInfo>(reportCallback, 1, ByteSpan(shortString));
+    ReportAttribute<StructAttr::TypeInfo>(reportCallback, 1, structValue);
+    reportCallback.OnReportEnd();
+
+    // The integer keeps its size, the string grows.
+    reportCallback.OnReportBegin();
+    ReportAttribute<OctetString::TypeInfo>(reportCallback, 1, ByteSpan(longString));
+    ReportAttribute<Int16u::TypeInfo>(reportCallback, 1, 2);
+    reportCallback.OnReportEnd();
+
+    Int16u::TypeInfo::DecodableType int16uValue = 0;
+    EXPECT_SUCCESS(cache.Get<Int16u::TypeInfo>(int16uPath, int16uValue));
+    EXPECT_EQ(int16uValue, 2);
+    expectOctetString(ByteSpan(longString));
+    expectStruct();
+
+    reportCallback.OnReportBegin();
+    reportCallback.OnAttributeData(ConcreteDataAttributePath(octetStringPath), nullptr,
+                                   StatusIB(Protocols::InteractionModel::Status::UnsupportedRead));
+    reportCallback.OnReportEnd();
+
+    OctetString::TypeInfo::DecodableType octetStringValue;
+    EXPECT_EQ(cache.Get<OctetString::TypeInfo>(octetStringPath, octetStringValue), CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+    StatusIB status;
+    EXPECT_SUCCESS(cache.GetStatus(octetStringPath, status));
+    EXPECT_EQ(status.mStatus, Protocols::InteractionModel::Status::UnsupportedRead);
+    EXPECT_SUCCESS(cache.Get<Int16u::TypeInfo>(int16uPath, int16uValue));
+    EXPECT_EQ(int16uValue, 2);
+    expectStruct();
+
+    cache.ClearAttribute(int16uPath);
+    EXPECT_EQ(cache.Get<Int16u::TypeInfo>(int16uPath, int16uValue), CHIP_ERROR_KEY_NOT_FOUND);
+    expectStruct();
+
+    reportCallback.OnReportBegin();
+    ReportAttribute<OctetString::TypeInfo>(reportCallback, 1, ByteSpan(shortString));
+    reportCallback.OnReportEnd();
+
+    expectOctetString(ByteSpan(shortString));
+    expectStruct();
+
+    size_t attributeCount = 0;
+    EXPECT_SUCCESS(cache.ForEachAttribute(1, Clusters::UnitTesting::Id, [&](const ConcreteAttributePath & path) {
+        attributeCount++;
+        return CHIP_NO_ERROR;
+    }));
+    EXPECT_EQ(attributeCount, 2u);
+
+    // Endpoints that are not in the cache have no clusters.
+    size_t clusterCount = 0;
+    EXPECT_SUCCESS(cache.ForEachCluster(2, [&](ClusterId cluster) {
+        clusterCount++;
+        return CHIP_NO_ERROR;
+    }));
+    EXPECT_EQ(clusterCount, 0u);
+}
+
+/*
+ * Values backed by the cache stay valid until their own path is updated, however much the other attributes of
+ * the cluster, and the rest of the cache, change in the meantime.
+ */
+TEST_F(TestClusterStateCache, TestGetBufferLifetime)
+{
+    using namespace Clusters::UnitTesting::Attributes;
+
+    NoopCacheCallback callback;
+    ClusterStateCache cache(callback);
+    ReadClient::Callback & reportCallback = cache.GetBufferedCallback();
+
+    const uint8_t octetString[] = { 's', 't', 'a', 'b', 'l', 'e' };
+    const ConcreteAttributePath octetStringPath(1, Clusters::UnitTesting::Id, OctetString::Id);
+
+    reportCallback.OnReportBegin();
+    ReportAttribute<OctetString::TypeInfo>(reportCallback, 1, ByteSpan(octetString));
+    ReportAttribute<CharString::TypeInfo>(reportCallback, 1, ""_span);
+    reportCallback.OnReportEnd();
+
+    OctetString::TypeInfo::DecodableType value;
+    EXPECT_SUCCESS(cache.Get<OctetString::TypeInfo>(octetStringPath, value));
+    EXPECT_TRUE(value.data_equal(ByteSpan(octetString)));
+
+    // Grow another attribute of the same cluster well past a data block, and add clusters and endpoints around it.
+    char charString[64];
+    memset(charString, 'x', sizeof(charString));
+    for (size_t i = 0; i < 100; i++)
+    {
+        reportCallback.OnReportBegin();
+        ReportAttribute<CharString::TypeInfo>(reportCallback, 1, CharSpan(charString, i % sizeof(charString)));
+        ReportAttribute<Int16u::TypeInfo>(reportCallback, 1, static_cast<uint16_t>(i));
+        ReportAttribute<Clusters::BasicInformation::Attributes::NodeLabel::TypeInfo>(
+            reportCallback, static_cast<EndpointId>(i % 10), CharSpan(charString, i % 32));
+        reportCallback.OnReportEnd();
+
+        EXPECT_TRUE(value.data_equal(ByteSpan(octetString)));
+    }
+
+    EXPECT_TRUE(value.data_equal(ByteSpan(octetString)));
+
+    OctetString::TypeInfo::DecodableType cachedValue;
+    EXPECT_SUCCESS(cache.Get<OctetString::TypeInfo>(octetStringPath, cachedValue));
+    EXPECT_EQ(cachedValue.data(), value.data());
+}
+
 } // namespace
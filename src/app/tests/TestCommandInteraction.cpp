@@ -23,6 +23,7 @@
  */
 
 #include <cinttypes>
+#include <functional>
 #include <optional>
 
 #include <pw_unit_test/framework.h>
@@ -66,6 +67,36 @@ void CheckForInvalidAction(chip::Testing::MessageCapturer & messageLog)
     EXPECT_EQ(status, CHIP_IM_GLOBAL_STATUS(InvalidAction));
 }
 
+void CheckStatusResponse(chip::Testing::MessageCapturer & messageLog, size_t index, CHIP_ERROR expectedStatus)
+{
+    EXPECT_TRUE(messageLog.IsMessageType(index, chip::Protocols::InteractionModel::MsgType::StatusResponse));
+    CHIP_ERROR status;
+    EXPECT_EQ(chip::app::StatusResponse::ProcessStatusResponse(std::move(messageLog.MessagePayload(index)), status), CHIP_NO_ERROR);
+    EXPECT_EQ(status, expectedStatus);
+}
+
+void CheckInvokeResponseMessage(const chip::System::PacketBufferHandle & message, size_t expectedResponseCount,
+                                bool expectedMoreChunkedMessages)
+{
+    chip::System::PacketBufferTLVReader reader;
+    reader.Init(message.Retain());
+    chip::app::InvokeResponseMessage::Parser invokeResponseMessage;
+    ASSERT_EQ(invokeResponseMessage.Init(reader), CHIP_NO_ERROR);
+
+    bool moreChunkedMessages = false;
+    CHIP_ERROR err           = invokeResponseMessage.GetMoreChunkedMessages(&moreChunkedMessages);
+    EXPECT_TRUE(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+    EXPECT_EQ(moreChunkedMessages, expectedMoreChunkedMessages);
+
+    chip::app::InvokeResponseIBs::Parser invokeResponses;
+    ASSERT_EQ(invokeResponseMessage.GetInvokeResponses(&invokeResponses), CHIP_NO_ERROR);
+    chip::TLV::TLVReader invokeResponsesReader;
+    invokeResponses.GetReader(&invokeResponsesReader);
+    size_t responseCount = 0;
+    EXPECT_EQ(chip::TLV::Utilities::Count(invokeResponsesReader, responseCount, false /* recurse */), CHIP_NO_ERROR);
+    EXPECT_EQ(responseCount, expectedResponseCount);
+}
+
 } // anonymous namespace
 
 namespace chip {
@@ -76,6 +107,8 @@ size_t commandDispatchedCount = 0;
 
 bool sendResponse = true;
 bool asyncCommand = false;
+// If set, the async command does not respond when dispatched: the test responds through asyncCommandHandle.
+bool asyncCommandRespondsLater = false;
 
 constexpr EndpointId kTestEndpointId                      = 1;
 constexpr ClusterId kTestClusterId                        = 3;
@@ -291,13 +324,16 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aRequestCommandPat
 
     EXPECT_EQ(aReader.ExitContainer(outerContainerType), CHIP_NO_ERROR);
 
+    bool respond = sendResponse;
     if (asyncCommand)
     {
-        asyncCommandHandle = apCommandObj;
-        asyncCommand       = false;
+        asyncCommandHandle        = apCommandObj;
+        asyncCommand              = false;
+        respond                   = respond && !asyncCommandRespondsLater;
+        asyncCommandRespondsLater = false;
     }
 
-    if (sendResponse)
+    if (respond)
     {
         if (aRequestCommandPath.mCommandId == kTestCommandIdNoData || aRequestCommandPath.mCommandId == kTestCommandIdWithData)
         {
@@ -391,6 +427,37 @@ public:
     CHIP_ERROR mError           = CHIP_NO_ERROR;
 } mockCommandSenderExtendedDelegate;
 
+// Calls mOnFirstResponse, if set, when the first response of a batched request is received, that is before the
+// requester acknowledges the InvokeResponseMessage holding it.
+class BatchedCommandSenderCallback : public MockCommandSenderExtendableCallback
+{
+public:
+    void OnResponse(CommandSender * apCommandSender, const CommandSender::ResponseData & aResponseData) override
+    {
+        MockCommandSenderExtendableCallback::OnResponse(apCommandSender, aResponseData);
+        if (onResponseCalledTimes == 1)
+        {
+            mFirstResponseCommandId = aResponseData.path.mCommandId;
+            if (mOnFirstResponse)
+            {
+                mOnFirstResponse();
+            }
+        }
+    }
+
+    std::function<void()> mOnFirstResponse;
+    CommandId mFirstResponseCommandId = kInvalidCommandId;
+};
+
+// Responds to the command left pending by DispatchSingleClusterCommand when asyncCommandRespondsLater was set.
+void CompleteAsyncCommand()
+{
+    ASSERT_NE(asyncCommandHandle.Get(), nullptr);
+    asyncCommandHandle.Get()->AddStatus(ConcreteCommandPath(kTestEndpointId, kTestClusterId, kTestCommandIdWithData),
+                                        Protocols::InteractionModel::Status::Success);
+    asyncCommandHandle = nullptr;
+}
+
 class MockCommandResponder : public CommandHandlerExchangeInterface
 {
 public:
@@ -403,11 +470,13 @@ public:
 
     void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override { mChunks.AddToEnd(std::move(aPacket)); }
     void ResponseDropped() override { mResponseDropped = true; }
+    void OnPartialInvokeResponsesAvailable() override { mPartialResponsesAvailableCount++; }
 
     size_t GetCommandResponseMaxBufferSize() override { return kMaxSecureSduLengthBytes; }
 
     System::PacketBufferHandle mChunks;
-    bool mResponseDropped = false;
+    bool mResponseDropped               = false;
+    int mPartialResponsesAvailableCount = 0;
 };
 
 class MockCommandHandlerCallback : public CommandHandlerImpl::Callback
@@ -539,6 +608,10 @@ public:
     void TestCommandHandler_RejectsMultipleCommandsWithIdenticalCommandRef();
     void TestCommandHandler_RejectMultipleCommandsWhenHandlerOnlySupportsOne();
     void TestCommandHandler_AcceptMultipleCommands();
+    void TestCommandHandler_FlushResponsesWhileBatchedCommandIsAsync();
+    void TestCommandResponseSender_SendsBatchedResponsesAsCommandsComplete();
+    void TestCommandResponseSender_CommandsCompleteWhileAwaitingStatusResponse();
+    void TestCommandResponseSender_ClosesOnceBatchedCommandsComplete();
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsStatusResponse();
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsDataResponsePrimative();
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsDataResponse();
@@ -568,6 +641,63 @@ public:
         using app::CommandHandler::AddResponse;
     };
 
+    /**
+     * Serves the invoke requests of a test with a CommandResponseSender whose CommandHandlerImpl accepts batched
+     * requests, which the ones of the InteractionModelEngine do not when CHIP_CONFIG_MAX_PATHS_PER_INVOKE is 1.
+     */
+    class BatchedCommandResponder : public Messaging::UnsolicitedMessageHandler,
+                                    public Messaging::ExchangeDelegate,
+                                    public CommandResponseSender::Callback
+    {
+    public:
+        BatchedCommandResponder(Messaging::ExchangeManager & aExchangeManager) : mExchangeManager(aExchangeManager)
+        {
+            mResponseSender = Platform::New<CommandResponseSender>(this, InteractionModelEngine::GetInstance());
+            mResponseSender->mCommandHandler.mCommandPathRegistry = &mCommandPathRegistry;
+            mResponseSender->mCommandHandler.mMaxPathsPerInvoke   = mCommandPathRegistry.MaxSize();
+            EXPECT_SUCCESS(mExchangeManager.RegisterUnsolicitedMessageHandlerForType(
+                Protocols::InteractionModel::MsgType::InvokeCommandRequest, this));
+        }
+
+        ~BatchedCommandResponder() override
+        {
+            Platform::Delete(mResponseSender);
+            EXPECT_SUCCESS(mExchangeManager.UnregisterUnsolicitedMessageHandlerForType(
+                Protocols::InteractionModel::MsgType::InvokeCommandRequest));
+        }
+
+        CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader,
+                                                Messaging::ExchangeDelegate *& newDelegate) override
+        {
+            newDelegate = this;
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                     System::PacketBufferHandle && payload) override
+        {
+            mResponseSender->OnInvokeCommandRequest(ec, std::move(payload), /* isTimedInvoke = */ false);
+            return CHIP_NO_ERROR;
+        }
+
+        void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
+
+        // Like the InteractionModelEngine, release the CommandResponseSender as soon as it is done.
+        void OnDone(CommandResponseSender & apResponderObj) override
+        {
+            Platform::Delete(mResponseSender);
+            mResponseSender = nullptr;
+        }
+
+        bool IsDone() const { return mResponseSender == nullptr; }
+
+        CommandResponseSender * mResponseSender = nullptr;
+
+    private:
+        Messaging::ExchangeManager & mExchangeManager;
+        BasicCommandPathRegistry<4> mCommandPathRegistry;
+    };
+
     // Generate an invoke request.  If aCommandId is kTestCommandIdWithData, a
     // payload will be included.  Otherwise no payload will be included.
     static void GenerateInvokeRequest(System::PacketBufferHandle & aPayload, bool aSuppressResponse, bool aIsTimedRequest,
@@ -580,6 +710,8 @@ public:
                                        std::optional<uint16_t> aCommandRef = std::nullopt);
     static void AddInvokeRequestData(CommandSender * apCommandSender, CommandId aCommandId = kTestCommandIdWithData);
     static void AddInvalidInvokeRequestData(CommandSender * apCommandSender, CommandId aCommandId = kTestCommandIdWithData);
+    // Adds a kTestCommandIdWithData command with CommandRef 0 and a kTestCommandIdNoData one with CommandRef 1.
+    static void AddBatchedInvokeRequestData(CommandSender * apCommandSender);
     static void AddInvokeResponseData(CommandHandler * apCommandHandler, bool aNeedStatusCode,
                                       CommandId aResponseCommandId = kTestCommandIdWithData,
                                       CommandId aRequestCommandId  = kTestCommandIdWithData);
@@ -743,6 +875,33 @@ void TestCommandInteraction::AddInvalidInvokeRequestData(CommandSender * apComma
     apCommandSender->MoveToState(CommandSender::State::AddedCommand);
 }
 
+void TestCommandInteraction::AddBatchedInvokeRequestData(CommandSender * apCommandSender)
+{
+    app::CommandSender::ConfigParameters configParameters;
+    configParameters.SetRemoteMaxPathsPerInvoke(2);
+    EXPECT_EQ(CHIP_NO_ERROR, apCommandSender->SetCommandSenderConfig(configParameters));
+
+    CommandPathParams requestCommandPaths[] = {
+        MakeTestCommandPath(kTestCommandIdWithData),
+        MakeTestCommandPath(kTestCommandIdNoData),
+    };
+    for (uint16_t i = 0; i < 2; i++)
+    {
+        app::CommandSender::PrepareCommandParameters prepareCommandParams;
+        prepareCommandParams.SetStartDataStruct(true);
+        prepareCommandParams.SetCommandRef(i);
+        EXPECT_EQ(CHIP_NO_ERROR, apCommandSender->PrepareCommand(requestCommandPaths[i], prepareCommandParams));
+        if (requestCommandPaths[i].mCommandId == kTestCommandIdWithData)
+        {
+            EXPECT_EQ(CHIP_NO_ERROR, apCommandSender->GetCommandDataIBTLVWriter()->PutBoolean(chip::TLV::ContextTag(1), true));
+        }
+        app::CommandSender::FinishCommandParameters finishCommandParams;
+        finishCommandParams.SetEndDataStruct(true);
+        finishCommandParams.SetCommandRef(i);
+        EXPECT_EQ(CHIP_NO_ERROR, apCommandSender->FinishCommand(finishCommandParams));
+    }
+}
+
 void TestCommandInteraction::AddInvokeResponseData(CommandHandler * apCommandHandler, bool aNeedStatusCode,
                                                    CommandId aResponseCommandId, CommandId aRequestCommandId)
 {
@@ -2096,6 +2255,181 @@ TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_AcceptMultipleCom
     EXPECT_EQ(commandDispatchedCount, 2u);
 }
 
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_FlushResponsesWhileBatchedCommandIsAsync)
+{
+    mockCommandSenderExtendedDelegate.ResetCounter();
+    PendingResponseTrackerImpl pendingResponseTracker;
+    app::CommandSender commandSender(kCommandSenderTestOnlyMarker, &mockCommandSenderExtendedDelegate, &GetExchangeManager(),
+                                     &pendingResponseTracker);
+
+    AddBatchedInvokeRequestData(&commandSender);
+    commandSender.MoveToState(app::CommandSender::State::AddedCommand);
+
+    BasicCommandPathRegistry<4> basicCommandPathRegistry;
+    MockCommandResponder mockCommandResponder;
+    CommandHandlerImpl::TestOnlyOverrides testOnlyOverrides{ &basicCommandPathRegistry, &mockCommandResponder };
+    CommandHandlerImpl commandHandler(testOnlyOverrides, &mockCommandHandlerDelegate);
+
+    // Hackery to steal the InvokeRequest buffer from commandSender.
+    System::PacketBufferHandle commandDatabuf;
+    EXPECT_EQ(commandSender.Finalize(commandDatabuf), CHIP_NO_ERROR);
+
+    sendResponse              = true;
+    asyncCommand              = true;
+    asyncCommandRespondsLater = true;
+    mockCommandHandlerDelegate.ResetCounter();
+    commandDispatchedCount = 0;
+
+    EXPECT_EQ(commandHandler.OnInvokeCommandRequest(mockCommandResponder, std::move(commandDatabuf), false),
+              Protocols::InteractionModel::Status::Success);
+    EXPECT_EQ(commandDispatchedCount, 2u);
+
+    // The first command is still being processed, the responder can already send the response of the second one.
+    EXPECT_EQ(mockCommandResponder.mPartialResponsesAvailableCount, 1);
+    EXPECT_TRUE(mockCommandResponder.mChunks.IsNull());
+    EXPECT_EQ(commandHandler.FlushInvokeResponses(), CHIP_NO_ERROR);
+    ASSERT_FALSE(mockCommandResponder.mChunks.IsNull());
+    EXPECT_FALSE(mockCommandResponder.mChunks->HasChainedBuffer());
+    CheckInvokeResponseMessage(mockCommandResponder.mChunks, 1, /* expectedMoreChunkedMessages = */ true);
+
+    // There is nothing left to flush until the first command responds.
+    EXPECT_EQ(commandHandler.FlushInvokeResponses(), CHIP_NO_ERROR);
+    EXPECT_FALSE(mockCommandResponder.mChunks->HasChainedBuffer());
+    EXPECT_EQ(mockCommandHandlerDelegate.onFinalCalledTimes, 0);
+
+    CompleteAsyncCommand();
+
+    // The last InvokeResponseMessage holds the response of the first command.
+    EXPECT_EQ(mockCommandHandlerDelegate.onFinalCalledTimes, 1);
+    System::PacketBufferHandle firstMessage = mockCommandResponder.mChunks.PopHead();
+    ASSERT_FALSE(mockCommandResponder.mChunks.IsNull());
+    CheckInvokeResponseMessage(mockCommandResponder.mChunks, 1, /* expectedMoreChunkedMessages = */ false);
+}
+
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandResponseSender_SendsBatchedResponsesAsCommandsComplete)
+{
+    BatchedCommandSenderCallback callback;
+    PendingResponseTrackerImpl pendingResponseTracker;
+    app::CommandSender commandSender(kCommandSenderTestOnlyMarker, &callback, &GetExchangeManager(), &pendingResponseTracker);
+    AddBatchedInvokeRequestData(&commandSender);
+
+    BatchedCommandResponder responder(GetExchangeManager());
+    chip::Testing::MessageCapturer messageLog(*this);
+    messageLog.mCaptureStandaloneAcks = false;
+
+    sendResponse              = true;
+    asyncCommand              = true;
+    asyncCommandRespondsLater = true;
+    EXPECT_EQ(commandSender.SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+
+    // The response of the second command was sent and acknowledged while the first command is still being processed.
+    EXPECT_EQ(callback.onResponseCalledTimes, 1);
+    EXPECT_EQ(callback.mFirstResponseCommandId, kTestCommandIdNoData);
+    EXPECT_EQ(callback.onFinalCalledTimes, 0);
+    ASSERT_EQ(messageLog.MessageCount(), 3u);
+    EXPECT_TRUE(messageLog.IsMessageType(0, Protocols::InteractionModel::MsgType::InvokeCommandRequest));
+    EXPECT_TRUE(messageLog.IsMessageType(1, Protocols::InteractionModel::MsgType::InvokeCommandResponse));
+    CheckInvokeResponseMessage(messageLog.MessagePayload(1), 1, /* expectedMoreChunkedMessages = */ true);
+    CheckStatusResponse(messageLog, 2, CHIP_NO_ERROR);
+    EXPECT_FALSE(responder.IsDone());
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 2u);
+
+    // The response of the first command is sent as soon as it completes.
+    CompleteAsyncCommand();
+    DrainAndServiceIO();
+
+    EXPECT_EQ(callback.onResponseCalledTimes, 2);
+    EXPECT_EQ(callback.onFinalCalledTimes, 1);
+    EXPECT_EQ(callback.onErrorCalledTimes, 0);
+    EXPECT_EQ(commandSender.GetInvokeResponseMessageCount(), 2u);
+    ASSERT_EQ(messageLog.MessageCount(), 4u);
+    EXPECT_TRUE(messageLog.IsMessageType(3, Protocols::InteractionModel::MsgType::InvokeCommandResponse));
+    CheckInvokeResponseMessage(messageLog.MessagePayload(3), 1, /* expectedMoreChunkedMessages = */ false);
+    EXPECT_TRUE(responder.IsDone());
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandResponseSender_CommandsCompleteWhileAwaitingStatusResponse)
+{
+    BatchedCommandSenderCallback callback;
+    PendingResponseTrackerImpl pendingResponseTracker;
+    app::CommandSender commandSender(kCommandSenderTestOnlyMarker, &callback, &GetExchangeManager(), &pendingResponseTracker);
+    AddBatchedInvokeRequestData(&commandSender);
+
+    BatchedCommandResponder responder(GetExchangeManager());
+    chip::Testing::MessageCapturer messageLog(*this);
+    messageLog.mCaptureStandaloneAcks = false;
+
+    // The last command completes while the first InvokeResponseMessage is not acknowledged yet: the last one is sent
+    // once it is.
+    callback.mOnFirstResponse = [] { CompleteAsyncCommand(); };
+
+    sendResponse              = true;
+    asyncCommand              = true;
+    asyncCommandRespondsLater = true;
+    EXPECT_EQ(commandSender.SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(callback.onResponseCalledTimes, 2);
+    EXPECT_EQ(callback.mFirstResponseCommandId, kTestCommandIdNoData);
+    EXPECT_EQ(callback.onFinalCalledTimes, 1);
+    EXPECT_EQ(callback.onErrorCalledTimes, 0);
+    ASSERT_EQ(messageLog.MessageCount(), 4u);
+    EXPECT_TRUE(messageLog.IsMessageType(1, Protocols::InteractionModel::MsgType::InvokeCommandResponse));
+    CheckInvokeResponseMessage(messageLog.MessagePayload(1), 1, /* expectedMoreChunkedMessages = */ true);
+    CheckStatusResponse(messageLog, 2, CHIP_NO_ERROR);
+    EXPECT_TRUE(messageLog.IsMessageType(3, Protocols::InteractionModel::MsgType::InvokeCommandResponse));
+    CheckInvokeResponseMessage(messageLog.MessagePayload(3), 1, /* expectedMoreChunkedMessages = */ false);
+    EXPECT_TRUE(responder.IsDone());
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandResponseSender_ClosesOnceBatchedCommandsComplete)
+{
+    BatchedCommandSenderCallback callback;
+    PendingResponseTrackerImpl pendingResponseTracker;
+    app::CommandSender commandSender(kCommandSenderTestOnlyMarker, &callback, &GetExchangeManager(), &pendingResponseTracker);
+    AddBatchedInvokeRequestData(&commandSender);
+
+    BatchedCommandResponder responder(GetExchangeManager());
+
+    // The StatusResponse acknowledging the first InvokeResponseMessage is lost.
+    GetLoopback().mSentMessageCount                 = 0;
+    GetLoopback().mNumMessagesToAllowBeforeDropping = 2;
+    GetLoopback().mNumMessagesToDrop                = 1;
+
+    sendResponse              = true;
+    asyncCommand              = true;
+    asyncCommandRespondsLater = true;
+    EXPECT_EQ(commandSender.SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(GetLoopback().mSentMessageCount, 3u);
+    EXPECT_EQ(GetLoopback().mDroppedMessageCount, 1u);
+    EXPECT_EQ(callback.onResponseCalledTimes, 1);
+
+    // The responder gives up waiting for it, but cannot be released while the last command is being processed.
+    responder.mResponseSender->OnResponseTimeout(responder.mResponseSender->GetExchangeContext());
+    EXPECT_FALSE(responder.IsDone());
+
+    // The response of the last command is dropped, and nothing is sent.
+    GetLoopback().mSentMessageCount = 0;
+    CompleteAsyncCommand();
+    DrainAndServiceIO();
+
+    EXPECT_TRUE(responder.IsDone());
+    EXPECT_EQ(GetLoopback().mSentMessageCount, 0u);
+    EXPECT_EQ(callback.onResponseCalledTimes, 1);
+    EXPECT_EQ(callback.onFinalCalledTimes, 0);
+
+    // The requester is still waiting for the last InvokeResponseMessage, and retransmitting its StatusResponse.
+    ExpireSessionAliceToBob();
+    ExpireSessionBobToAlice();
+    EXPECT_SUCCESS(CreateSessionAliceToBob());
+    EXPECT_SUCCESS(CreateSessionBobToAlice());
+}
+
 TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsStatusResponse)
 {
     BasicCommandPathRegistry<4> basicCommandPathRegistry;
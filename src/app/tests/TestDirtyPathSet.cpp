@@ -0,0 +1,191 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/DirtyPathSet.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+constexpr size_t kMaxPaths = 8;
+
+// Few buckets, so that paths with different keys share buckets.
+using TestPathSet = DirtyPathSet<kMaxPaths, 2, ObjectPoolMem::kInline>;
+
+// Every combination of a concrete or wildcard endpoint, cluster and attribute.
+std::vector<AttributePathParams> AllPaths()
+{
+    const EndpointId endpoints[]   = { 1, 2, kInvalidEndpointId };
+    const ClusterId clusters[]     = { 6, 8, kInvalidClusterId };
+    const AttributeId attributes[] = { 0, kInvalidAttributeId };
+
+    std::vector<AttributePathParams> paths;
+    for (auto endpoint : endpoints)
+    {
+        for (auto cluster : clusters)
+        {
+            for (auto attribute : attributes)
+            {
+                paths.emplace_back(endpoint, cluster, attribute);
+            }
+        }
+    }
+    return paths;
+}
+
+std::vector<AttributePathParams> Covering(TestPathSet & set, const AttributePathParams & path)
+{
+    std::vector<AttributePathParams> result;
+    set.ForEachPathCovering(path, [&](auto * dirtyPath) {
+        result.push_back(*dirtyPath);
+        return Loop::Continue;
+    });
+    return result;
+}
+
+std::vector<AttributePathParams> CoveredBy(TestPathSet & set, const AttributePathParams & path)
+{
+    std::vector<AttributePathParams> result;
+    set.ForEachPathCoveredBy(path, [&](auto * dirtyPath) {
+        result.push_back(*dirtyPath);
+        return Loop::Continue;
+    });
+    return result;
+}
+
+// Check that the lookups through the index find exactly the paths that a walk of the whole set would find.
+void VerifyLookups(TestPathSet & set)
+{
+    for (const auto & query : AllPaths())
+    {
+        size_t expectedCovering  = 0;
+        size_t expectedCoveredBy = 0;
+        set.ForEachActiveObject([&](auto * dirtyPath) {
+            expectedCovering += dirtyPath->IsAttributePathSupersetOf(query) ? 1 : 0;
+            expectedCoveredBy += query.IsAttributePathSupersetOf(*dirtyPath) ? 1 : 0;
+            return Loop::Continue;
+        });
+
+        auto covering = Covering(set, query);
+        EXPECT_EQ(covering.size(), expectedCovering);
+        for (const auto & path : covering)
+        {
+            EXPECT_TRUE(path.IsAttributePathSupersetOf(query));
+        }
+
+        auto coveredBy = CoveredBy(set, query);
+        EXPECT_EQ(coveredBy.size(), expectedCoveredBy);
+        for (const auto & path : coveredBy)
+        {
+            EXPECT_TRUE(query.IsAttributePathSupersetOf(path));
+        }
+    }
+}
+
+TEST(TestDirtyPathSet, TestLookupsMatchFullScan)
+{
+    TestPathSet set;
+    const auto paths = AllPaths();
+
+    // The set may be smaller than the number of combinations, so check them a few at a time.
+    constexpr size_t kBatch = 6;
+    static_assert(kBatch <= kMaxPaths);
+    for (size_t first = 0; first < paths.size(); first += kBatch)
+    {
+        for (size_t i = first; i < first + kBatch && i < paths.size(); i++)
+        {
+            ASSERT_NE(set.CreatePath(paths[i], AttributeGeneration(1)), nullptr);
+        }
+        VerifyLookups(set);
+        set.ReleaseAll();
+    }
+
+    // A mix of concrete and wildcard paths.
+    for (size_t i = 0; i < kBatch; i++)
+    {
+        ASSERT_NE(set.CreatePath(paths[(i * 7) % paths.size()], AttributeGeneration(1)), nullptr);
+    }
+    VerifyLookups(set);
+    set.ReleaseAll();
+}
+
+TEST(TestDirtyPathSet, TestConcretePathLookup)
+{
+    TestPathSet set;
+    ASSERT_NE(set.CreatePath(AttributePathParams(1, 6, 0), AttributeGeneration(1)), nullptr);
+    ASSERT_NE(set.CreatePath(AttributePathParams(kInvalidEndpointId, 8, 0), AttributeGeneration(2)), nullptr);
+    ASSERT_NE(set.CreatePath(AttributePathParams(EndpointId(2), kInvalidClusterId), AttributeGeneration(3)), nullptr);
+
+    auto generationOfCovering = [&](const ConcreteAttributePath & path) {
+        uint32_t generation = 0;
+        set.ForEachPathCovering(path, [&](auto * dirtyPath) {
+            generation = dirtyPath->mGeneration.Raw();
+            return Loop::Break;
+        });
+        return generation;
+    };
+
+    EXPECT_EQ(generationOfCovering(ConcreteAttributePath(1, 6, 0)), 1u);
+    EXPECT_EQ(generationOfCovering(ConcreteAttributePath(1, 6, 1)), 0u);
+    EXPECT_EQ(generationOfCovering(ConcreteAttributePath(3, 8, 0)), 2u);
+    EXPECT_EQ(generationOfCovering(ConcreteAttributePath(2, 6, 5)), 3u);
+    EXPECT_EQ(generationOfCovering(ConcreteAttributePath(3, 6, 0)), 0u);
+
+    set.ReleaseAll();
+}
+
+TEST(TestDirtyPathSet, TestUpdateReleaseAndReindex)
+{
+    TestPathSet set;
+    auto * path = set.CreatePath(AttributePathParams(1, 6, 0), AttributeGeneration(1));
+    ASSERT_NE(path, nullptr);
+    auto * other = set.CreatePath(AttributePathParams(1, 8, 0), AttributeGeneration(1));
+    ASSERT_NE(other, nullptr);
+
+    // Moving a path to another key keeps it reachable through the index.
+    set.UpdatePath(path, AttributePathParams(kInvalidEndpointId, 6));
+    EXPECT_EQ(Covering(set, AttributePathParams(1, 6, 0)).size(), 1u);
+    EXPECT_EQ(Covering(set, AttributePathParams(2, 6, 3)).size(), 1u);
+    VerifyLookups(set);
+
+    // Changing the key in place requires a reindex.
+    other->SetWildcardClusterId();
+    set.Reindex();
+    EXPECT_EQ(Covering(set, AttributePathParams(1, 6, 0)).size(), 2u);
+    VerifyLookups(set);
+
+    set.ReleasePath(path);
+    EXPECT_EQ(set.Allocated(), 1u);
+    EXPECT_EQ(Covering(set, AttributePathParams(2, 6, 3)).size(), 0u);
+    EXPECT_EQ(Covering(set, AttributePathParams(1, 6, 0)).size(), 1u);
+    VerifyLookups(set);
+
+    set.ReleaseAll();
+    EXPECT_EQ(set.Allocated(), 0u);
+    EXPECT_EQ(Covering(set, AttributePathParams(1, 6, 0)).size(), 0u);
+}
+
+} // namespace
@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/endpoint-index.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <cstdint>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr uint16_t kTableSize = 64;
+using TestEndpointIndex       = EndpointIndex<kTableSize>;
+
+// A model of the ember endpoint table, looked up by walking it like attribute-storage used to.
+struct EndpointTable
+{
+    EndpointId endpoints[kTableSize];
+    TestEndpointIndex index;
+
+    EndpointTable()
+    {
+        for (auto & endpoint : endpoints)
+        {
+            endpoint = kInvalidEndpointId;
+        }
+    }
+
+    void Set(uint16_t i, EndpointId endpoint)
+    {
+        index.Remove(endpoints[i], i);
+        endpoints[i] = endpoint;
+        index.Insert(endpoint, i);
+    }
+
+    uint16_t Walk(EndpointId endpoint, uint16_t minIndex = 0) const
+    {
+        for (uint16_t i = minIndex; i < kTableSize; i++)
+        {
+            if (endpoint != kInvalidEndpointId && endpoints[i] == endpoint)
+            {
+                return i;
+            }
+        }
+        return TestEndpointIndex::kInvalidIndex;
+    }
+
+    void Verify(EndpointId maxEndpoint) const
+    {
+        for (EndpointId endpoint = 0; endpoint <= maxEndpoint; endpoint++)
+        {
+            EXPECT_EQ(index.Find(endpoint, [](uint16_t) { return true; }), Walk(endpoint));
+            EXPECT_EQ(index.Find(endpoint, [](uint16_t i) { return i >= 8; }), Walk(endpoint, 8));
+        }
+        EXPECT_EQ(index.Find(kInvalidEndpointId, [](uint16_t) { return true; }), TestEndpointIndex::kInvalidIndex);
+    }
+};
+
+TEST(TestEndpointIndex, TestFind)
+{
+    EndpointTable table;
+    table.Verify(10);
+
+    table.Set(0, 0);
+    table.Set(1, 1);
+    table.Set(5, 7);
+    EXPECT_EQ(table.index.Find(7, [](uint16_t) { return true; }), 5u);
+    EXPECT_EQ(table.index.Find(2, [](uint16_t) { return true; }), TestEndpointIndex::kInvalidIndex);
+    table.Verify(10);
+
+    // The same endpoint id at several indices: the lowest one matching the predicate is found.
+    table.Set(9, 7);
+    table.Set(3, 7);
+    EXPECT_EQ(table.index.Find(7, [](uint16_t) { return true; }), 3u);
+    EXPECT_EQ(table.index.Find(7, [](uint16_t i) { return i != 3; }), 5u);
+    table.Verify(10);
+
+    table.Set(3, kInvalidEndpointId);
+    EXPECT_EQ(table.index.Find(7, [](uint16_t) { return true; }), 5u);
+    table.Verify(10);
+}
+
+TEST(TestEndpointIndex, TestAddAndRemoveManyEndpoints)
+{
+    EndpointTable table;
+
+    // Fill the whole table, as a bridge adding dynamic endpoints would.
+    for (uint16_t i = 0; i < kTableSize; i++)
+    {
+        table.Set(i, static_cast<EndpointId>(i * 3 + 1));
+    }
+    table.Verify(kTableSize * 3 + 1);
+
+    // Remove every other endpoint, then reuse the slots for other endpoints.
+    for (uint16_t i = 0; i < kTableSize; i += 2)
+    {
+        table.Set(i, kInvalidEndpointId);
+    }
+    table.Verify(kTableSize * 3 + 1);
+
+    for (uint16_t i = 0; i < kTableSize; i += 2)
+    {
+        table.Set(i, static_cast<EndpointId>(1000 + i));
+    }
+    table.Verify(kTableSize * 3 + 1);
+    EXPECT_EQ(table.index.Find(1010, [](uint16_t) { return true; }), 10u);
+
+    // Pseudo-random churn, so that probe sequences wrap and entries are shifted back on removal.
+    uint32_t seed = 1;
+    for (int round = 0; round < 2000; round++)
+    {
+        seed               = seed * 1103515245u + 12345u;
+        const uint16_t i   = static_cast<uint16_t>((seed >> 16) % kTableSize);
+        const bool isEmpty = ((seed >> 8) & 3) == 0;
+        table.Set(i, isEmpty ? kInvalidEndpointId : static_cast<EndpointId>((seed >> 4) % 100));
+    }
+    table.Verify(100);
+
+    table.index.Clear();
+    EXPECT_EQ(table.index.Find(1010, [](uint16_t) { return true; }), TestEndpointIndex::kInvalidIndex);
+}
+
+} // namespace
@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EventBufferIndex.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <cstdint>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+using TestIndex = EventBufferIndex<4>;
+
+constexpr uint32_t kEventSize = 10;
+
+// Appends event @a eventNumber of endpoint 1 and the On/Off cluster, as if every event took kEventSize bytes.
+void AppendEvent(TestIndex & index, EventNumber eventNumber, EndpointId endpoint = 1, ClusterId cluster = 6)
+{
+    index.Append(static_cast<uint32_t>(eventNumber) * kEventSize, eventNumber, endpoint, cluster);
+}
+
+TEST(TestEventBufferIndex, TestBlocks)
+{
+    TestIndex index;
+    EXPECT_EQ(index.GetBlockCount(), 0u);
+    EXPECT_EQ(index.GetEventCount(), 0u);
+
+    for (EventNumber i = 0; i < TestIndex::kEventsPerBlock + 1; i++)
+    {
+        AppendEvent(index, i);
+    }
+
+    ASSERT_EQ(index.GetBlockCount(), 2u);
+    EXPECT_EQ(index.GetEventCount(), TestIndex::kEventsPerBlock + 1);
+
+    EXPECT_EQ(index.GetBlock(0).offset, 0u);
+    EXPECT_EQ(index.GetBlock(0).eventCount, TestIndex::kEventsPerBlock);
+    EXPECT_EQ(index.GetBlock(0).lastEventNumber, TestIndex::kEventsPerBlock - 1);
+
+    EXPECT_EQ(index.GetBlock(1).offset, TestIndex::kEventsPerBlock * kEventSize);
+    EXPECT_EQ(index.GetBlock(1).eventCount, 1u);
+    EXPECT_EQ(index.GetBlock(1).lastEventNumber, TestIndex::kEventsPerBlock);
+}
+
+TEST(TestEventBufferIndex, TestRemoveOldest)
+{
+    TestIndex index;
+    for (EventNumber i = 0; i < TestIndex::kEventsPerBlock + 1; i++)
+    {
+        AppendEvent(index, i);
+    }
+
+    // Evicting events moves the start of the oldest block, until it is empty.
+    index.RemoveOldest(kEventSize);
+    ASSERT_EQ(index.GetBlockCount(), 2u);
+    EXPECT_EQ(index.GetBlock(0).offset, kEventSize);
+    EXPECT_EQ(index.GetBlock(0).eventCount, TestIndex::kEventsPerBlock - 1);
+
+    for (EventNumber i = 2; i <= TestIndex::kEventsPerBlock; i++)
+    {
+        index.RemoveOldest(static_cast<uint32_t>(i) * kEventSize);
+    }
+    ASSERT_EQ(index.GetBlockCount(), 1u);
+    EXPECT_EQ(index.GetEventCount(), 1u);
+    EXPECT_EQ(index.GetBlock(0).offset, TestIndex::kEventsPerBlock * kEventSize);
+    EXPECT_EQ(index.GetBlock(0).lastEventNumber, TestIndex::kEventsPerBlock);
+
+    index.RemoveOldest(0);
+    EXPECT_EQ(index.GetBlockCount(), 0u);
+    EXPECT_EQ(index.GetEventCount(), 0u);
+
+    // Removing from an empty index is a no-op.
+    index.RemoveOldest(0);
+    EXPECT_EQ(index.GetEventCount(), 0u);
+}
+
+TEST(TestEventBufferIndex, TestMergeOldestBlocks)
+{
+    TestIndex index;
+    const EventNumber eventCount = 5 * TestIndex::kEventsPerBlock;
+    for (EventNumber i = 0; i < eventCount; i++)
+    {
+        AppendEvent(index, i, static_cast<EndpointId>(i / TestIndex::kEventsPerBlock));
+    }
+
+    // The fifth block did not fit: the first two were merged, and the index still covers every event.
+    ASSERT_EQ(index.GetBlockCount(), 4u);
+    EXPECT_EQ(index.GetEventCount(), eventCount);
+    EXPECT_EQ(index.GetBlock(0).offset, 0u);
+    EXPECT_EQ(index.GetBlock(0).eventCount, 2 * TestIndex::kEventsPerBlock);
+    EXPECT_EQ(index.GetBlock(0).lastEventNumber, 2 * TestIndex::kEventsPerBlock - 1);
+    EXPECT_TRUE(index.GetBlock(0).MayContain(EventPathParams(0, 6, 1)));
+    EXPECT_TRUE(index.GetBlock(0).MayContain(EventPathParams(1, 6, 1)));
+
+    for (size_t i = 1; i < index.GetBlockCount(); i++)
+    {
+        EXPECT_EQ(index.GetBlock(i).offset, (i + 1) * TestIndex::kEventsPerBlock * kEventSize);
+        EXPECT_EQ(index.GetBlock(i).eventCount, TestIndex::kEventsPerBlock);
+    }
+    EXPECT_EQ(index.GetBlock(3).lastEventNumber, eventCount - 1);
+
+    index.Clear();
+    EXPECT_EQ(index.GetBlockCount(), 0u);
+    EXPECT_EQ(index.GetEventCount(), 0u);
+}
+
+TEST(TestEventBufferIndex, TestMayContain)
+{
+    TestIndex index;
+    AppendEvent(index, 0, 1, 6);
+    AppendEvent(index, 1, 2, 8);
+
+    const TestIndex::Block & block = index.GetBlock(0);
+
+    // Paths of events in the block always match, including through wildcards.
+    EXPECT_TRUE(block.MayContain(EventPathParams(1, 6, 1)));
+    EXPECT_TRUE(block.MayContain(EventPathParams(2, 8, 1)));
+    EXPECT_TRUE(block.MayContain(EventPathParams(kInvalidEndpointId, 8, 1)));
+    EXPECT_TRUE(block.MayContain(EventPathParams(2, kInvalidClusterId, kInvalidEventId)));
+    EXPECT_TRUE(block.MayContain(EventPathParams(kInvalidEndpointId, kInvalidClusterId, kInvalidEventId)));
+
+    // Other paths are filtered out, unless they collide with those of the block.
+    size_t matches = 0;
+    for (EndpointId endpoint = 100; endpoint < 200; endpoint++)
+    {
+        matches += block.MayContain(EventPathParams(endpoint, 6, 1)) ? 1 : 0;
+        matches += block.MayContain(EventPathParams(endpoint, kInvalidClusterId, kInvalidEventId)) ? 1 : 0;
+    }
+    for (ClusterId cluster = 0x100; cluster < 0x200; cluster++)
+    {
+        matches += block.MayContain(EventPathParams(kInvalidEndpointId, cluster, 1)) ? 1 : 0;
+    }
+    EXPECT_LT(matches, 50u);
+}
+
+} // namespace
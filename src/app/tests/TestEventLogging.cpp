@@ -61,18 +61,11 @@ public:
     // Performs setup for each individual test in the test suite
     void SetUp() override
     {
-        const chip::app::LogStorageResources logStorageResources[] = {
-            { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), chip::app::PriorityLevel::Debug },
-            { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), chip::app::PriorityLevel::Info },
-            { &gCritEventBuffer[0], sizeof(gCritEventBuffer), chip::app::PriorityLevel::Critical },
-        };
-
         AppContext::SetUp();
         chip::app::InteractionModelEngine::GetInstance()->SetDataModelProvider(
             chip::app::CodegenDataModelProviderInstance(nullptr));
         ASSERT_EQ(mEventCounter.Init(0), CHIP_NO_ERROR);
-        chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources),
-                                                          gCircularEventBuffer, logStorageResources, &mEventCounter);
+        CreateEventManagement();
     }
 
     // Performs teardown for each individual test in the test suite
@@ -82,7 +75,26 @@ public:
         AppContext::TearDown();
     }
 
+    // Creates the event management again over the same buffers and event counter, as after a restart.
+    void RestartEventManagement()
+    {
+        chip::app::EventManagement::DestroyEventManagement();
+        CreateEventManagement();
+    }
+
 private:
+    void CreateEventManagement()
+    {
+        const chip::app::LogStorageResources logStorageResources[] = {
+            { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), chip::app::PriorityLevel::Debug },
+            { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), chip::app::PriorityLevel::Info },
+            { &gCritEventBuffer[0], sizeof(gCritEventBuffer), chip::app::PriorityLevel::Critical },
+        };
+
+        chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources),
+                                                          gCircularEventBuffer, logStorageResources, &mEventCounter);
+    }
+
     chip::MonotonicallyIncreasingCounter<chip::EventNumber> mEventCounter;
 };
 
@@ -176,6 +188,29 @@ private:
     int32_t mStatus;
 };
 
+class TestEventStorageDelegate : public chip::app::EventStorageDelegate
+{
+public:
+    CHIP_ERROR LoadBufferState(uint32_t aBufferIndex, uint32_t & aHeadOffset, uint32_t & aDataLength) override
+    {
+        VerifyOrReturnError(mSaved, CHIP_ERROR_NOT_FOUND);
+        aHeadOffset = mHeadOffsets[aBufferIndex];
+        aDataLength = mDataLengths[aBufferIndex];
+        return CHIP_NO_ERROR;
+    }
+
+    void SaveBufferState(uint32_t aBufferIndex, uint32_t aHeadOffset, uint32_t aDataLength) override
+    {
+        mHeadOffsets[aBufferIndex] = aHeadOffset;
+        mDataLengths[aBufferIndex] = aDataLength;
+        mSaved                     = true;
+    }
+
+    bool mSaved              = false;
+    uint32_t mHeadOffsets[3] = {};
+    uint32_t mDataLengths[3] = {};
+};
+
 TEST_F(TestEventLogging, TestCheckLogEventWithEvictToNextBuffer)
 {
 
@@ -288,4 +323,59 @@ TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
     CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
 
+TEST_F(TestEventLogging, TestRestorePersistedEvents)
+{
+    chip::EventNumber eid;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Info;
+    TestEventGenerator testEventGenerator;
+    TestEventStorageDelegate storage;
+
+    // Nothing was persisted yet.
+    chip::app::EventManagement * logMgmt = &chip::app::EventManagement::GetInstance();
+    EXPECT_EQ(logMgmt->RestoreEvents(storage), CHIP_NO_ERROR);
+    CheckLogState(*logMgmt, 0, chip::app::PriorityLevel::Debug);
+    EXPECT_TRUE(storage.mSaved);
+
+    for (int32_t i = 0; i < 5; i++)
+    {
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt->LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    }
+    CheckLogState(*logMgmt, 3, chip::app::PriorityLevel::Debug);
+    CheckLogState(*logMgmt, 5, chip::app::PriorityLevel::Info);
+
+    // The events logged before the restart are restored, and new ones are logged after them.
+    RestartEventManagement();
+    logMgmt = &chip::app::EventManagement::GetInstance();
+    CheckLogState(*logMgmt, 0, chip::app::PriorityLevel::Info);
+    EXPECT_EQ(logMgmt->RestoreEvents(storage), CHIP_NO_ERROR);
+    CheckLogState(*logMgmt, 3, chip::app::PriorityLevel::Debug);
+    CheckLogState(*logMgmt, 5, chip::app::PriorityLevel::Info);
+    EXPECT_EQ(logMgmt->LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    EXPECT_EQ(eid, 5u);
+    CheckLogState(*logMgmt, 3, chip::app::PriorityLevel::Debug);
+    CheckLogState(*logMgmt, 6, chip::app::PriorityLevel::Info);
+
+    // Events can only be restored before any is logged.
+    EXPECT_EQ(logMgmt->RestoreEvents(storage), CHIP_ERROR_INCORRECT_STATE);
+
+    // A truncated event, e.g. one being written when the device lost power, is dropped.
+    storage.mDataLengths[0]--;
+    RestartEventManagement();
+    logMgmt = &chip::app::EventManagement::GetInstance();
+    EXPECT_EQ(logMgmt->RestoreEvents(storage), CHIP_NO_ERROR);
+    CheckLogState(*logMgmt, 2, chip::app::PriorityLevel::Debug);
+    CheckLogState(*logMgmt, 5, chip::app::PriorityLevel::Info);
+
+    // A buffer whose persisted state does not fit it is restored empty.
+    storage.mHeadOffsets[0] = sizeof(gDebugEventBuffer);
+    RestartEventManagement();
+    logMgmt = &chip::app::EventManagement::GetInstance();
+    EXPECT_EQ(logMgmt->RestoreEvents(storage), CHIP_NO_ERROR);
+    CheckLogState(*logMgmt, 0, chip::app::PriorityLevel::Debug);
+    CheckLogState(*logMgmt, 3, chip::app::PriorityLevel::Info);
+}
+
 } // namespace
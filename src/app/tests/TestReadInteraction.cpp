@@ -460,6 +460,33 @@ public:
     }
 };
 
+// Data model whose value of mPendingPath is not available until it is released, as for a bridge that fetches it from a
+// bridged device.
+class PendingValueDataModel : public chip::app::TestImCustomDataModel
+{
+public:
+    chip::app::DataModel::ActionReturnStatus ReadAttribute(const chip::app::DataModel::ReadAttributeRequest & request,
+                                                           chip::app::AttributeValueEncoder & encoder) override
+    {
+        if (mPending && request.path == mPendingPath)
+        {
+            mPendingReads++;
+            return CHIP_ERROR_IN_PROGRESS;
+        }
+        return TestImCustomDataModel::ReadAttribute(request, encoder);
+    }
+
+    void ReleaseValue()
+    {
+        mPending = false;
+        NotifyAttributeChanged(mPendingPath, chip::app::DataModel::AttributeChangeType::kQuiet);
+    }
+
+    chip::app::ConcreteAttributePath mPendingPath;
+    bool mPending          = true;
+    uint32_t mPendingReads = 0;
+};
+
 } // namespace
 
 using ReportScheduler     = chip::app::reporting::ReportScheduler;
@@ -535,6 +562,7 @@ public:
     void TestPostSubscribeRoundtripStatusReportTimeout();
     void TestProcessSubscribeRequest();
     void TestReadChunking();
+    void TestReadChunkingConcurrentReads();
     void TestReadChunkingInvalidSubscriptionId();
     void TestReadChunkingStatusReportTimeout();
     void TestReadClient();
@@ -553,6 +581,8 @@ public:
     void TestReadHandlerMalformedSubscribeRequest();
     void TestReadHandlerSetMaxReportingInterval();
     void TestReadInvalidAttributePathRoundtrip();
+    void TestReadPendingAttributeValue();
+    void TestReadPendingAttributeValueTimeout();
     void TestReadReportFailure();
     void TestReadRoundtrip();
     void TestReadRoundtripWithDataVersionFilter();
@@ -1648,6 +1678,195 @@ void TestReadInteraction::TestReadChunking()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+// Reads that are served in the same run of the reporting engine share its report cache, if any: the list that does
+// not fit is chunked the same way for both.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadChunkingConcurrentReads)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadChunkingConcurrentReads)
+void TestReadInteraction::TestReadChunkingConcurrentReads()
+{
+    Messaging::ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    MockInteractionModelApp delegate1;
+    MockInteractionModelApp delegate2;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = chip::Testing::kMockEndpoint3;
+    attributePathParams[0].mClusterId   = chip::Testing::MockClusterId(2);
+    attributePathParams[0].mAttributeId = chip::Testing::MockAttributeId(4);
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+
+    {
+        app::ReadClient readClient1(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate1,
+                                    chip::app::ReadClient::InteractionType::Read);
+        app::ReadClient readClient2(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate2,
+                                    chip::app::ReadClient::InteractionType::Read);
+
+        EXPECT_EQ(readClient1.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        EXPECT_EQ(readClient2.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        constexpr AttributeCaptureAssertion kExpectedResponses[] = {
+            AttributeCaptureAssertion(0xFFFC, 0xFFF1FC02, 0xFFF10004, /* listSize = */ 4),
+            AttributeCaptureAssertion(0xFFFC, 0xFFF1FC02, 0xFFF10004, /* listSize = */ 1),
+            AttributeCaptureAssertion(0xFFFC, 0xFFF1FC02, 0xFFF10004, /* listSize = */ 1),
+        };
+        for (MockInteractionModelApp * delegate : { &delegate1, &delegate2 })
+        {
+            delegate->LogCaptures("TestReadChunkingConcurrentReads:");
+            ASSERT_TRUE(delegate->CapturesMatchExactly(chip::Span<const AttributeCaptureAssertion>(kExpectedResponses)));
+            EXPECT_TRUE(delegate->mGotReport);
+            EXPECT_FALSE(delegate->mReadError);
+        }
+        EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    }
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadPendingAttributeValue)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadPendingAttributeValue)
+void TestReadInteraction::TestReadPendingAttributeValue()
+{
+    Messaging::ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    // The read handler visits the paths in reverse order of the request: make the last one visited pending.
+    PendingValueDataModel dataModel;
+    dataModel.mPendingPath =
+        ConcreteAttributePath(chip::Testing::kMockEndpoint3, chip::Testing::MockClusterId(2), chip::Testing::MockAttributeId(1));
+    DataModel::Provider * oldProvider = engine->SetDataModelProvider(&dataModel);
+
+    chip::app::AttributePathParams attributePathParams[2];
+    attributePathParams[0].mEndpointId  = chip::Testing::kMockEndpoint3;
+    attributePathParams[0].mClusterId   = chip::Testing::MockClusterId(2);
+    attributePathParams[0].mAttributeId = chip::Testing::MockAttributeId(1);
+
+    attributePathParams[1].mEndpointId  = chip::Testing::kMockEndpoint3;
+    attributePathParams[1].mClusterId   = chip::Testing::MockClusterId(2);
+    attributePathParams[1].mAttributeId = chip::Testing::MockAttributeId(2);
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 2;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        // The first attribute was sent in a chunk of its own, then the handler parked waiting for the second one.
+        EXPECT_EQ(delegate.mNumAttributeResponse, 1);
+        EXPECT_FALSE(delegate.mReadError);
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(), 1u);
+        ASSERT_NE(engine->ActiveHandlerAt(0), nullptr);
+        EXPECT_TRUE(engine->ActiveHandlerAt(0)->IsAwaitingAttributeValue());
+        EXPECT_EQ(engine->GetReportingEngine().GetNumReportsInFlight(), 0u);
+        EXPECT_EQ(dataModel.mPendingReads, 2u);
+
+        // Unrelated changes do not resume the report.
+        dataModel.NotifyAttributeChanged(ConcreteAttributePath(chip::Testing::kMockEndpoint3, chip::Testing::MockClusterId(2),
+                                                               chip::Testing::MockAttributeId(3)),
+                                         DataModel::AttributeChangeType::kQuiet);
+        DrainAndServiceIO();
+        EXPECT_TRUE(engine->ActiveHandlerAt(0)->IsAwaitingAttributeValue());
+        EXPECT_EQ(dataModel.mPendingReads, 2u);
+
+        dataModel.ReleaseValue();
+        DrainAndServiceIO();
+
+        EXPECT_EQ(delegate.mNumAttributeResponse, 2);
+        EXPECT_TRUE(delegate.mGotReport);
+        EXPECT_FALSE(delegate.mReadError);
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(), 0u);
+        // By now we should have closed all exchanges and sent all pending acks, so
+        // there should be no queued-up things in the retransmit table.
+        EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    }
+
+    engine->SetDataModelProvider(oldProvider);
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadPendingAttributeValueTimeout)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadPendingAttributeValueTimeout)
+void TestReadInteraction::TestReadPendingAttributeValueTimeout()
+{
+    Messaging::ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    PendingValueDataModel dataModel;
+    dataModel.mPendingPath =
+        ConcreteAttributePath(chip::Testing::kMockEndpoint3, chip::Testing::MockClusterId(2), chip::Testing::MockAttributeId(2));
+    DataModel::Provider * oldProvider = engine->SetDataModelProvider(&dataModel);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = chip::Testing::kMockEndpoint3;
+    attributePathParams[0].mClusterId   = chip::Testing::MockClusterId(2);
+    attributePathParams[0].mAttributeId = chip::Testing::MockAttributeId(2);
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        // Nothing could be sent without the value.
+        EXPECT_FALSE(delegate.mGotReport);
+        EXPECT_EQ(delegate.mNumAttributeResponse, 0);
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(), 1u);
+        ASSERT_NE(engine->ActiveHandlerAt(0), nullptr);
+        EXPECT_TRUE(engine->ActiveHandlerAt(0)->IsAwaitingAttributeValue());
+
+        gMockClock.AdvanceMonotonic(Milliseconds32(CHIP_IM_SERVER_PENDING_READ_TIMEOUT_MS));
+        GetIOContext().DriveIO();
+        DrainAndServiceIO();
+
+        // The value never came, a Timeout status is reported for the attribute instead.
+        EXPECT_EQ(delegate.mNumAttributeResponse, 0);
+        EXPECT_EQ(delegate.mLastStatusReceived.mStatus, Protocols::InteractionModel::Status::Timeout);
+        EXPECT_FALSE(delegate.mReadError);
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(), 0u);
+        // By now we should have closed all exchanges and sent all pending acks, so
+        // there should be no queued-up things in the retransmit table.
+        EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    }
+
+    engine->SetDataModelProvider(oldProvider);
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSetDirtyBetweenChunks)
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestSetDirtyBetweenChunks)
 void TestReadInteraction::TestSetDirtyBetweenChunks()
@@ -61,6 +61,7 @@ public:
     void TestReportDeferral();
     void TestReportDeferralOnce();
     void TestReportDeferralEndpointSpecific();
+    void TestReportPacing();
 
     /// @brief Mimicks the various operations that happen on a subscription transaction after a read handler was created so that
     /// readhandlers are in the expected state for further tests.
@@ -985,6 +986,77 @@ TEST_F_FROM_FIXTURE(TestReportScheduler, TestReportDeferralEndpointSpecific)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestReportPacing)
+{
+    NullReadHandlerCallback nullCallback;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+
+    // Initialize mock timestamp
+    sTestTimerDelegate.SetMockSystemTimestamp(Milliseconds64(0));
+    sScheduler.SetPacingInterval(System::Clock::Milliseconds32(100));
+    sScheduler.ResetSchedulingLatencyStats();
+
+    // Clean read handlers (min = 0s, max = 10s)
+    constexpr size_t kNumReadHandlers = CHIP_IM_MAX_REPORTS_IN_FLIGHT + 2;
+    ReadHandler * readHandlers[kNumReadHandlers];
+    for (auto & readHandler : readHandlers)
+    {
+        readHandler = readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &sScheduler);
+        ASSERT_NE(nullptr, readHandler);
+        EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler, &sScheduler, 0, 10));
+    }
+
+    // All the handlers become dirty together: the engine can take the first ones right away, the others are paced.
+    for (auto & readHandler : readHandlers)
+    {
+        readHandler->ForceDirtyState();
+    }
+    for (size_t i = 0; i < CHIP_IM_MAX_REPORTS_IN_FLIGHT; i++)
+    {
+        EXPECT_TRUE(sScheduler.IsReportableNow(readHandlers[i]));
+    }
+    ReadHandler * pacedHandler1 = readHandlers[CHIP_IM_MAX_REPORTS_IN_FLIGHT];
+    ReadHandler * pacedHandler2 = readHandlers[CHIP_IM_MAX_REPORTS_IN_FLIGHT + 1];
+    EXPECT_FALSE(sScheduler.IsReportableNow(pacedHandler1));
+    EXPECT_FALSE(sScheduler.IsReportableNow(pacedHandler2));
+    EXPECT_EQ(sScheduler.GetMinTimestampForHandler(pacedHandler1), Milliseconds64(100));
+    EXPECT_EQ(sScheduler.GetMinTimestampForHandler(pacedHandler2), Milliseconds64(200));
+
+    // Becoming dirty again does not push a paced report further.
+    pacedHandler1->ClearForceDirtyFlag();
+    pacedHandler1->ForceDirtyState();
+    EXPECT_EQ(sScheduler.GetMinTimestampForHandler(pacedHandler1), Milliseconds64(100));
+
+    // Paced reports are released one pacing interval after the other.
+    sTestTimerDelegate.IncrementMockTimestamp(Milliseconds64(100));
+    EXPECT_TRUE(sScheduler.IsReportableNow(pacedHandler1));
+    EXPECT_FALSE(sScheduler.IsReportableNow(pacedHandler2));
+    sTestTimerDelegate.IncrementMockTimestamp(Milliseconds64(100));
+    EXPECT_TRUE(sScheduler.IsReportableNow(pacedHandler2));
+
+    // The latency of a report is measured from the moment it was due.
+    for (auto & readHandler : readHandlers)
+    {
+        readHandler->ClearForceDirtyFlag();
+    }
+    sScheduler.OnSubscriptionReportSent(readHandlers[0]);
+    sScheduler.OnSubscriptionReportSent(pacedHandler2);
+    EXPECT_EQ(sScheduler.GetSchedulingLatencyStats().reportCount, 2u);
+    EXPECT_EQ(sScheduler.GetSchedulingLatencyStats().maxLatency, System::Clock::Milliseconds32(200));
+    EXPECT_EQ(sScheduler.GetSchedulingLatencyStats().totalLatency, Milliseconds64(400));
+
+    // Once sent, a report is no longer paced.
+    EXPECT_EQ(sScheduler.GetReadHandlerNode(pacedHandler2)->GetPacingEndTimestamp(), System::Clock::kZero);
+
+    // Clean up
+    sScheduler.SetPacingInterval(System::Clock::Milliseconds32(0));
+    sScheduler.UnregisterAllHandlers();
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
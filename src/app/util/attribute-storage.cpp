@@ -29,6 +29,7 @@
 #include <app/util/ember-io-storage.h>
 #include <app/util/ember-strings.h>
 #include <app/util/endpoint-config-api.h>
+#include <app/util/endpoint-index.h>
 #include <app/util/generic-callbacks.h>
 #include <data-model-providers/codegen/CodegenDataModelProvider.h>
 #include <lib/core/CHIPConfig.h>
@@ -89,6 +90,9 @@ namespace {
 
 uint16_t emberEndpointCount = 0;
 
+/// Index of emAfEndpoints by endpoint id, kept in sync with the endpoint ids of the table.
+EndpointIndex<MAX_ENDPOINT_COUNT> emberEndpointIndex;
+
 /// Determines a incremental unique index for ember
 /// metadata that is increased whenever a structural change is made to the
 /// ember metadata (e.g. changing dynamic endpoints or enabling/disabling endpoints)
@@ -149,21 +153,18 @@ bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
 
 uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
 {
-    if (endpoint == kInvalidEndpointId)
-    {
-        return kEmberInvalidEndpointIndex;
-    }
+    return emberEndpointIndex.Find(endpoint, [ignoreDisabledEndpoints](uint16_t epi) {
+        return epi < emberAfEndpointCount() &&
+            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled));
+    });
+}
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
-    {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
-        {
-            return epi;
-        }
-    }
-    return kEmberInvalidEndpointIndex;
+// Sets the endpoint id of the endpoint at the given index, keeping the index up to date.
+void setEndpointId(uint16_t index, EndpointId endpoint)
+{
+    emberEndpointIndex.Remove(emAfEndpoints[index].endpoint, index);
+    emAfEndpoints[index].endpoint = endpoint;
+    emberEndpointIndex.Insert(endpoint, index);
 }
 
 // Returns the index of a given endpoint.  Considers disabled endpoints.
@@ -198,6 +199,7 @@ void emberAfEndpointConfigure()
     uint16_t ep;
 
     emberEndpointCount = FIXED_ENDPOINT_COUNT;
+    emberEndpointIndex.Clear();
 
 #if FIXED_ENDPOINT_COUNT > 0
 
@@ -227,6 +229,7 @@ void emberAfEndpointConfigure()
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
         emAfEndpoints[ep].endpoint = fixedEndpoints[ep];
+        emberEndpointIndex.Insert(fixedEndpoints[ep], ep);
         emAfEndpoints[ep].deviceTypeList =
             Span<const EmberAfDeviceType>(&fixedDeviceTypeList[fixedDeviceTypeListOffsets[ep]], fixedDeviceTypeListLengths[ep]);
         emAfEndpoints[ep].endpointType     = &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
@@ -279,20 +282,12 @@ void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
 
 uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
 {
-    if (id == kInvalidEndpointId)
+    uint16_t index = emberEndpointIndex.Find(id, [](uint16_t epi) { return epi >= FIXED_ENDPOINT_COUNT; });
+    if (index == kEmberInvalidEndpointIndex)
     {
         return kEmberInvalidEndpointIndex;
     }
-
-    uint16_t index;
-    for (index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
-    {
-        if (emAfEndpoints[index].endpoint == id)
-        {
-            return static_cast<uint16_t>(index - FIXED_ENDPOINT_COUNT);
-        }
-    }
-    return kEmberInvalidEndpointIndex;
+    return static_cast<uint16_t>(index - FIXED_ENDPOINT_COUNT);
 }
 
 CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberAfEndpointType * ep,
@@ -325,12 +320,9 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
     }
 
     index = static_cast<uint16_t>(realIndex);
-    for (uint16_t i = FIXED_ENDPOINT_COUNT; i < MAX_ENDPOINT_COUNT; i++)
+    if (emberAfGetDynamicIndexFromEndpoint(id) != kEmberInvalidEndpointIndex)
     {
-        if (emAfEndpoints[i].endpoint == id)
-        {
-            return CHIP_ERROR_ENDPOINT_EXISTS;
-        }
+        return CHIP_ERROR_ENDPOINT_EXISTS;
     }
 
     const size_t bufferSize = Compatibility::Internal::gEmberAttributeIOBufferSpan.size();
@@ -357,7 +349,7 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
             }
         }
     }
-    emAfEndpoints[index].endpoint       = id;
+    setEndpointId(index, id);
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
     emAfEndpoints[index].dataVersions   = dataVersionStorage.data();
@@ -409,7 +401,7 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index, MatterClusterShutdownType
     {
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false, shutdownType);
-        emAfEndpoints[index].endpoint = kInvalidEndpointId;
+        setEndpointId(index, kInvalidEndpointId);
     }
 
     emberMetadataStructureGeneration++;
@@ -662,121 +654,111 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
+    uint16_t ep = emberAfIndexFromEndpoint(attRecord->endpoint);
+    if (ep == kEmberInvalidEndpointIndex)
+    {
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
+
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
 
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    // Dynamic endpoints are external and don't factor into storage size
+    uint16_t attributeOffsetIndex = 0;
+    for (uint16_t i = 0; i < ep && i < emberAfFixedEndpointCount(); i++)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[i].endpointType->endpointSize);
+    }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, attRecord))
+        { // Got the cluster
+            uint16_t attrIndex;
+            for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
             {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+                const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                { // Got the attribute
+                    // If passed metadata location is not null, populate
+                    if (metadata != nullptr)
                     {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
-
-                            uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
-                            uint8_t *src, *dst;
-                            if (write)
-                            {
-                                src = buffer;
-                                dst = attributeLocation;
-                                if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                         am->attributeId))
-                                {
-                                    return Status::UnsupportedAccess;
-                                }
-                            }
-                            else
-                            {
-                                if (buffer == nullptr)
-                                {
-                                    return Status::Success;
-                                }
-
-                                src = attributeLocation;
-                                dst = buffer;
-                                if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
-                                {
-                                    return Status::UnsupportedAccess;
-                                }
-                            }
+                        *metadata = am;
+                    }
 
-                            // Is the attribute externally stored?
-                            if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
-                            {
-                                if (write)
-                                {
-                                    return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                 buffer);
-                                }
-
-                                if (readLength < emberAfAttributeSize(am))
-                                {
-                                    // Prevent a potential buffer overflow
-                                    return Status::ResourceExhausted;
-                                }
-
-                                return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
-                                                                            emberAfAttributeSize(am));
-                            }
+                    uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
+                    uint8_t *src, *dst;
+                    if (write)
+                    {
+                        src = buffer;
+                        dst = attributeLocation;
+                        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                        {
+                            return Status::UnsupportedAccess;
+                        }
+                    }
+                    else
+                    {
+                        if (buffer == nullptr)
+                        {
+                            return Status::Success;
+                        }
 
-                            // Internal storage is only supported for fixed endpoints
-                            if (!isDynamicEndpoint)
-                            {
-                                return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                            }
+                        src = attributeLocation;
+                        dst = buffer;
+                        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                        {
+                            return Status::UnsupportedAccess;
+                        }
+                    }
 
-                            return Status::Failure;
+                    // Is the attribute externally stored?
+                    if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
+                    {
+                        if (write)
+                        {
+                            return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer);
                         }
 
-                        // Not the attribute we are looking for
-                        // Increase the index if attribute is not externally stored
-                        if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                        if (readLength < emberAfAttributeSize(am))
                         {
-                            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                            // Prevent a potential buffer overflow
+                            return Status::ResourceExhausted;
                         }
+
+                        return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                                    emberAfAttributeSize(am));
                     }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
+                    // Internal storage is only supported for fixed endpoints
+                    if (!isDynamicEndpoint)
+                    {
+                        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+                    }
+
+                    return Status::Failure;
                 }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+                // Not the attribute we are looking for
+                // Increase the index if attribute is not externally stored
+                if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                {
+                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                }
             }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
+            // Attribute is not in the cluster.
+            return Status::UnsupportedAttribute;
         }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
-        {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
-        }
+        // Not the cluster we are looking for
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    // Cluster is not in the endpoint.
+    return Status::UnsupportedCluster;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
@@ -820,21 +802,20 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
 
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    // Only endpoints with a matching endpoint id are examined, so the endpoint types of endpoints that are not
+    // actually defined are never looked at.
+    uint16_t ep = emberEndpointIndex.Find(endpoint, [&](uint16_t epi) {
+        return epi < emberAfEndpointCount() &&
+            emberAfFindClusterInType(emAfEndpoints[epi].endpointType, clusterId, mask) != nullptr;
+    });
+    if (ep == kEmberInvalidEndpointIndex)
     {
-        // Check the endpoint id first, because that way we avoid examining the
-        // endpoint type for endpoints that are not actually defined.
-        if (emAfEndpoints[ep].endpoint == endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t index                            = 0xFF;
-            if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
-            {
-                return index;
-            }
-        }
+        return 0xFF;
     }
-    return 0xFF;
+
+    uint8_t index = 0xFF;
+    emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, mask, &index);
+    return index;
 }
 
 // Returns whether the given endpoint has the server of the given cluster on it.
@@ -0,0 +1,163 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/FibonacciHash.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * Maps endpoint IDs to their indices in the ember endpoint table, so that an endpoint is found without walking
+ * the whole table.
+ *
+ * This is an open-addressing hash table with linear probing, sized to at least twice the number of endpoints so
+ * that probe sequences stay short. The same endpoint ID may be present at several indices (e.g. a disabled
+ * endpoint and an enabled one), and lookups return the lowest matching index, like a walk of the table would.
+ *
+ * @tparam kMaxEndpoints  Number of entries of the endpoint table.
+ */
+template <size_t kMaxEndpoints>
+class EndpointIndex
+{
+public:
+    static constexpr uint16_t kInvalidIndex = 0xFFFF;
+
+    EndpointIndex() { Clear(); }
+
+    void Clear()
+    {
+        for (auto & slot : mSlots)
+        {
+            slot = Slot();
+        }
+    }
+
+    /**
+     * Record that the endpoint table has @a endpoint at @a index.
+     */
+    void Insert(EndpointId endpoint, uint16_t index)
+    {
+        if (endpoint == kInvalidEndpointId)
+        {
+            return;
+        }
+
+        size_t slot = Home(endpoint);
+        while (mSlots[slot].index != kInvalidIndex)
+        {
+            if (mSlots[slot].endpoint == endpoint && mSlots[slot].index == index)
+            {
+                return;
+            }
+            slot = Next(slot);
+        }
+        mSlots[slot] = Slot{ endpoint, index };
+    }
+
+    /**
+     * Record that the endpoint table no longer has @a endpoint at @a index.
+     */
+    void Remove(EndpointId endpoint, uint16_t index)
+    {
+        if (endpoint == kInvalidEndpointId)
+        {
+            return;
+        }
+
+        size_t slot = Home(endpoint);
+        while (mSlots[slot].index != kInvalidIndex && !(mSlots[slot].endpoint == endpoint && mSlots[slot].index == index))
+        {
+            slot = Next(slot);
+        }
+        if (mSlots[slot].index == kInvalidIndex)
+        {
+            return;
+        }
+
+        // Shift the following entries of the probe sequence back, so that no lookup stops early at the hole.
+        size_t hole = slot;
+        for (size_t next = Next(hole); mSlots[next].index != kInvalidIndex; next = Next(next))
+        {
+            const size_t home = Home(mSlots[next].endpoint);
+            // The entry can fill the hole only if its home is not cyclically between the hole and the entry.
+            const bool homeAfterHole = (hole <= next) ? (hole < home && home <= next) : (hole < home || home <= next);
+            if (!homeAfterHole)
+            {
+                mSlots[hole] = mSlots[next];
+                hole         = next;
+            }
+        }
+        mSlots[hole] = Slot();
+    }
+
+    /**
+     * Returns the lowest index of @a endpoint for which @a predicate(index) is true, or kInvalidIndex.
+     */
+    template <typename Predicate>
+    uint16_t Find(EndpointId endpoint, Predicate && predicate) const
+    {
+        uint16_t found = kInvalidIndex;
+        if (endpoint == kInvalidEndpointId)
+        {
+            return found;
+        }
+
+        for (size_t slot = Home(endpoint); mSlots[slot].index != kInvalidIndex; slot = Next(slot))
+        {
+            if (mSlots[slot].endpoint == endpoint && mSlots[slot].index < found && predicate(mSlots[slot].index))
+            {
+                found = mSlots[slot].index;
+            }
+        }
+        return found;
+    }
+
+private:
+    static constexpr size_t TableSize()
+    {
+        size_t size = 1;
+        while (size < 2 * kMaxEndpoints)
+        {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    static constexpr size_t kTableSize = TableSize();
+
+    struct Slot
+    {
+        EndpointId endpoint = kInvalidEndpointId;
+        uint16_t index      = kInvalidIndex;
+    };
+
+    static size_t Home(EndpointId endpoint) { return FibonacciHashIndex(endpoint, kTableSize); }
+
+    static size_t Next(size_t slot) { return (slot + 1) & (kTableSize - 1); }
+
+    // Always has empty slots, since it is at least twice as large as the endpoint table.
+    Slot mSlots[kTableSize];
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,187 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(memory_sanitizer) || __has_feature(thread_sanitizer)
+#define CHIP_BENCHMARK_SANITIZER 1
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define CHIP_BENCHMARK_SANITIZER 1
+#endif
+
+// Count allocations by interposing the glibc allocator entry points, which both
+// Platform::MemoryAlloc and the default operator new end up in. Sanitizers provide
+// their own allocator, so counting is disabled for those builds.
+#if defined(__GLIBC__) && !defined(CHIP_BENCHMARK_SANITIZER)
+#define CHIP_BENCHMARK_COUNT_ALLOCATIONS 1
+#else
+#define CHIP_BENCHMARK_COUNT_ALLOCATIONS 0
+#endif
+
+namespace {
+
+std::atomic<uint64_t> gAllocationCount{ 0 };
+
+} // namespace
+
+#if CHIP_BENCHMARK_COUNT_ALLOCATIONS
+
+extern "C" {
+
+void * __libc_malloc(size_t size);
+void * __libc_calloc(size_t count, size_t size);
+void * __libc_realloc(void * ptr, size_t size);
+
+void * malloc(size_t size)
+{
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void * calloc(size_t count, size_t size)
+{
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void * realloc(void * ptr, size_t size)
+{
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+
+} // extern "C"
+
+#endif // CHIP_BENCHMARK_COUNT_ALLOCATIONS
+
+namespace chip {
+namespace Benchmark {
+
+namespace {
+
+std::vector<Result> & RecordedResults()
+{
+    static std::vector<Result> sResults;
+    return sResults;
+}
+
+void WriteJsonString(FILE * file, const char * str)
+{
+    fputc('"', file);
+    for (const char * p = str; *p != '\0'; p++)
+    {
+        if (*p == '"' || *p == '\\')
+        {
+            fputc('\\', file);
+        }
+        fputc(*p, file);
+    }
+    fputc('"', file);
+}
+
+} // namespace
+
+bool AllocationCountingEnabled()
+{
+    return CHIP_BENCHMARK_COUNT_ALLOCATIONS;
+}
+
+uint64_t AllocationCount()
+{
+    return gAllocationCount.load(std::memory_order_relaxed);
+}
+
+void Record(const Result & result)
+{
+    if (result.allocsPerOp >= 0)
+    {
+        ChipLogProgress(Test, "%-48s %12.1f ns/op %8.2f allocs/op (%llu iterations)", result.name, result.nsPerOp,
+                        result.allocsPerOp, static_cast<unsigned long long>(result.iterations));
+    }
+    else
+    {
+        ChipLogProgress(Test, "%-48s %12.1f ns/op (%llu iterations)", result.name, result.nsPerOp,
+                        static_cast<unsigned long long>(result.iterations));
+    }
+    RecordedResults().push_back(result);
+}
+
+bool WriteResults(const char * suiteName)
+{
+    std::vector<Result> results;
+    results.swap(RecordedResults());
+
+    const char * outputDir = getenv("CHIP_BENCHMARK_OUTPUT_DIR");
+    if (outputDir == nullptr || *outputDir == '\0')
+    {
+        return true;
+    }
+
+    const std::string path = std::string(outputDir) + "/" + suiteName + ".json";
+    FILE * file            = fopen(path.c_str(), "w");
+    if (file == nullptr)
+    {
+        ChipLogError(Test, "Failed to open benchmark output %s", path.c_str());
+        return false;
+    }
+
+    fprintf(file, "{\n  \"suite\": ");
+    WriteJsonString(file, suiteName);
+    fprintf(file, ",\n  \"benchmarks\": [");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result & result = results[i];
+        fprintf(file, "%s\n    { \"name\": ", (i == 0) ? "" : ",");
+        WriteJsonString(file, result.name);
+        fprintf(file, ", \"iterations\": %llu, \"ns_per_op\": %.3f", static_cast<unsigned long long>(result.iterations),
+                result.nsPerOp);
+        if (result.allocsPerOp >= 0)
+        {
+            fprintf(file, ", \"allocs_per_op\": %.3f", result.allocsPerOp);
+        }
+        else
+        {
+            fprintf(file, ", \"allocs_per_op\": null");
+        }
+        fprintf(file, " }");
+    }
+    fprintf(file, "\n  ]\n}\n");
+
+    const bool ok = (ferror(file) == 0);
+    if (fclose(file) != 0 || !ok)
+    {
+        ChipLogError(Test, "Failed to write benchmark output %s", path.c_str());
+        return false;
+    }
+
+    ChipLogProgress(Test, "Wrote %u benchmark results to %s", static_cast<unsigned>(results.size()), path.c_str());
+    return true;
+}
+
+} // namespace Benchmark
+} // namespace chip
@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A minimal micro-benchmark harness for use from pw_unit_test based benchmark suites.
+ *
+ *      Each benchmark is a callable that performs one operation. Benchmark::Run() calls it in
+ *      batches of increasing size until a batch takes long enough to be measured reliably, and
+ *      records the time and number of heap allocations per operation. Recorded results are logged,
+ *      and can be written as JSON with Benchmark::WriteResults() so that they can be compared
+ *      between commits.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Benchmark {
+
+struct Result
+{
+    const char * name;
+    uint64_t iterations;
+    double nsPerOp;
+    // Heap allocations per operation, or a negative value if allocations cannot be counted in this build.
+    double allocsPerOp;
+};
+
+/**
+ * Minimum wall-clock duration of the measured batch of a benchmark.
+ */
+inline constexpr std::chrono::milliseconds kMinBatchDuration{ 200 };
+
+/**
+ * Upper bound on the number of iterations of a single benchmark.
+ */
+inline constexpr uint64_t kMaxIterations = 100'000'000;
+
+/**
+ * Whether heap allocations are being counted in this build (they are not, e.g., with sanitizers).
+ */
+bool AllocationCountingEnabled();
+
+/**
+ * Number of heap allocations made by this process so far, if AllocationCountingEnabled().
+ */
+uint64_t AllocationCount();
+
+/**
+ * Record a result, so it is included in the output of WriteResults(). Also logs it.
+ */
+void Record(const Result & result);
+
+/**
+ * Write all results recorded so far as JSON to `<dir>/<suiteName>.json` when the
+ * CHIP_BENCHMARK_OUTPUT_DIR environment variable names a directory `<dir>`, and
+ * forget them. Returns false if the file could not be written.
+ */
+bool WriteResults(const char * suiteName);
+
+/**
+ * Prevent the compiler from optimizing away the computation of @a value.
+ */
+template <typename T>
+inline void DoNotOptimize(const T & value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void * sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * Run @a op repeatedly and record the time and allocations per call under @a name.
+ *
+ * @a op must perform exactly one operation per call and return true on success. A failing
+ * operation stops the benchmark, and the result is not recorded.
+ *
+ * @return true if the benchmark completed and its result was recorded.
+ */
+template <typename Op>
+bool Run(const char * name, Op && op)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up caches and any lazily initialized state.
+    if (!op())
+    {
+        return false;
+    }
+
+    uint64_t iterations = 1;
+    while (true)
+    {
+        const uint64_t allocationsBefore = AllocationCount();
+        const Clock::time_point start    = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            if (!op())
+            {
+                return false;
+            }
+        }
+        const Clock::duration elapsed   = Clock::now() - start;
+        const uint64_t allocationsAfter = AllocationCount();
+
+        if (elapsed >= kMinBatchDuration || iterations >= kMaxIterations)
+        {
+            const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            Result result   = {
+                  name,
+                  iterations,
+                  ns / static_cast<double>(iterations),
+                  AllocationCountingEnabled()
+                      ? static_cast<double>(allocationsAfter - allocationsBefore) / static_cast<double>(iterations)
+                      : -1.0,
+            };
+            Record(result);
+            return true;
+        }
+
+        // Aim slightly past the minimum duration for the next batch, growing by at most 10x at a time.
+        const auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        uint64_t next        = iterations * 10;
+        if (elapsedNs > 0)
+        {
+            const auto targetNs = std::chrono::duration_cast<std::chrono::nanoseconds>(kMinBatchDuration).count() * 12 / 10;
+            const uint64_t estimate =
+                static_cast<uint64_t>(static_cast<double>(iterations) * static_cast<double>(targetNs) / static_cast<double>(elapsedNs));
+            next = (estimate < next) ? estimate : next;
+        }
+        iterations = (next > iterations) ? next : iterations + 1;
+        iterations = (iterations < kMaxIterations) ? iterations : kMaxIterations;
+    }
+}
+
+} // namespace Benchmark
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for AccessControl::Check with a fabric holding as many ACL entries as the
+ *      example delegate allows, as done for every attribute path of a wildcard read.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <access/AccessControl.h>
+#include <access/examples/ExampleAccessControlDelegate.h>
+#include <benchmarks/Benchmark.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+using namespace chip;
+using namespace chip::Access;
+
+namespace {
+
+using Entry  = AccessControl::Entry;
+using Target = Entry::Target;
+
+constexpr FabricIndex kFabric       = 1;
+constexpr EndpointId kEndpoints     = 256;
+constexpr ClusterId kOnOffCluster   = 0x0006;
+constexpr NodeId kAdminNode         = 0x1001;
+constexpr NodeId kControllerNodes[] = { 0x2001, 0x2002, 0x2003, 0x2004 };
+constexpr NodeId kViewerNodes[]     = { 0x3001, 0x3002, 0x3003 };
+constexpr NodeId kUnknownNode       = 0x4001;
+
+class NoDeviceTypes : public AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} gDeviceTypeResolver;
+
+AccessControl gAccessControl;
+
+CHIP_ERROR AddEntry(Privilege privilege, AuthMode authMode, std::initializer_list<NodeId> subjects,
+                    std::initializer_list<Target> targets)
+{
+    Entry entry;
+    ReturnErrorOnFailure(gAccessControl.PrepareEntry(entry));
+    ReturnErrorOnFailure(entry.SetFabricIndex(kFabric));
+    ReturnErrorOnFailure(entry.SetPrivilege(privilege));
+    ReturnErrorOnFailure(entry.SetAuthMode(authMode));
+    for (NodeId subject : subjects)
+    {
+        ReturnErrorOnFailure(entry.AddSubject(nullptr, subject));
+    }
+    for (const Target & target : targets)
+    {
+        ReturnErrorOnFailure(entry.AddTarget(nullptr, target));
+    }
+    return gAccessControl.CreateEntry(nullptr, kFabric, nullptr, entry);
+}
+
+class BenchmarkAccessControl : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        // Every check is logged at progress level, which would dominate the measurement.
+        Logging::SetLogFilter(Logging::kLogCategory_Error);
+        ASSERT_EQ(gAccessControl.Init(Examples::GetAccessControlDelegate(), gDeviceTypeResolver), CHIP_NO_ERROR);
+
+        // The checked subjects are granted access by the last entry.
+        ASSERT_EQ(AddEntry(Privilege::kAdminister, AuthMode::kCase, { kAdminNode }, {}), CHIP_NO_ERROR);
+        ASSERT_EQ(AddEntry(Privilege::kOperate, AuthMode::kCase,
+                           { kControllerNodes[0], kControllerNodes[1], kControllerNodes[2], kControllerNodes[3] },
+                           { Target{ Target::kCluster, 0x0008, 0, 0 }, Target{ Target::kCluster, 0x0300, 0, 0 },
+                             Target{ Target::kCluster, 0x0005, 0, 0 } }),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(AddEntry(Privilege::kOperate, AuthMode::kGroup,
+                           { NodeIdFromGroupId(1), NodeIdFromGroupId(2), NodeIdFromGroupId(3), NodeIdFromGroupId(4) },
+                           { Target{ Target::kEndpoint, 0, 1, 0 }, Target{ Target::kEndpoint, 0, 2, 0 },
+                             Target{ Target::kEndpoint, 0, 3, 0 } }),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(AddEntry(Privilege::kView, AuthMode::kCase, { kViewerNodes[0], kViewerNodes[1], kViewerNodes[2] },
+                           { Target{ Target::kCluster, 0x001D, 0, 0 }, Target{ Target::kCluster, 0x0028, 0, 0 },
+                             Target{ Target::kCluster, kOnOffCluster, 0, 0 } }),
+                  CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        EXPECT_TRUE(Benchmark::WriteResults("BenchmarkAccessControl"));
+        EXPECT_EQ(gAccessControl.DeleteAllEntriesForFabric(kFabric), CHIP_NO_ERROR);
+        gAccessControl.Finish();
+        Logging::SetLogFilter(Logging::kLogCategory_Max);
+        Platform::MemoryShutdown();
+    }
+};
+
+SubjectDescriptor CaseSubject(NodeId node)
+{
+    return SubjectDescriptor{ .fabricIndex = kFabric, .authMode = AuthMode::kCase, .subject = node };
+}
+
+RequestPath OnOffPath(EndpointId endpoint)
+{
+    return RequestPath{ .cluster = kOnOffCluster, .endpoint = endpoint, .requestType = RequestType::kAttributeReadRequest };
+}
+
+// A wildcard read checks every endpoint in turn.
+TEST_F(BenchmarkAccessControl, CheckAllowedAcrossEndpoints)
+{
+    const SubjectDescriptor subject = CaseSubject(kViewerNodes[2]);
+    EndpointId endpoint             = 0;
+    EXPECT_TRUE(Benchmark::Run("AccessControl::Check(allowed, 256 endpoints)", [&]() {
+        endpoint = static_cast<EndpointId>((endpoint + 1) % kEndpoints);
+        return gAccessControl.Check(subject, OnOffPath(endpoint), Privilege::kView) == CHIP_NO_ERROR;
+    }));
+}
+
+TEST_F(BenchmarkAccessControl, CheckDeniedAcrossEndpoints)
+{
+    const SubjectDescriptor subject = CaseSubject(kUnknownNode);
+    EndpointId endpoint             = 0;
+    EXPECT_TRUE(Benchmark::Run("AccessControl::Check(denied, 256 endpoints)", [&]() {
+        endpoint = static_cast<EndpointId>((endpoint + 1) % kEndpoints);
+        return gAccessControl.Check(subject, OnOffPath(endpoint), Privilege::kView) == CHIP_ERROR_ACCESS_DENIED;
+    }));
+}
+
+// The attributes of a cluster are checked one after the other against the same cluster path.
+TEST_F(BenchmarkAccessControl, CheckSamePath)
+{
+    const SubjectDescriptor subject = CaseSubject(kViewerNodes[2]);
+    EXPECT_TRUE(Benchmark::Run("AccessControl::Check(allowed, same path)", [&]() {
+        return gAccessControl.Check(subject, OnOffPath(1), Privilege::kView) == CHIP_NO_ERROR;
+    }));
+}
+
+} // namespace
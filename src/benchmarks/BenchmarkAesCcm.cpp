@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for AES_CCM_encrypt/AES_CCM_decrypt with session keys, as used for every secure
+ *      message. The number of messages per second on one core is 1e9 / ns_per_op.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <benchmarks/Benchmark.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+// A typical small Interaction Model payload size.
+constexpr size_t kPayloadLength = 64;
+const uint8_t kPayload[kPayloadLength] = { 0x15, 0x36, 0x01, 0x15, 0x35, 0x01, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00 };
+const uint8_t kAad[]                   = { 0x00, 0x34, 0x12, 0x04, 0x03, 0x02, 0x01, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11 };
+const uint8_t kNonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES] = { 0x00, 0x04, 0x03, 0x02, 0x01, 0x88, 0x77,
+                                                              0x66, 0x55, 0x44, 0x33, 0x22, 0x11 };
+
+// Number of sessions used concurrently by the interleaved benchmark.
+constexpr size_t kSessionCount = 8;
+
+class BenchmarkAesCcm : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite()
+    {
+        EXPECT_TRUE(Benchmark::WriteResults("BenchmarkAesCcm"));
+        chip::Platform::MemoryShutdown();
+    }
+};
+
+// Session keys created by a session keystore, as CryptoContext creates them, and destroyed with it.
+struct SessionKeys
+{
+    CHIP_ERROR Init()
+    {
+        for (size_t i = 0; i < kSessionCount; i++)
+        {
+            Symmetric128BitsKeyByteArray keyMaterial;
+            memset(keyMaterial, static_cast<int>(0x40 + i), sizeof(keyMaterial));
+            ReturnErrorOnFailure(keystore.CreateKey(keyMaterial, keys[i]));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    ~SessionKeys()
+    {
+        for (auto & key : keys)
+        {
+            keystore.DestroyKey(key);
+        }
+    }
+
+    DefaultSessionKeystore keystore;
+    Aes128KeyHandle keys[kSessionCount];
+};
+
+TEST_F(BenchmarkAesCcm, Encrypt)
+{
+    SessionKeys sessionKeys;
+    ASSERT_EQ(sessionKeys.Init(), CHIP_NO_ERROR);
+    uint8_t ciphertext[kPayloadLength];
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+
+    EXPECT_TRUE(Benchmark::Run("AES_CCM_encrypt(64 bytes)", [&]() {
+        bool ok = (AES_CCM_encrypt(kPayload, sizeof(kPayload), kAad, sizeof(kAad), sessionKeys.keys[0], kNonce, sizeof(kNonce),
+                                   ciphertext, tag, sizeof(tag)) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(tag);
+        return ok;
+    }));
+}
+
+TEST_F(BenchmarkAesCcm, Decrypt)
+{
+    SessionKeys sessionKeys;
+    ASSERT_EQ(sessionKeys.Init(), CHIP_NO_ERROR);
+    uint8_t ciphertext[kPayloadLength];
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+    uint8_t plaintext[kPayloadLength];
+    ASSERT_EQ(AES_CCM_encrypt(kPayload, sizeof(kPayload), kAad, sizeof(kAad), sessionKeys.keys[0], kNonce, sizeof(kNonce),
+                              ciphertext, tag, sizeof(tag)),
+              CHIP_NO_ERROR);
+
+    EXPECT_TRUE(Benchmark::Run("AES_CCM_decrypt(64 bytes)", [&]() {
+        bool ok = (AES_CCM_decrypt(ciphertext, sizeof(ciphertext), kAad, sizeof(kAad), tag, sizeof(tag), sessionKeys.keys[0],
+                                   kNonce, sizeof(kNonce), plaintext) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(plaintext);
+        return ok;
+    }));
+}
+
+TEST_F(BenchmarkAesCcm, EncryptInterleavedSessions)
+{
+    SessionKeys sessionKeys;
+    ASSERT_EQ(sessionKeys.Init(), CHIP_NO_ERROR);
+    uint8_t ciphertext[kPayloadLength];
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+    size_t session = 0;
+
+    // Messages of several sessions, each with its own key, one after the other.
+    EXPECT_TRUE(Benchmark::Run("AES_CCM_encrypt(64 bytes, 8 sessions)", [&]() {
+        session = (session + 1) % kSessionCount;
+        bool ok = (AES_CCM_encrypt(kPayload, sizeof(kPayload), kAad, sizeof(kAad), sessionKeys.keys[session], kNonce,
+                                   sizeof(kNonce), ciphertext, tag, sizeof(tag)) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(tag);
+        return ok;
+    }));
+}
+
+} // namespace
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for a ClusterStateCache holding a wildcard subscription to a bridge: caching the
+ *      priming report, caching a report that changes every attribute, and reading the cache back.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/ClusterStateCache.h>
+#include <benchmarks/Benchmark.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <memory>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr EndpointId kEndpoints             = 64;
+constexpr ClusterId kClusters[]             = { 0x0003, 0x0006, 0x0008, 0x001D };
+constexpr AttributeId kAttributesPerCluster = 8;
+constexpr size_t kAttributeCount            = kEndpoints * MATTER_ARRAY_SIZE(kClusters) * kAttributesPerCluster;
+
+class BenchmarkClusterStateCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite()
+    {
+        EXPECT_TRUE(Benchmark::WriteResults("BenchmarkClusterStateCache"));
+        chip::Platform::MemoryShutdown();
+    }
+};
+
+class NullCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+// Sends a report of every attribute of the bridge through @a callback, as a ReadClient would. Even attributes are
+// integers, odd ones are strings.
+CHIP_ERROR SendReport(ReadClient::Callback & callback, uint32_t generation)
+{
+    static const char kLabel[] = "Bridged light label";
+
+    callback.OnReportBegin();
+    for (EndpointId endpoint = 1; endpoint <= kEndpoints; endpoint++)
+    {
+        for (ClusterId cluster : kClusters)
+        {
+            for (AttributeId attribute = 0; attribute < kAttributesPerCluster; attribute++)
+            {
+                uint8_t buffer[64];
+                TLV::TLVWriter writer;
+                writer.Init(buffer);
+                if (attribute % 2 == 0)
+                {
+                    ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), generation + attribute));
+                }
+                else
+                {
+                    ReturnErrorOnFailure(writer.PutString(TLV::AnonymousTag(), kLabel));
+                }
+                ReturnErrorOnFailure(writer.Finalize());
+
+                TLV::TLVReader reader;
+                reader.Init(buffer, writer.GetLengthWritten());
+                ReturnErrorOnFailure(reader.Next());
+
+                ConcreteDataAttributePath path(endpoint, cluster, attribute);
+                path.mDataVersion.SetValue(generation);
+                callback.OnAttributeData(path, &reader, StatusIB());
+            }
+        }
+    }
+    callback.OnReportEnd();
+    return CHIP_NO_ERROR;
+}
+
+TEST_F(BenchmarkClusterStateCache, CachePrimingReport)
+{
+    NullCallback callback;
+    EXPECT_TRUE(Benchmark::Run("ClusterStateCache: cache priming report (2048 attributes)", [&]() {
+        auto cache = std::make_unique<ClusterStateCache>(callback);
+        return SendReport(cache->GetBufferedCallback(), 1) == CHIP_NO_ERROR;
+    }));
+}
+
+TEST_F(BenchmarkClusterStateCache, CacheChangedReport)
+{
+    NullCallback callback;
+    auto cache = std::make_unique<ClusterStateCache>(callback);
+    ASSERT_EQ(SendReport(cache->GetBufferedCallback(), 1), CHIP_NO_ERROR);
+
+    uint32_t generation = 2;
+    EXPECT_TRUE(Benchmark::Run("ClusterStateCache: cache changed report (2048 attributes)",
+                               [&]() { return SendReport(cache->GetBufferedCallback(), generation++) == CHIP_NO_ERROR; }));
+}
+
+TEST_F(BenchmarkClusterStateCache, ForEachAttribute)
+{
+    NullCallback callback;
+    auto cache = std::make_unique<ClusterStateCache>(callback);
+    ASSERT_EQ(SendReport(cache->GetBufferedCallback(), 1), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(Benchmark::Run("ClusterStateCache::ForEachAttribute(2048 attributes)", [&]() {
+        size_t count   = 0;
+        CHIP_ERROR err = cache->ForEachAttribute([&](const ConcreteAttributePath & path) {
+            Benchmark::DoNotOptimize(path);
+            count++;
+            return CHIP_NO_ERROR;
+        });
+        return err == CHIP_NO_ERROR && count == kAttributeCount;
+    }));
+}
+
+TEST_F(BenchmarkClusterStateCache, GetAttribute)
+{
+    NullCallback callback;
+    auto cache = std::make_unique<ClusterStateCache>(callback);
+    ASSERT_EQ(SendReport(cache->GetBufferedCallback(), 1), CHIP_NO_ERROR);
+
+    uint32_t i = 0;
+    EXPECT_TRUE(Benchmark::Run("ClusterStateCache::Get(path, reader)", [&]() {
+        const ConcreteAttributePath path(static_cast<EndpointId>(i % kEndpoints + 1), kClusters[i % MATTER_ARRAY_SIZE(kClusters)],
+                                         (i / kEndpoints) % kAttributesPerCluster);
+        i++;
+        TLV::TLVReader reader;
+        return cache->Get(path, reader) == CHIP_NO_ERROR;
+    }));
+}
+
+} // namespace
@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for the reporting engine dirty set when an attribute changes on every endpoint of a
+ *      large bridge: marking the paths dirty, and looking up whether a read path is dirty.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/DirtyPathSet.h>
+#include <benchmarks/Benchmark.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/Pool.h>
+
+#include <memory>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+constexpr EndpointId kBridgedEndpoints = 256;
+constexpr ClusterId kOnOffCluster      = 0x0006;
+
+using BridgeDirtyPathSet = DirtyPathSet<kBridgedEndpoints, 64, ObjectPoolMem::kInline>;
+
+class BenchmarkDirtyPathSet : public ::testing::Test
+{
+public:
+    static void TearDownTestSuite() { EXPECT_TRUE(Benchmark::WriteResults("BenchmarkDirtyPathSet")); }
+};
+
+AttributePathParams BridgedPath(EndpointId endpoint)
+{
+    return AttributePathParams(static_cast<EndpointId>(endpoint + 1), kOnOffCluster, 0);
+}
+
+// What Engine::InsertPathIntoDirtySet does for a path that does not overlap any dirty path.
+bool MarkDirty(BridgeDirtyPathSet & set, const AttributePathParams & path)
+{
+    auto merge = [](auto *) { return Loop::Break; };
+    if (set.ForEachPathCovering(path, merge) == Loop::Break || set.ForEachPathCoveredBy(path, merge) == Loop::Break)
+    {
+        return true;
+    }
+    return set.CreatePath(path, AttributeGeneration(1)) != nullptr;
+}
+
+TEST_F(BenchmarkDirtyPathSet, MarkAllEndpointsDirty)
+{
+    auto set = std::make_unique<BridgeDirtyPathSet>();
+    EXPECT_TRUE(Benchmark::Run("DirtyPathSet: mark 256 endpoints dirty", [&]() {
+        bool ok = true;
+        for (EndpointId endpoint = 0; endpoint < kBridgedEndpoints; endpoint++)
+        {
+            ok = ok && MarkDirty(*set, BridgedPath(endpoint));
+        }
+        ok = ok && (set->Allocated() == kBridgedEndpoints);
+        set->ReleaseAll();
+        return ok;
+    }));
+}
+
+// A subscription to the whole bridge checks every attribute path it reports against the dirty set.
+TEST_F(BenchmarkDirtyPathSet, IsReadPathDirty)
+{
+    auto set = std::make_unique<BridgeDirtyPathSet>();
+    for (EndpointId endpoint = 0; endpoint < kBridgedEndpoints; endpoint++)
+    {
+        ASSERT_TRUE(MarkDirty(*set, BridgedPath(endpoint)));
+    }
+
+    EndpointId endpoint = 0;
+    EXPECT_TRUE(Benchmark::Run("DirtyPathSet::ForEachPathCovering(256 paths)", [&]() {
+        const ConcreteAttributePath readPath(static_cast<EndpointId>(endpoint % kBridgedEndpoints + 1), kOnOffCluster,
+                                             static_cast<AttributeId>(endpoint % 2));
+        endpoint++;
+        bool dirty = false;
+        set->ForEachPathCovering(readPath, [&](auto *) {
+            dirty = true;
+            return Loop::Break;
+        });
+        Benchmark::DoNotOptimize(dirty);
+        return true;
+    }));
+    set->ReleaseAll();
+}
+
+} // namespace
@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for the ExchangeManager lookup of the exchange a received message belongs to,
+ *      with a varying number of open exchanges.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <benchmarks/Benchmark.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/secure_channel/Constants.h>
+#include <transport/SessionMessageDelegate.h>
+#include <transport/raw/MessageHeader.h>
+
+using namespace chip;
+using namespace chip::Messaging;
+
+namespace {
+
+class BenchmarkExchangeLookup : public chip::Testing::LoopbackMessagingContext
+{
+public:
+    static void SetUpTestSuite()
+    {
+        chip::Testing::LoopbackMessagingContext::SetUpTestSuite();
+        // Every received message is logged at progress level, which would dominate the measurement.
+        Logging::SetLogFilter(Logging::kLogCategory_Error);
+    }
+
+    static void TearDownTestSuite()
+    {
+        EXPECT_TRUE(Benchmark::WriteResults("BenchmarkExchangeLookup"));
+        Logging::SetLogFilter(Logging::kLogCategory_Max);
+        chip::Testing::LoopbackMessagingContext::TearDownTestSuite();
+    }
+
+    // Open @a count exchanges to Bob, deliver a standalone ack for @a exchangeId to the exchange manager
+    // repeatedly, then close the exchanges again. The last exchange opened is the one looked up when
+    // @a exchangeId is not given.
+    void RunLookup(const char * name, size_t count, Optional<uint16_t> exchangeId = NullOptional);
+};
+
+class NullExchangeDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
+void BenchmarkExchangeLookup::RunLookup(const char * name, size_t count, Optional<uint16_t> exchangeId)
+{
+    NullExchangeDelegate delegate;
+    Platform::ScopedMemoryBuffer<ExchangeContext *> exchanges;
+    ASSERT_TRUE(exchanges.Calloc(count));
+    for (size_t i = 0; i < count; i++)
+    {
+        exchanges[i] = NewExchangeToBob(&delegate);
+        ASSERT_NE(exchanges[i], nullptr);
+    }
+
+    PacketHeader packetHeader;
+    packetHeader.SetSessionId(1).SetMessageCounter(1);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::SecureChannel::MsgType::StandaloneAck)
+        .SetExchangeID(exchangeId.ValueOr(exchanges[count - 1]->GetExchangeId()))
+        .SetInitiator(false);
+
+    SessionHandle session                    = GetSessionAliceToBob();
+    SessionMessageDelegate & messageDelegate = GetExchangeManager();
+    System::PacketBufferHandle buffer        = System::PacketBufferHandle::New(0);
+    ASSERT_FALSE(buffer.IsNull());
+
+    EXPECT_TRUE(Benchmark::Run(name, [&]() {
+        messageDelegate.OnMessageReceived(packetHeader, payloadHeader, session, SessionMessageDelegate::DuplicateMessage::No,
+                                          buffer.Retain());
+        return true;
+    }));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        exchanges[i]->Close();
+    }
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0);
+}
+
+TEST_F(BenchmarkExchangeLookup, Match1)
+{
+    RunLookup("ExchangeManager::OnMessageReceived(1 exchange)", 1);
+}
+
+TEST_F(BenchmarkExchangeLookup, Match16)
+{
+    RunLookup("ExchangeManager::OnMessageReceived(16 exchanges)", 16);
+}
+
+TEST_F(BenchmarkExchangeLookup, Match256)
+{
+    RunLookup("ExchangeManager::OnMessageReceived(256 exchanges)", 256);
+}
+
+// A standalone ack for an unknown exchange is dropped after the lookup misses.
+TEST_F(BenchmarkExchangeLookup, Miss256)
+{
+    RunLookup("ExchangeManager::OnMessageReceived(256 exchanges, no match)", 256, MakeOptional<uint16_t>(0xFFFF));
+}
+
+} // namespace
@@ -0,0 +1,216 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for PacketHeader/PayloadHeader encoding and decoding, and for
+ *      SecureMessageCodec::Encrypt/Decrypt.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <benchmarks/Benchmark.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/interaction_model/Constants.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/CryptoContext.h>
+#include <transport/SecureMessageCodec.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+// A typical small Interaction Model payload size.
+constexpr size_t kPayloadLength = 64;
+const uint8_t kPayload[kPayloadLength] = { 0x15, 0x36, 0x01, 0x15, 0x35, 0x01, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00 };
+
+class BenchmarkMessageCodec : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite()
+    {
+        EXPECT_TRUE(Benchmark::WriteResults("BenchmarkMessageCodec"));
+        chip::Platform::MemoryShutdown();
+    }
+};
+
+PacketHeader MakePacketHeader()
+{
+    PacketHeader header;
+    header.SetSessionId(0x1234).SetMessageCounter(0x01020304).SetSourceNodeId(static_cast<NodeId>(0x1122334455667788ull));
+    return header;
+}
+
+PayloadHeader MakePayloadHeader()
+{
+    PayloadHeader header;
+    header.SetMessageType(Protocols::InteractionModel::Id, 0x05)
+        .SetExchangeID(0x4242)
+        .SetInitiator(true)
+        .SetNeedsAck(true)
+        .SetAckMessageCounter(0x0a0b0c0du);
+    return header;
+}
+
+TEST_F(BenchmarkMessageCodec, PacketHeaderEncode)
+{
+    const PacketHeader header = MakePacketHeader();
+    uint8_t buffer[64];
+
+    EXPECT_TRUE(Benchmark::Run("PacketHeader::Encode", [&]() {
+        uint16_t size = 0;
+        bool ok       = (header.Encode(buffer, sizeof(buffer), &size) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(buffer);
+        return ok;
+    }));
+}
+
+TEST_F(BenchmarkMessageCodec, PacketHeaderDecode)
+{
+    uint8_t buffer[64];
+    uint16_t encodedSize = 0;
+    ASSERT_EQ(MakePacketHeader().Encode(buffer, sizeof(buffer), &encodedSize), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(Benchmark::Run("PacketHeader::Decode", [&]() {
+        PacketHeader header;
+        uint16_t size = 0;
+        bool ok       = (header.Decode(buffer, encodedSize, &size) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(header);
+        return ok;
+    }));
+}
+
+TEST_F(BenchmarkMessageCodec, PayloadHeaderEncode)
+{
+    const PayloadHeader header = MakePayloadHeader();
+    uint8_t buffer[64];
+
+    EXPECT_TRUE(Benchmark::Run("PayloadHeader::Encode", [&]() {
+        uint16_t size = 0;
+        bool ok       = (header.Encode(buffer, sizeof(buffer), &size) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(buffer);
+        return ok;
+    }));
+}
+
+TEST_F(BenchmarkMessageCodec, PayloadHeaderDecode)
+{
+    uint8_t buffer[64];
+    uint16_t encodedSize = 0;
+    ASSERT_EQ(MakePayloadHeader().Encode(buffer, sizeof(buffer), &encodedSize), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(Benchmark::Run("PayloadHeader::Decode", [&]() {
+        PayloadHeader header;
+        uint16_t size = 0;
+        bool ok       = (header.Decode(buffer, encodedSize, &size) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(header);
+        return ok;
+    }));
+}
+
+// An initiator/responder pair of session crypto contexts, so that messages encrypted by one can be decrypted by the other.
+struct SessionContexts
+{
+    CHIP_ERROR Init()
+    {
+        static const char kSalt[] = "Benchmark Salt";
+        const ByteSpan salt(reinterpret_cast<const uint8_t *>(kSalt), sizeof(kSalt) - 1);
+
+        ReturnErrorOnFailure(initiatorKeypair.Initialize(ECPKeyTarget::ECDH));
+        ReturnErrorOnFailure(responderKeypair.Initialize(ECPKeyTarget::ECDH));
+        ReturnErrorOnFailure(initiator.InitFromKeyPair(keystore, initiatorKeypair, responderKeypair.Pubkey(), salt,
+                                                       CryptoContext::SessionInfoType::kSessionEstablishment,
+                                                       CryptoContext::SessionRole::kInitiator));
+        return responder.InitFromKeyPair(keystore, responderKeypair, initiatorKeypair.Pubkey(), salt,
+                                         CryptoContext::SessionInfoType::kSessionEstablishment,
+                                         CryptoContext::SessionRole::kResponder);
+    }
+
+    DefaultSessionKeystore keystore;
+    P256Keypair initiatorKeypair;
+    P256Keypair responderKeypair;
+    CryptoContext initiator;
+    CryptoContext responder;
+};
+
+// Reset @a buffer to contain exactly @a length bytes of @a data, starting at @a start. Encrypt and Decrypt
+// modify the buffer in place, so this lets each iteration reuse the same buffer instead of allocating one.
+void ResetBuffer(System::PacketBufferHandle & buffer, uint8_t * start, const uint8_t * data, size_t length)
+{
+    buffer->SetStart(start);
+    memcpy(start, data, length);
+    buffer->SetDataLength(length);
+}
+
+TEST_F(BenchmarkMessageCodec, SecureMessageEncrypt)
+{
+    SessionContexts contexts;
+    ASSERT_EQ(contexts.Init(), CHIP_NO_ERROR);
+
+    PacketHeader packetHeader   = MakePacketHeader();
+    PayloadHeader payloadHeader = MakePayloadHeader();
+    CryptoContext::NonceStorage nonce;
+    ASSERT_EQ(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(), 0), CHIP_NO_ERROR);
+
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve);
+    ASSERT_FALSE(buffer.IsNull());
+    uint8_t * const start = buffer->Start();
+
+    EXPECT_TRUE(Benchmark::Run("SecureMessageCodec::Encrypt(64 bytes)", [&]() {
+        ResetBuffer(buffer, start, kPayload, sizeof(kPayload));
+        return SecureMessageCodec::Encrypt(contexts.initiator, nonce, payloadHeader, packetHeader, buffer) == CHIP_NO_ERROR;
+    }));
+}
+
+TEST_F(BenchmarkMessageCodec, SecureMessageDecrypt)
+{
+    SessionContexts contexts;
+    ASSERT_EQ(contexts.Init(), CHIP_NO_ERROR);
+
+    PacketHeader packetHeader   = MakePacketHeader();
+    PayloadHeader payloadHeader = MakePayloadHeader();
+    CryptoContext::NonceStorage nonce;
+    ASSERT_EQ(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(), 0), CHIP_NO_ERROR);
+
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve);
+    ASSERT_FALSE(buffer.IsNull());
+    uint8_t * const start = buffer->Start();
+
+    // Produce the ciphertext once; each iteration decrypts a fresh copy of it.
+    ResetBuffer(buffer, start, kPayload, sizeof(kPayload));
+    ASSERT_EQ(SecureMessageCodec::Encrypt(contexts.initiator, nonce, payloadHeader, packetHeader, buffer), CHIP_NO_ERROR);
+    uint8_t ciphertext[kPayloadLength + 64];
+    const size_t ciphertextLength = buffer->DataLength();
+    ASSERT_LE(ciphertextLength, sizeof(ciphertext));
+    memcpy(ciphertext, buffer->Start(), ciphertextLength);
+
+    EXPECT_TRUE(Benchmark::Run("SecureMessageCodec::Decrypt(64 bytes)", [&]() {
+        PayloadHeader decodedHeader;
+        ResetBuffer(buffer, start, ciphertext, ciphertextLength);
+        return SecureMessageCodec::Decrypt(contexts.responder, nonce, decodedHeader, packetHeader, buffer) == CHIP_NO_ERROR;
+    }));
+}
+
+} // namespace
@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for building ReportDataMessage payloads with ReportDataMessage::Builder.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/MessageDef/ReportDataMessage.h>
+#include <benchmarks/Benchmark.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+uint8_t gBuffer[1280];
+
+class BenchmarkReportData : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite()
+    {
+        EXPECT_TRUE(Benchmark::WriteResults("BenchmarkReportData"));
+        chip::Platform::MemoryShutdown();
+    }
+};
+
+CHIP_ERROR BuildAttributeReport(AttributeReportIBs::Builder & reports, AttributeId attribute)
+{
+    AttributeReportIB::Builder & report = reports.CreateAttributeReport();
+    ReturnErrorOnFailure(reports.GetError());
+
+    AttributeDataIB::Builder & data = report.CreateAttributeData();
+    ReturnErrorOnFailure(report.GetError());
+    data.DataVersion(0x12345678);
+
+    AttributePathIB::Builder & path = data.CreatePath();
+    ReturnErrorOnFailure(data.GetError());
+    ReturnErrorOnFailure(path.Endpoint(1).Cluster(0x0006).Attribute(attribute).EndOfAttributePathIB());
+
+    TLV::TLVWriter * writer = data.GetWriter();
+    ReturnErrorOnFailure(writer->Put(TLV::ContextTag(AttributeDataIB::Tag::kData), static_cast<uint32_t>(attribute * 7)));
+    ReturnErrorOnFailure(data.EndOfAttributeDataIB());
+    return report.EndOfAttributeReportIB();
+}
+
+CHIP_ERROR BuildReport(uint8_t * buffer, size_t bufferSize, AttributeId attributeCount, uint32_t & lengthOut)
+{
+    TLV::TLVWriter writer;
+    ReportDataMessage::Builder builder;
+
+    writer.Init(buffer, bufferSize);
+    ReturnErrorOnFailure(builder.Init(&writer));
+    builder.SubscriptionId(0x1234);
+
+    AttributeReportIBs::Builder & reports = builder.CreateAttributeReportIBs();
+    ReturnErrorOnFailure(builder.GetError());
+    for (AttributeId attribute = 0; attribute < attributeCount; attribute++)
+    {
+        ReturnErrorOnFailure(BuildAttributeReport(reports, attribute));
+    }
+    ReturnErrorOnFailure(reports.EndOfAttributeReportIBs());
+
+    builder.MoreChunkedMessages(false);
+    ReturnErrorOnFailure(builder.EndOfReportDataMessage());
+    ReturnErrorOnFailure(writer.Finalize());
+    lengthOut = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+TEST_F(BenchmarkReportData, BuildSingleAttribute)
+{
+    EXPECT_TRUE(Benchmark::Run("ReportDataMessage::Builder(1 attribute)", []() {
+        uint32_t length = 0;
+        bool ok         = (BuildReport(gBuffer, sizeof(gBuffer), 1, length) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(length);
+        return ok;
+    }));
+}
+
+TEST_F(BenchmarkReportData, BuildSixteenAttributes)
+{
+    EXPECT_TRUE(Benchmark::Run("ReportDataMessage::Builder(16 attributes)", []() {
+        uint32_t length = 0;
+        bool ok         = (BuildReport(gBuffer, sizeof(gBuffer), 16, length) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(length);
+        return ok;
+    }));
+}
+
+} // namespace
@@ -0,0 +1,126 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for cancelling and restarting a timer, by callback and app state as
+ *      System::Layer::CancelTimer does, with TimerList and TimerHeap as the number of live timers grows.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <benchmarks/Benchmark.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+
+#include <random>
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+// Timers only keep a reference to their layer, so an uninitialized one is sufficient here.
+LayerImpl gLayer;
+
+void Callback(Layer *, void *) {}
+
+void * AppState(uintptr_t n)
+{
+    return reinterpret_cast<void *>(n * sizeof(void *));
+}
+
+class BenchmarkSystemTimer : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite()
+    {
+        EXPECT_TRUE(Benchmark::WriteResults("BenchmarkSystemTimer"));
+        Platform::MemoryShutdown();
+    }
+};
+
+// Start @a liveTimers timers with random expiration times, then repeatedly cancel a random one and start it again.
+template <typename Queue>
+void RunCancelAndRestart(const char * name, size_t liveTimers)
+{
+    Platform::ScopedMemoryBuffer<TimerList::Node *> nodes;
+    std::mt19937 rng(42);
+    Queue queue;
+
+    ASSERT_TRUE(nodes.Calloc(liveTimers));
+    for (size_t i = 0; i < liveTimers; i++)
+    {
+        nodes[i] = Platform::New<TimerList::Node>(gLayer, Clock::Timestamp(rng() % 100000), Callback, AppState(i));
+        ASSERT_NE(nodes[i], nullptr);
+        queue.Add(nodes[i]);
+    }
+
+    EXPECT_TRUE(Benchmark::Run(name, [&]() {
+        TimerList::Node * timer = queue.Remove(Callback, AppState(rng() % liveTimers));
+        VerifyOrReturnValue(timer != nullptr, false);
+        queue.Add(timer);
+        return true;
+    }));
+
+    queue.Clear();
+    for (size_t i = 0; i < liveTimers; i++)
+    {
+        Platform::Delete(nodes[i]);
+    }
+}
+
+TEST_F(BenchmarkSystemTimer, TimerList16)
+{
+    RunCancelAndRestart<TimerList>("TimerList cancel and restart(16 timers)", 16);
+}
+
+TEST_F(BenchmarkSystemTimer, TimerHeap16)
+{
+    RunCancelAndRestart<TimerHeap>("TimerHeap cancel and restart(16 timers)", 16);
+}
+
+TEST_F(BenchmarkSystemTimer, TimerList256)
+{
+    RunCancelAndRestart<TimerList>("TimerList cancel and restart(256 timers)", 256);
+}
+
+TEST_F(BenchmarkSystemTimer, TimerHeap256)
+{
+    RunCancelAndRestart<TimerHeap>("TimerHeap cancel and restart(256 timers)", 256);
+}
+
+TEST_F(BenchmarkSystemTimer, TimerList4096)
+{
+    RunCancelAndRestart<TimerList>("TimerList cancel and restart(4096 timers)", 4096);
+}
+
+TEST_F(BenchmarkSystemTimer, TimerHeap4096)
+{
+    RunCancelAndRestart<TimerHeap>("TimerHeap cancel and restart(4096 timers)", 4096);
+}
+
+} // namespace
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
@@ -0,0 +1,182 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for TLVWriter::Put and TLVReader::Next.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <benchmarks/Benchmark.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr size_t kElementCount = 32;
+uint8_t gBuffer[1024];
+
+class BenchmarkTLV : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite()
+    {
+        EXPECT_TRUE(Benchmark::WriteResults("BenchmarkTLV"));
+        chip::Platform::MemoryShutdown();
+    }
+};
+
+// Writes a structure containing kElementCount elements of mixed types, similar to an attribute report payload.
+CHIP_ERROR WriteStructure(uint8_t * buffer, size_t bufferSize, uint32_t & lengthOut)
+{
+    TLVWriter writer;
+    TLVType outerType;
+    static const char kString[] = "benchmark";
+
+    writer.Init(buffer, bufferSize);
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerType));
+    for (uint8_t i = 0; i < kElementCount; i++)
+    {
+        switch (i % 4)
+        {
+        case 0:
+            ReturnErrorOnFailure(writer.Put(ContextTag(i), static_cast<uint32_t>(i * 1000u)));
+            break;
+        case 1:
+            ReturnErrorOnFailure(writer.Put(ContextTag(i), static_cast<int8_t>(-i)));
+            break;
+        case 2:
+            ReturnErrorOnFailure(writer.Put(ContextTag(i), (i & 8) != 0));
+            break;
+        default:
+            ReturnErrorOnFailure(writer.PutString(ContextTag(i), kString));
+            break;
+        }
+    }
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    ReturnErrorOnFailure(writer.Finalize());
+    lengthOut = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+TEST_F(BenchmarkTLV, WriterPutUnsigned)
+{
+    TLVWriter writer;
+    uint32_t value = 0;
+
+    writer.Init(gBuffer, sizeof(gBuffer));
+    EXPECT_TRUE(Benchmark::Run("TLVWriter::Put(uint32_t)", [&]() {
+        if (writer.GetRemainingFreeLength() < 8)
+        {
+            writer.Init(gBuffer, sizeof(gBuffer));
+        }
+        return writer.Put(ContextTag(1), value++) == CHIP_NO_ERROR;
+    }));
+}
+
+TEST_F(BenchmarkTLV, WriterPutStructure)
+{
+    EXPECT_TRUE(Benchmark::Run("TLVWriter::Put(32-element structure)", []() {
+        uint32_t length = 0;
+        bool ok         = (WriteStructure(gBuffer, sizeof(gBuffer), length) == CHIP_NO_ERROR);
+        Benchmark::DoNotOptimize(length);
+        return ok;
+    }));
+}
+
+TEST_F(BenchmarkTLV, ReaderNextStructure)
+{
+    uint32_t length = 0;
+    ASSERT_EQ(WriteStructure(gBuffer, sizeof(gBuffer), length), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(Benchmark::Run("TLVReader::Next(32-element structure)", [&]() {
+        TLVReader reader;
+        TLVType outerType;
+        size_t count = 0;
+        CHIP_ERROR err;
+
+        reader.Init(gBuffer, length);
+        VerifyOrReturnValue(reader.Next() == CHIP_NO_ERROR, false);
+        VerifyOrReturnValue(reader.EnterContainer(outerType) == CHIP_NO_ERROR, false);
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            count++;
+        }
+        VerifyOrReturnValue(err == CHIP_END_OF_TLV, false);
+        VerifyOrReturnValue(reader.ExitContainer(outerType) == CHIP_NO_ERROR, false);
+        Benchmark::DoNotOptimize(count);
+        return count == kElementCount;
+    }));
+}
+
+TEST_F(BenchmarkTLV, ReaderNextAndGet)
+{
+    uint32_t length = 0;
+    ASSERT_EQ(WriteStructure(gBuffer, sizeof(gBuffer), length), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(Benchmark::Run("TLVReader::Next+Get(32-element structure)", [&]() {
+        TLVReader reader;
+        TLVType outerType;
+        uint64_t sum = 0;
+
+        reader.Init(gBuffer, length);
+        VerifyOrReturnValue(reader.Next() == CHIP_NO_ERROR, false);
+        VerifyOrReturnValue(reader.EnterContainer(outerType) == CHIP_NO_ERROR, false);
+        while (reader.Next() == CHIP_NO_ERROR)
+        {
+            switch (reader.GetType())
+            {
+            case kTLVType_UnsignedInteger: {
+                uint32_t v;
+                VerifyOrReturnValue(reader.Get(v) == CHIP_NO_ERROR, false);
+                sum += v;
+                break;
+            }
+            case kTLVType_SignedInteger: {
+                int8_t v;
+                VerifyOrReturnValue(reader.Get(v) == CHIP_NO_ERROR, false);
+                sum += static_cast<uint8_t>(v);
+                break;
+            }
+            case kTLVType_Boolean: {
+                bool v;
+                VerifyOrReturnValue(reader.Get(v) == CHIP_NO_ERROR, false);
+                sum += v ? 1 : 0;
+                break;
+            }
+            default: {
+                CharSpan v;
+                VerifyOrReturnValue(reader.Get(v) == CHIP_NO_ERROR, false);
+                sum += v.size();
+                break;
+            }
+            }
+        }
+        VerifyOrReturnValue(reader.ExitContainer(outerType) == CHIP_NO_ERROR, false);
+        Benchmark::DoNotOptimize(sum);
+        return true;
+    }));
+}
+
+} // namespace
@@ -61,16 +61,20 @@ CHIP_ERROR DeviceControllerFactory::Init(FactoryInitParams params)
 
     // Save our initialization state that we can't recover later from a
     // created-but-shut-down system state.
-    mListenPort                = params.listenPort;
-    mInterfaceId               = params.interfaceId;
-    mFabricIndependentStorage  = params.fabricIndependentStorage;
-    mOperationalKeystore       = params.operationalKeystore;
-    mOpCertStore               = params.opCertStore;
-    mCertificateValidityPolicy = params.certificateValidityPolicy;
-    mSessionResumptionStorage  = params.sessionResumptionStorage;
-    mEnableServerInteractions  = params.enableServerInteractions;
-    mPreventDnssdPortOverwrite = params.preventDnssdPortOverwrite;
-    mDataModelProvider         = params.dataModelProvider;
+    mListenPort                    = params.listenPort;
+    mInterfaceId                   = params.interfaceId;
+    mFabricIndependentStorage      = params.fabricIndependentStorage;
+    mOperationalKeystore           = params.operationalKeystore;
+    mOpCertStore                   = params.opCertStore;
+    mCertificateValidityPolicy     = params.certificateValidityPolicy;
+    mSessionResumptionStorage      = params.sessionResumptionStorage;
+    mEnableServerInteractions      = params.enableServerInteractions;
+    mPreventDnssdPortOverwrite     = params.preventDnssdPortOverwrite;
+    mDataModelProvider             = params.dataModelProvider;
+    mMaxConcurrentSessionSetups    = params.maxConcurrentSessionSetups;
+    mMaxPendingSessionSetups       = params.maxPendingSessionSetups;
+    mSessionSetupAdmissionInterval = params.sessionSetupAdmissionInterval;
+    mSessionSetupAdmissionJitter   = params.sessionSetupAdmissionJitter;
 
     // Initialize the system state. Note that it is left in a somewhat
     // special state where it is initialized, but has a ref count of 0.
@@ -93,19 +97,23 @@ CHIP_ERROR DeviceControllerFactory::ReinitSystemStateIfNecessary()
 #if CONFIG_NETWORK_LAYER_BLE
     params.bleLayer = mSystemState->BleLayer();
 #endif
-    params.listenPort                = mListenPort;
-    params.interfaceId               = mInterfaceId;
-    params.fabricIndependentStorage  = mFabricIndependentStorage;
-    params.enableServerInteractions  = mEnableServerInteractions;
-    params.preventDnssdPortOverwrite = mPreventDnssdPortOverwrite;
-    params.groupDataProvider         = mSystemState->GetGroupDataProvider();
-    params.sessionKeystore           = mSystemState->GetSessionKeystore();
-    params.fabricTable               = mSystemState->Fabrics();
-    params.operationalKeystore       = mOperationalKeystore;
-    params.opCertStore               = mOpCertStore;
-    params.certificateValidityPolicy = mCertificateValidityPolicy;
-    params.sessionResumptionStorage  = mSessionResumptionStorage;
-    params.dataModelProvider         = mDataModelProvider;
+    params.listenPort                    = mListenPort;
+    params.interfaceId                   = mInterfaceId;
+    params.fabricIndependentStorage      = mFabricIndependentStorage;
+    params.enableServerInteractions      = mEnableServerInteractions;
+    params.preventDnssdPortOverwrite     = mPreventDnssdPortOverwrite;
+    params.groupDataProvider             = mSystemState->GetGroupDataProvider();
+    params.sessionKeystore               = mSystemState->GetSessionKeystore();
+    params.fabricTable                   = mSystemState->Fabrics();
+    params.operationalKeystore           = mOperationalKeystore;
+    params.opCertStore                   = mOpCertStore;
+    params.certificateValidityPolicy     = mCertificateValidityPolicy;
+    params.sessionResumptionStorage      = mSessionResumptionStorage;
+    params.dataModelProvider             = mDataModelProvider;
+    params.maxConcurrentSessionSetups    = mMaxConcurrentSessionSetups;
+    params.maxPendingSessionSetups       = mMaxPendingSessionSetups;
+    params.sessionSetupAdmissionInterval = mSessionSetupAdmissionInterval;
+    params.sessionSetupAdmissionJitter   = mSessionSetupAdmissionJitter;
 
     return InitSystemState(params);
 }
@@ -341,9 +349,13 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     };
 
     CASESessionManagerConfig sessionManagerConfig = {
-        .sessionInitParams = sessionInitParams,
-        .clientPool        = stateParams.caseClientPool,
-        .sessionSetupPool  = stateParams.sessionSetupPool,
+        .sessionInitParams             = sessionInitParams,
+        .clientPool                    = stateParams.caseClientPool,
+        .sessionSetupPool              = stateParams.sessionSetupPool,
+        .maxConcurrentSessionSetups    = params.maxConcurrentSessionSetups,
+        .maxPendingSessionSetups       = params.maxPendingSessionSetups,
+        .sessionSetupAdmissionInterval = params.sessionSetupAdmissionInterval,
+        .sessionSetupAdmissionJitter   = params.sessionSetupAdmissionJitter,
     };
 
     // TODO: Need to be able to create a CASESessionManagerConfig here!
@@ -539,6 +551,15 @@ void DeviceControllerSystemState::Shutdown()
         mCASESessionManager = nullptr;
     }
 
+    if (mSessionResumptionStorage != nullptr)
+    {
+        CHIP_ERROR err = mSessionResumptionStorage->Flush();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Failed to flush session resumption storage: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
     // The above took care of CASE handshakes, and shutting down all the
     // controllers should have taken care of the PASE handshakes.  Clean up any
     // outstanding secure sessions (shouldn't really be any, since controllers
@@ -185,6 +185,17 @@ struct FactoryInitParams
     // networks when activeRetransTimeout is too small.
     // Note: Setting this parameter to a nonzero value is not spec-compliant.
     Optional<uint32_t> minimumLITBackoffInterval;
+
+    // Pacing of the new CASE session setups, see CASESessionManagerConfig.  By
+    // default (0), session setups are not limited and start right away.  When
+    // a controller restarts with many devices, limiting them avoids flooding
+    // the network with DNS-SD queries and Sigma1 messages.  The number of
+    // peers waiting meanwhile is limited by maxPendingSessionSetups, or not
+    // at all if it is 0.
+    uint16_t maxConcurrentSessionSetups = CHIP_CONFIG_CASE_SESSION_ADMISSION_MAX_CONCURRENT;
+    uint16_t maxPendingSessionSetups    = CHIP_CONFIG_CASE_SESSION_ADMISSION_QUEUE_SIZE;
+    System::Clock::Milliseconds32 sessionSetupAdmissionInterval{ CHIP_CONFIG_CASE_SESSION_ADMISSION_INTERVAL_MS };
+    System::Clock::Milliseconds32 sessionSetupAdmissionJitter{ CHIP_CONFIG_CASE_SESSION_ADMISSION_JITTER_MS };
 };
 
 class DeviceControllerFactory
@@ -322,6 +333,10 @@ private:
     app::DataModel::Provider * mDataModelProvider                       = nullptr;
     bool mEnableServerInteractions                                      = false;
     bool mPreventDnssdPortOverwrite                                     = false;
+    uint16_t mMaxConcurrentSessionSetups                                = 0;
+    uint16_t mMaxPendingSessionSetups                                   = 0;
+    System::Clock::Milliseconds32 mSessionSetupAdmissionInterval        = System::Clock::Milliseconds32(0);
+    System::Clock::Milliseconds32 mSessionSetupAdmissionJitter          = System::Clock::Milliseconds32(0);
 };
 
 } // namespace Controller
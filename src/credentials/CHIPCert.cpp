@@ -411,8 +411,16 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     }
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
-    // succeeds, the current certificate is valid.
-    err = VerifyCertSignature(*cert, *caCert);
+    // succeeds, the current certificate is valid.  The signature of a CA certificate may have been verified already,
+    // by an earlier validation sharing the same cache.
+    if (depth > 0 && context.mValidatedCertCache != nullptr)
+    {
+        err = context.mValidatedCertCache->VerifyCertSignature(*cert, *caCert);
+    }
+    else
+    {
+        err = VerifyCertSignature(*cert, *caCert);
+    }
     SuccessOrExit(err);
 
 exit:
@@ -500,9 +508,10 @@ bool ChipCertificateData::IsEqual(const ChipCertificateData & other) const
 
 void ValidationContext::Reset()
 {
-    mEffectiveTime  = EffectiveTime{};
-    mTrustAnchor    = nullptr;
-    mValidityPolicy = nullptr;
+    mEffectiveTime      = EffectiveTime{};
+    mTrustAnchor        = nullptr;
+    mValidityPolicy     = nullptr;
+    mValidatedCertCache = nullptr;
     mRequiredKeyUsages.ClearAll();
     mRequiredKeyPurposes.ClearAll();
     mRequiredCertType = CertType::kNotSpecified;
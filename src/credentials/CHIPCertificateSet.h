@@ -32,6 +32,7 @@
 
 #include "CHIPCert.h"
 #include "CertificateValidityPolicy.h"
+#include "ValidatedCertificateCache.h"
 #include <lib/support/Variant.h>
 
 namespace chip {
@@ -74,6 +75,8 @@ struct ValidationContext
 
     CertificateValidityPolicy * mValidityPolicy =
         nullptr; /**< Optional application policy to apply for certificate validity period evaluation. */
+    ValidatedCertificateCache * mValidatedCertCache =
+        nullptr; /**< Optional cache of verified CA certificate signatures, see ValidatedCertificateCache. */
 
     void Reset();
 
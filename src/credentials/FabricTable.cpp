@@ -394,6 +394,10 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc,
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
+    if (context.mValidatedCertCache == nullptr)
+    {
+        context.mValidatedCertCache = &mValidatedCertCache;
+    }
     return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
                              outRootPublicKey);
 }
@@ -1037,6 +1041,9 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
         }
     }
 
+    // Forget the certificates verified for the removed fabric.
+    mValidatedCertCache.Clear();
+
     if (mDelegateListRoot != nullptr)
     {
         FabricTable::Delegate * delegate = mDelegateListRoot;
@@ -1084,6 +1091,8 @@ CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
     mOperationalKeystore = initParams.operationalKeystore;
     mOpCertStore         = initParams.opCertStore;
 
+    ReturnErrorOnFailure(mValidatedCertCache.Init());
+
     ChipLogDetail(FabricProvisioning, "Initializing FabricTable from persistent storage");
 
     // Load the current fabrics from the storage.
@@ -1158,6 +1167,7 @@ void FabricTable::Forget(FabricIndex fabricIndex)
 
     RevertPendingFabricData();
     fabricInfo->Reset();
+    mValidatedCertCache.Clear();
 }
 
 void FabricTable::Shutdown()
@@ -1181,6 +1191,7 @@ void FabricTable::Shutdown()
         // direct lookups fail.
         fabricInfo.Reset();
     }
+    mValidatedCertCache.Clear();
 
     mStorage = nullptr;
 }
@@ -2061,6 +2072,9 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
     mPendingFabric.Reset();
 
+    // Certificates of an updated fabric may have been replaced.
+    mValidatedCertCache.Clear();
+
     if (stickyError != CHIP_NO_ERROR)
     {
         // Blow-away everything if we got past any storage, even on Update: system state is broken
@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/ValidatedCertificateCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -805,6 +806,12 @@ public:
      */
     const Crypto::OperationalKeystore * GetOperationalKeystore() { return mOperationalKeystore; }
 
+    /**
+     * @brief Returns the cache of verified CA certificate signatures, to be set in the validation
+     *        context of CASE handshakes. It is cleared whenever the fabrics change.
+     */
+    Credentials::ValidatedCertificateCache * GetValidatedCertificateCache() const { return &mValidatedCertCache; }
+
     /**
      * @brief Add a pending trusted root certificate for the next fabric created with `AddNewPendingFabric*` methods.
      *
@@ -1007,7 +1014,8 @@ public:
      */
     void RevertPendingOpCertsExceptRoot();
 
-    // Verifies credentials, using the root certificate of the provided fabric index.
+    // Verifies credentials, using the root certificate of the provided fabric index.  CA certificate signatures
+    // verified by an earlier call are not verified again, unless the context already refers to another cache.
     CHIP_ERROR VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc, ByteSpan icac, Credentials::ValidationContext & context,
                                  CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                  Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr) const;
@@ -1298,6 +1306,9 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+    // Mutable since populated while verifying credentials.
+    mutable Credentials::ValidatedCertificateCache mValidatedCertCache;
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
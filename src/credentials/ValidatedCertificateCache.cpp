@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/ValidatedCertificateCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <mutex>
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+using namespace chip::Crypto;
+
+CHIP_ERROR ValidatedCertificateCache::Init()
+{
+    return System::Mutex::Init(mLock);
+}
+
+CHIP_ERROR ValidatedCertificateCache::VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer)
+{
+    uint8_t digest[kSHA256_Hash_Length];
+    ReturnErrorOnFailure(ComputeDigest(cert, signer, digest));
+
+    {
+        std::lock_guard<System::Mutex> lock(mLock);
+        for (auto & entry : mEntries)
+        {
+            if (entry.lastUse != 0 && memcmp(entry.digest, digest, sizeof(digest)) == 0)
+            {
+                entry.lastUse = ++mUseCounter;
+                return CHIP_NO_ERROR;
+            }
+        }
+    }
+
+    // Not locked while verifying: the signature is verified again if another thread happens to verify it concurrently.
+    ReturnErrorOnFailure(Credentials::VerifyCertSignature(cert, signer));
+
+    std::lock_guard<System::Mutex> lock(mLock);
+    Entry * victim = &mEntries[0];
+    for (auto & entry : mEntries)
+    {
+        if (entry.lastUse < victim->lastUse)
+        {
+            victim = &entry;
+        }
+    }
+    memcpy(victim->digest, digest, sizeof(digest));
+    victim->lastUse = ++mUseCounter;
+
+    return CHIP_NO_ERROR;
+}
+
+void ValidatedCertificateCache::Clear()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    for (auto & entry : mEntries)
+    {
+        entry.lastUse = 0;
+    }
+    mUseCounter = 0;
+}
+
+size_t ValidatedCertificateCache::GetEntryCount()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    size_t count = 0;
+    for (const auto & entry : mEntries)
+    {
+        count += (entry.lastUse != 0) ? 1 : 0;
+    }
+    return count;
+}
+
+CHIP_ERROR ValidatedCertificateCache::ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                                    uint8_t (&digest)[kSHA256_Hash_Length])
+{
+    VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(cert.mTBSHash)));
+    ReturnErrorOnFailure(hash.AddData(cert.mSignature));
+    ReturnErrorOnFailure(hash.AddData(signer.mPublicKey));
+
+    MutableByteSpan digestSpan(digest);
+    return hash.Finish(digestSpan);
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,88 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemMutex.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Credentials {
+
+static_assert(CHIP_CONFIG_VALIDATED_CERT_CACHE_SIZE > 0, "The validated certificate cache must have at least one entry");
+
+/**
+ * Bounded cache of verified certificate signatures.
+ *
+ * During CASE, the NOC chain of the peer is validated on every handshake, even though the ICAC and RCAC of a
+ * fabric are the same from one handshake to the next.  When a ValidationContext refers to this cache, the
+ * signatures of CA certificates that were already verified against the same issuer are not verified again.
+ * Only the signature of the leaf certificate is always verified, and the rest of the validation (certificate
+ * usages, validity window, trust anchor) is always applied.
+ *
+ * An entry is keyed by a hash of the TBS hash and signature of the certificate together with the public key of
+ * its issuer, so it is only found for the exact same certificate signed by the exact same key.  The least
+ * recently used entry is replaced when the cache is full.
+ *
+ * The cache may be used from the background thread processing CASE, so its accesses are serialized.
+ */
+class ValidatedCertificateCache
+{
+public:
+    ValidatedCertificateCache() = default;
+
+    ValidatedCertificateCache(const ValidatedCertificateCache &)             = delete;
+    ValidatedCertificateCache & operator=(const ValidatedCertificateCache &) = delete;
+
+    CHIP_ERROR Init();
+
+    /**
+     * Verify the signature of @a cert against the public key of @a signer, as VerifyCertSignature() does,
+     * unless it was already verified.
+     */
+    CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer);
+
+    /**
+     * Forget every verified signature.
+     */
+    void Clear();
+
+    size_t GetEntryCount();
+
+private:
+    struct Entry
+    {
+        uint8_t digest[Crypto::kSHA256_Hash_Length];
+        // Value of mUseCounter when the entry was last used, 0 if the entry is free.
+        uint32_t lastUse = 0;
+    };
+
+    static CHIP_ERROR ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                    uint8_t (&digest)[Crypto::kSHA256_Hash_Length]);
+
+    Entry mEntries[CHIP_CONFIG_VALIDATED_CERT_CACHE_SIZE];
+    uint32_t mUseCounter = 0;
+    System::Mutex mLock;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -28,6 +28,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <credentials/CHIPCert.h>
+#include <credentials/ValidatedCertificateCache.h>
 #include <credentials/examples/LastKnownGoodTimeCertificateValidityPolicyExample.h>
 #include <credentials/examples/StrictCertificateValidityPolicyExample.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -1363,6 +1364,49 @@ TEST_F(TestChipCert, TestChipCert_LoadDuplicateCerts)
     EXPECT_EQ(certSet.GetCertCount(), 3);
 }
 
+TEST_F(TestChipCert, TestChipCert_ValidatedCertCache)
+{
+    ChipCertificateSet certSet;
+    ValidationContext validContext;
+    ValidatedCertificateCache cache;
+
+    EXPECT_EQ(cache.Init(), CHIP_NO_ERROR);
+    EXPECT_EQ(certSet.Init(kStandardCertsCount), CHIP_NO_ERROR);
+    EXPECT_EQ(LoadTestCertSet01(certSet), CHIP_NO_ERROR);
+
+    validContext.Reset();
+    EXPECT_EQ(SetCurrentTime(validContext, 2021, 1, 1), CHIP_NO_ERROR);
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    validContext.mValidatedCertCache = &cache;
+
+    // Only the signature of the ICAC is remembered, not the one of the leaf certificate.
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+    EXPECT_EQ(validContext.mTrustAnchor, &certSet.GetCertSet()[0]);
+
+    // Validating the chain again succeeds from the cached ICAC signature.
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+
+    // The validity window of the ICAC is still checked.
+    EXPECT_EQ(SetCurrentTime(validContext, 2020, 1, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_ERROR_CERT_NOT_VALID_YET);
+    EXPECT_EQ(SetCurrentTime(validContext, 2021, 1, 1), CHIP_NO_ERROR);
+
+    // The ICAC of another chain gets its own entry.
+    certSet.Release();
+    EXPECT_EQ(certSet.Init(kStandardCertsCount), CHIP_NO_ERROR);
+    EXPECT_EQ(LoadTestCert(certSet, TestCert::kRoot02, sNullLoadFlag, sTrustAnchorFlag), CHIP_NO_ERROR);
+    EXPECT_EQ(LoadTestCert(certSet, TestCert::kICA02, sNullLoadFlag, sGenTBSHashFlag), CHIP_NO_ERROR);
+    EXPECT_EQ(LoadTestCert(certSet, TestCert::kNode02_01, sNullLoadFlag, sGenTBSHashFlag), CHIP_NO_ERROR);
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetEntryCount(), 2u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+}
+
 TEST_F(TestChipCert, TestChipCert_GenerateRootCert)
 {
     // Generate a new keypair for cert signing
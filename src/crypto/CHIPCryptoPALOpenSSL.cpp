@@ -23,6 +23,8 @@
 #include "CHIPCryptoPALOpenSSL.h"
 #include "CHIPCryptoPAL.h"
 
+#include <array>
+#include <mutex>
 #include <type_traits>
 
 #if CHIP_CRYPTO_BORINGSSL
@@ -138,6 +140,156 @@ static int _compareDaysAndSeconds(const int days, const int seconds)
     return 0;
 }
 
+#if !CHIP_CRYPTO_BORINGSSL
+
+namespace {
+
+// A cipher context keyed for AES-CCM.  The nonce and tag lengths are fixed when a CCM context is keyed, and a
+// context keyed for encryption cannot be used for decryption, so a context is only reused for the same key,
+// direction, nonce length and tag length.
+struct AesCcmCachedContext
+{
+    Symmetric128BitsKeyByteArray key;
+    bool encrypt       = false;
+    size_t nonceLength = 0;
+    size_t tagLength   = 0;
+    // nullptr if the entry is free.
+    EVP_CIPHER_CTX * context = nullptr;
+    // Value of gAesCcmContextUseCounter when the entry was last used, 0 if the entry is free.
+    uint64_t lastUse = 0;
+    bool inUse       = false;
+    // Set when the key is destroyed while the context is in use, so that the context is freed once released.
+    bool keyReleased = false;
+};
+
+std::mutex gAesCcmContextLock;
+std::array<AesCcmCachedContext, CHIP_CONFIG_OPENSSL_AES_CCM_CONTEXT_CACHE_SIZE> gAesCcmContexts;
+uint64_t gAesCcmContextUseCounter = 0;
+
+void ClearAesCcmCachedContext(AesCcmCachedContext & entry)
+{
+    EVP_CIPHER_CTX_free(entry.context);
+    ClearSecretData(entry.key);
+    entry.context     = nullptr;
+    entry.lastUse     = 0;
+    entry.keyReleased = false;
+}
+
+/**
+ * Get a cipher context to encrypt or decrypt with AES-CCM and @a key, which must be passed back to
+ * ReleaseAesCcmContext().
+ *
+ * @a keyed is set if the context is already keyed with @a key for the given direction, nonce length and tag
+ * length.  Otherwise, the context is new and must be fully initialized.  @a entry is set to the cache entry of
+ * the context, or nullptr if no entry is available, in which case the context is freed once released.
+ */
+EVP_CIPHER_CTX * AcquireAesCcmContext(const Aes128KeyHandle & key, bool encrypt, size_t nonce_length, size_t tag_length,
+                                      AesCcmCachedContext *& entry, bool & keyed)
+{
+    const Symmetric128BitsKeyByteArray & keyBytes = key.As<Symmetric128BitsKeyByteArray>();
+
+    entry = nullptr;
+    keyed = false;
+
+    {
+        std::lock_guard<std::mutex> lock(gAesCcmContextLock);
+
+        AesCcmCachedContext * victim = nullptr;
+        for (auto & candidate : gAesCcmContexts)
+        {
+            if (candidate.inUse)
+            {
+                continue;
+            }
+            if (candidate.context != nullptr && candidate.encrypt == encrypt && candidate.nonceLength == nonce_length &&
+                candidate.tagLength == tag_length && memcmp(candidate.key, keyBytes, sizeof(keyBytes)) == 0)
+            {
+                candidate.inUse   = true;
+                candidate.lastUse = ++gAesCcmContextUseCounter;
+                entry             = &candidate;
+                keyed             = true;
+                return candidate.context;
+            }
+            if (victim == nullptr || candidate.lastUse < victim->lastUse)
+            {
+                victim = &candidate;
+            }
+        }
+
+        if (victim != nullptr)
+        {
+            if (victim->context == nullptr)
+            {
+                victim->context = EVP_CIPHER_CTX_new();
+                VerifyOrReturnValue(victim->context != nullptr, nullptr);
+            }
+            else
+            {
+                EVP_CIPHER_CTX_reset(victim->context);
+            }
+            memcpy(victim->key, keyBytes, sizeof(keyBytes));
+            victim->encrypt     = encrypt;
+            victim->nonceLength = nonce_length;
+            victim->tagLength   = tag_length;
+            victim->lastUse     = ++gAesCcmContextUseCounter;
+            victim->inUse       = true;
+            victim->keyReleased = false;
+            entry               = victim;
+            return victim->context;
+        }
+    }
+
+    return EVP_CIPHER_CTX_new();
+}
+
+/**
+ * Release a context obtained from AcquireAesCcmContext().  The context is only kept for reuse if the operation
+ * succeeded, so that a context in an unknown state is never reused.
+ */
+void ReleaseAesCcmContext(EVP_CIPHER_CTX * context, AesCcmCachedContext * entry, bool success)
+{
+    if (entry == nullptr)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(gAesCcmContextLock);
+    entry->inUse = false;
+    if (!success || entry->keyReleased)
+    {
+        ClearAesCcmCachedContext(*entry);
+    }
+}
+
+} // namespace
+
+#endif // !CHIP_CRYPTO_BORINGSSL
+
+void AES_CCM_ReleaseKeyContexts(const Symmetric128BitsKeyHandle & key)
+{
+#if !CHIP_CRYPTO_BORINGSSL
+    const Symmetric128BitsKeyByteArray & keyBytes = key.As<Symmetric128BitsKeyByteArray>();
+
+    std::lock_guard<std::mutex> lock(gAesCcmContextLock);
+    for (auto & entry : gAesCcmContexts)
+    {
+        if (entry.context == nullptr || memcmp(entry.key, keyBytes, sizeof(keyBytes)) != 0)
+        {
+            continue;
+        }
+        if (entry.inUse)
+        {
+            entry.keyReleased = true;
+        }
+        else
+        {
+            ClearAesCcmCachedContext(entry);
+        }
+    }
+#endif // !CHIP_CRYPTO_BORINGSSL
+}
+
 CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
                            const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
@@ -147,10 +299,12 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     size_t written_tag_len = 0;
     const EVP_AEAD * aead  = nullptr;
 #else
-    EVP_CIPHER_CTX * context = nullptr;
-    int bytesWritten         = 0;
-    size_t ciphertext_length = 0;
-    const EVP_CIPHER * type  = nullptr;
+    EVP_CIPHER_CTX * context          = nullptr;
+    AesCcmCachedContext * cachedEntry = nullptr;
+    bool keyed                        = false;
+    int bytesWritten                  = 0;
+    size_t ciphertext_length          = 0;
+    const EVP_CIPHER * type           = nullptr;
 #endif
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -207,24 +361,28 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
 
     type = EVP_aes_128_ccm();
 
-    context = EVP_CIPHER_CTX_new();
+    context = AcquireAesCcmContext(key, true, nonce_length, tag_length, cachedEntry, keyed);
     VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    if (!keyed)
+    {
+        // Pass in cipher
+        result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
 
-    // Pass in key + nonce
+    // Pass in key + nonce.  A cached context keeps its key schedule, so only the nonce is passed in.
     static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+    result = EVP_EncryptInit_ex(context, nullptr, nullptr, keyed ? nullptr : key.As<Symmetric128BitsKeyByteArray>(),
+                                Uint8::to_const_uchar(nonce));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in plain text length
@@ -265,7 +423,7 @@ exit:
 #if CHIP_CRYPTO_BORINGSSL
         EVP_AEAD_CTX_free(context);
 #else
-        EVP_CIPHER_CTX_free(context);
+        ReleaseAesCcmContext(context, cachedEntry, error == CHIP_NO_ERROR);
 #endif // CHIP_CRYPTO_BORINGSSL
         context = nullptr;
     }
@@ -282,9 +440,11 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     const EVP_AEAD * aead  = nullptr;
 #else
 
-    EVP_CIPHER_CTX * context = nullptr;
-    int bytesOutput          = 0;
-    const EVP_CIPHER * type  = nullptr;
+    EVP_CIPHER_CTX * context          = nullptr;
+    AesCcmCachedContext * cachedEntry = nullptr;
+    bool keyed                        = false;
+    int bytesOutput                   = 0;
+    const EVP_CIPHER * type           = nullptr;
 #endif // CHIP_CRYPTO_BORINGSSL
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -337,29 +497,38 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
 #else
     type = EVP_aes_128_ccm();
 
-    context = EVP_CIPHER_CTX_new();
+    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    context = AcquireAesCcmContext(key, false, nonce_length, tag_length, cachedEntry, keyed);
     VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    if (!keyed)
+    {
+        // Pass in cipher
+        result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in nonce length
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        // Pass in nonce length
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+        // Pass in tag length, which is part of the key setup
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
+
+    // Pass in key + nonce.  A cached context keeps its key schedule, so only the nonce is passed in.
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+    result = EVP_DecryptInit_ex(context, nullptr, nullptr, keyed ? nullptr : key.As<Symmetric128BitsKeyByteArray>(),
+                                Uint8::to_const_uchar(nonce));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in expected tag
     // Removing "const" from |tag| here should hopefully be safe as
     // we're writing the tag, not reading.
-    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
-                                            const_cast<void *>(static_cast<const void *>(tag)));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+                                 const_cast<void *>(static_cast<const void *>(tag)));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in cipher text length
@@ -394,7 +563,7 @@ exit:
 #if CHIP_CRYPTO_BORINGSSL
         EVP_AEAD_CTX_free(context);
 #else
-        EVP_CIPHER_CTX_free(context);
+        ReleaseAesCcmContext(context, cachedEntry, error == CHIP_NO_ERROR);
 #endif // CHIP_CRYPTO_BORINGSSL
 
         context = nullptr;
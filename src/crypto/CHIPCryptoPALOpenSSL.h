@@ -60,5 +60,12 @@ ECName MapECName(SupportedECPKeyTypes keyType);
  **/
 CHIP_ERROR P256PublicKeyFromECKey(EC_KEY * ec_key, P256PublicKey & pubkey);
 
+/**
+ * @brief Release the cached AES-CCM cipher contexts keyed with the raw key of @a key.
+ *
+ * Must be called before the key material is cleared, so that no copy of it is left in the cache.
+ **/
+void AES_CCM_ReleaseKeyContexts(const Symmetric128BitsKeyHandle & key);
+
 } // namespace Crypto
 } // namespace chip
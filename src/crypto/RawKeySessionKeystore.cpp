@@ -19,6 +19,10 @@
 
 #include <lib/support/BufferReader.h>
 
+#if CHIP_CRYPTO_OPENSSL
+#include <crypto/CHIPCryptoPALOpenSSL.h>
+#endif // CHIP_CRYPTO_OPENSSL
+
 #include <cstdint>
 
 namespace chip {
@@ -95,6 +99,9 @@ CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const HkdfKeyHandle & hkdfKe
 
 void RawKeySessionKeystore::DestroyKey(Symmetric128BitsKeyHandle & key)
 {
+#if CHIP_CRYPTO_OPENSSL
+    AES_CCM_ReleaseKeyContexts(key);
+#endif // CHIP_CRYPTO_OPENSSL
     ClearSecretData(key.AsMutable<Symmetric128BitsKeyByteArray>());
 }
 
@@ -547,6 +547,57 @@ TEST_F(TestChipCryptoPAL, TestAES_CCM_128InPlaceDecryption)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+// Backends may keep state keyed with a session key between messages, so check that encrypting and decrypting
+// several messages with the same key, including after a failed decryption, gives the same results.
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128KeyReuse)
+{
+    HeapChecker heapChecker;
+    int numOfTestVectors = MATTER_ARRAY_SIZE(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->result != CHIP_NO_ERROR || vector->pt_len == 0)
+        {
+            continue;
+        }
+        numOfTestsRan++;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> bad_tag;
+        ASSERT_TRUE(out_ct.Alloc(vector->ct_len));
+        ASSERT_TRUE(out_pt.Alloc(vector->pt_len));
+        ASSERT_TRUE(out_tag.Alloc(vector->tag_len));
+        ASSERT_TRUE(bad_tag.Alloc(vector->tag_len));
+        memcpy(bad_tag.Get(), vector->tag, vector->tag_len);
+        bad_tag[0] ^= 0x01;
+
+        TestAesKey key(vector->key, vector->key_len);
+
+        for (int round = 0; round < 3; round++)
+        {
+            EXPECT_EQ(AES_CCM_encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, key.key, vector->nonce,
+                                      vector->nonce_len, out_ct.Get(), out_tag.Get(), vector->tag_len),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(out_ct.Get(), vector->ct, vector->ct_len), 0);
+            EXPECT_EQ(memcmp(out_tag.Get(), vector->tag, vector->tag_len), 0);
+
+            EXPECT_NE(AES_CCM_decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, bad_tag.Get(), vector->tag_len,
+                                      key.key, vector->nonce, vector->nonce_len, out_pt.Get()),
+                      CHIP_NO_ERROR);
+
+            EXPECT_EQ(AES_CCM_decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                      key.key, vector->nonce, vector->nonce_len, out_pt.Get()),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(out_pt.Get(), vector->pt, vector->pt_len), 0);
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
 TEST_F(TestChipCryptoPAL, TestAES_CCM_128EncryptInvalidNonceLen)
 {
     HeapChecker heapChecker;
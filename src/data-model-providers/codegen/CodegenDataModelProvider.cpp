@@ -424,6 +424,14 @@ CHIP_ERROR CodegenDataModelProvider::ClientClusters(EndpointId endpointId, ReadO
     return CHIP_NO_ERROR;
 }
 
+std::optional<uint32_t> CodegenDataModelProvider::MetadataGeneration()
+{
+    // Ember metadata, code-driven cluster registrations and notified composition changes are the only sources
+    // of the composition: a change in any of them changes the sum.
+    return static_cast<uint32_t>(emberAfMetadataStructureGeneration()) + mRegistry.GetGeneration() +
+        GetNotifiedCompositionChanges();
+}
+
 const EmberAfCluster * CodegenDataModelProvider::FindServerCluster(const ConcreteClusterPath & path)
 {
     if (mPreviouslyFoundCluster.has_value() && (mPreviouslyFoundCluster->path == path) &&
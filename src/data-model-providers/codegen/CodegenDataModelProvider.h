@@ -89,6 +89,7 @@ public:
     CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path,
                                 ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & builder) override;
     CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder) override;
+    std::optional<uint32_t> MetadataGeneration() override;
 
 protected:
     // Temporary hack for a test: Initializes the data model for testing purposes only.
@@ -91,6 +91,16 @@
 #define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 100
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE
+ *
+ * The number of events that the lock-free ring of the chip Platform event queue holds on POSIX platforms.
+ * Events posted while the ring is full spill over into a slower, mutex-guarded list. Must be a power of two.
+ */
+#ifndef CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE 1024
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
  *
@@ -24,7 +24,7 @@
 
 #pragma once
 
-#include <platform/DeviceSafeQueue.h>
+#include <platform/DeviceEventQueue.h>
 #include <platform/internal/GenericPlatformManagerImpl.h>
 
 #include <fcntl.h>
@@ -51,6 +51,15 @@ namespace Internal {
 template <class ImplClass>
 class GenericPlatformManagerImpl_POSIX : public GenericPlatformManagerImpl<ImplClass>
 {
+public:
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    /**
+     * Counters for the queue of events posted to the CHIP event loop, e.g. its depth and how many
+     * posts were coalesced into an already pending wakeup of the loop. May be called from any thread.
+     */
+    DeviceEventQueue::Stats GetEventQueueStats() const { return mChipEventQueue.GetStats(); }
+#endif
+
 protected:
     // OS-specific members (pthread)
     pthread_mutex_t mChipStackLock = PTHREAD_MUTEX_INITIALIZER;
@@ -108,7 +117,7 @@ private:
     static void _DispatchEventViaScheduleWork(System::Layer * aLayer, void * appState);
 #else
 
-    DeviceSafeQueue mChipEventQueue;
+    DeviceEventQueue mChipEventQueue;
     std::atomic<bool> mShouldRunEventLoop{ true };
     static void * EventLoopTaskMain(void * arg);
 #endif
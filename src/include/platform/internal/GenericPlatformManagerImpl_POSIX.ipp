@@ -181,9 +181,14 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
     SystemLayer().ScheduleWork(&_DispatchEventViaScheduleWork, eventCopyP);
     return CHIP_NO_ERROR;
 #else
-    mChipEventQueue.Push(*event);
+    bool needsWake;
+    mChipEventQueue.Push(*event, needsWake);
 
-    SystemLayerSelectLoop().Signal(); // Trigger wake select on CHIP thread
+    // Bursts of events posted before the CHIP thread gets to them only need to wake it once.
+    if (needsWake)
+    {
+        SystemLayerSelectLoop().Signal(); // Trigger wake select on CHIP thread
+    }
     return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
@@ -193,11 +198,7 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
-    {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
-        Impl()->DispatchEvent(&event);
-    }
+    mChipEventQueue.Drain([this](const ChipDeviceEvent & event) { Impl()->DispatchEvent(&event); });
 }
 
 template <class ImplClass>
@@ -248,6 +248,23 @@
 #define CHIP_CONFIG_P256_KEYPAIR_HANDLE_SIZE (0)
 #endif // CHIP_CONFIG_P256_KEYPAIR_HANDLE_SIZE
 
+/**
+ *  @def CHIP_CONFIG_OPENSSL_AES_CCM_CONTEXT_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of keyed AES-CCM cipher contexts kept by the OpenSSL CryptoPAL.
+ *
+ *  A message encrypted or decrypted with a key that has a cached context reuses its key
+ *  schedule instead of allocating and keying a new context.  Each session uses two keys,
+ *  one per direction.  The least recently used context is replaced when the cache is full,
+ *  and the context of a session key is released when the key is destroyed.
+ *
+ *  Set to 0 to allocate a new context for every message.
+ */
+#ifndef CHIP_CONFIG_OPENSSL_AES_CCM_CONTEXT_CACHE_SIZE
+#define CHIP_CONFIG_OPENSSL_AES_CCM_CONTEXT_CACHE_SIZE 32
+#endif // CHIP_CONFIG_OPENSSL_AES_CCM_CONTEXT_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_CRYPTO_PSA_KEY_ID_BASE
  *
@@ -799,6 +816,18 @@
 #define CHIP_CONFIG_MAX_FABRICS 16
 #endif // CHIP_CONFIG_MAX_FABRICS
 
+/**
+ *  @def CHIP_CONFIG_VALIDATED_CERT_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of CA certificate signatures a FabricTable remembers as verified, so that
+ *    the ICAC of a peer does not have its signature verified again on every CASE
+ *    handshake.  The default allows for one ICAC per fabric.
+ */
+#ifndef CHIP_CONFIG_VALIDATED_CERT_CACHE_SIZE
+#define CHIP_CONFIG_VALIDATED_CERT_CACHE_SIZE CHIP_CONFIG_MAX_FABRICS
+#endif // CHIP_CONFIG_VALIDATED_CERT_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
  *
@@ -956,6 +985,31 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_REPORT_PACING_INTERVAL_MS
+ *
+ * @brief Defines the interval at which ReportSchedulerImpl releases due subscription reports once the reporting engine is
+ *        saturated, that is once the reports in flight and the reports due add up to CHIP_IM_MAX_REPORTS_IN_FLIGHT. Further
+ *        due reports are then spread over time, in the order they became due, instead of all being sent in one burst. A
+ *        report is never held back past the max interval of its subscription.
+ *
+ * A value of 0 disables pacing: every report is scheduled as soon as its min interval elapses.
+ */
+#ifndef CHIP_IM_REPORT_PACING_INTERVAL_MS
+#define CHIP_IM_REPORT_PACING_INTERVAL_MS 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_PENDING_READ_TIMEOUT_MS
+ *
+ * @brief Defines how long a report waits for an attribute value that the data model provider could not read synchronously
+ *        (see DataModel::ActionReturnStatus::IsPendingResponse) before reporting a Timeout status for that attribute. It
+ *        should be well below the time clients wait for a report.
+ */
+#ifndef CHIP_IM_SERVER_PENDING_READ_TIMEOUT_MS
+#define CHIP_IM_SERVER_PENDING_READ_TIMEOUT_MS 1000
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -983,6 +1037,40 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_DIRTY_SET_INDEX_SIZE
+ *
+ * @brief Defines the number of buckets of the index of the dirty set by endpoint and cluster, rounded up to a power of two.
+ *        Platforms using heap-allocated pools, where the dirty set is not limited by CHIP_IM_SERVER_MAX_NUM_DIRTY_SET,
+ *        may want a larger index.
+ */
+#ifndef CHIP_IM_SERVER_DIRTY_SET_INDEX_SIZE
+#define CHIP_IM_SERVER_DIRTY_SET_INDEX_SIZE CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_REPORT_CACHE_SIZE
+ *
+ * @brief Defines the size in bytes of the cache of encoded attribute reports shared by the subscriptions served in one run
+ *        of the reporting engine, so that an attribute reported to several subscribers is only read and encoded once.
+ *        An attribute is only cached while the cache has at least as much free space as the report being built, so the
+ *        cache should be several times the size of a report.  The cache is disabled, and takes no space, when set to 0.
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_CACHE_SIZE
+#define CHIP_CONFIG_IM_REPORT_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES
+ *
+ * @brief Defines the maximum number of endpoint, cluster and attribute entries of the data model composition kept by the
+ *        reporting engine to expand wildcard paths without querying the data model provider again for every report.
+ *        The snapshot is heap-allocated on first use and disabled when set to 0.
+ */
+#ifndef CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES
+#define CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1128,6 +1216,60 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_DEVICE_MAX_ACTIVE_DEVICES 4
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_ADMISSION_MAX_CONCURRENT
+ *
+ * @brief Default maximum number of session setups that CASESessionManager
+ *        runs concurrently (address resolution and CASE handshake).  Further
+ *        requests wait in the admission queue until one of them completes.
+ *        If 0, new session setups start right away, as many as the session
+ *        setup pool allows, and are not paced.  CASESessionManagerConfig
+ *        overrides it at runtime.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_ADMISSION_MAX_CONCURRENT
+#define CHIP_CONFIG_CASE_SESSION_ADMISSION_MAX_CONCURRENT 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_ADMISSION_QUEUE_SIZE
+ *
+ * @brief Default maximum number of peers whose session setup can wait in
+ *        the admission queue of CASESessionManager.  The entries are
+ *        allocated as needed.  Requests beyond that fail with
+ *        CHIP_ERROR_NO_MEMORY.  If 0, the queue is not limited.
+ *        CASESessionManagerConfig overrides it at runtime.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_ADMISSION_QUEUE_SIZE
+#define CHIP_CONFIG_CASE_SESSION_ADMISSION_QUEUE_SIZE 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_ADMISSION_INTERVAL_MS
+ *
+ * @brief Minimum delay, in milliseconds, between the starts of two session
+ *        setups admitted by CASESessionManager, so that a burst of requests,
+ *        e.g. when a controller restarts, does not flood the network with
+ *        DNS-SD queries and Sigma1 messages.  A random delay of up to
+ *        CHIP_CONFIG_CASE_SESSION_ADMISSION_JITTER_MS is added to it.
+ *        A request made while the queue is empty and the delay has elapsed
+ *        starts right away.  Only applies when the number of concurrent
+ *        session setups is limited, see
+ *        CHIP_CONFIG_CASE_SESSION_ADMISSION_MAX_CONCURRENT.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_ADMISSION_INTERVAL_MS
+#define CHIP_CONFIG_CASE_SESSION_ADMISSION_INTERVAL_MS 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_ADMISSION_JITTER_MS
+ *
+ * @brief Maximum random delay, in milliseconds, added to
+ *        CHIP_CONFIG_CASE_SESSION_ADMISSION_INTERVAL_MS.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_ADMISSION_JITTER_MS
+#define CHIP_CONFIG_CASE_SESSION_ADMISSION_JITTER_MS 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_ENDPOINTS_PER_FABRIC
  *
@@ -1311,6 +1453,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
     "Please enable at least one of CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT or CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FLEXIBLE_COPY_SUPPORT"
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * Number of recent access control decisions (subject, path, privilege) remembered by
+ * AccessControl::Check, so that checking the same access again (e.g. for every attribute of
+ * a cluster in a wildcard read) does not evaluate the ACL again. Remembered decisions are
+ * dropped whenever the ACL entries of their fabric change.
+ *
+ * Must be a power of two, or 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_ACCESS_RESTRICTION_MAX_ENTRIES_PER_FABRIC
  *
@@ -1342,6 +1498,22 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_RESUME_INDEX_WRITE_DELAY_MS
+ *
+ * @brief
+ *   Delay, in milliseconds, before the index of the cached CASE sessions is written
+ *   to storage after a session is added to it, so that the sessions established
+ *   meanwhile are written at once.  If 0, the index is written right away.
+ *
+ *   The state of each session is always written right away, and the pending index
+ *   is written on shutdown.  A session whose index entry is lost, e.g. on a power
+ *   loss, is added back to the index when its peer is looked up or saved again.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_RESUME_INDEX_WRITE_DELAY_MS
+#define CHIP_CONFIG_CASE_SESSION_RESUME_INDEX_WRITE_DELAY_MS 1000
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1362,6 +1534,23 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS
+ *
+ * @brief Number of blocks of the index kept alongside every event logging buffer.
+ *
+ * Each block summarizes a run of consecutive events of the buffer (where they start, the
+ * number of the last one, and which endpoints and clusters they belong to), so that fetching
+ * events for a report can seek to the first event it wants and skip runs of events it is not
+ * interested in instead of decoding every event of the log. Every block costs 32 bytes per
+ * buffer.
+ *
+ * Must be at least 2, or 0 to disable the index.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS 0
+#endif /* CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1371,6 +1560,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ENABLE_SERVER_IM_EVENT 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS
+ *
+ * @brief If 1, the server reserves static event buffers, of the
+ *        CHIP_DEVICE_CONFIG_EVENT_LOGGING_*_BUFFER_SIZE sizes, for when
+ *        ServerInitParams::eventLogStorageResources is not provided.  If 0,
+ *        they are allocated from the heap in that case only, so that
+ *        applications providing their own event log storage do not pay for
+ *        them.  Defaults to 0 on platforms with heap object pools.
+ */
+#ifndef CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS
+#define CHIP_CONFIG_SERVER_STATIC_EVENT_LOG_BUFFERS (!CHIP_SYSTEM_CONFIG_POOL_USE_HEAP)
+#endif
+
 /**
  *  @def CHIP_RESUBSCRIBE_MAX_RETRY_WAIT_INTERVAL_MS
  *
@@ -106,6 +106,31 @@ void TLVCircularBuffer::Init(uint8_t * inBuffer, uint32_t inBufferLength)
     mImplicitProfileId = kCommonProfileId;
 }
 
+/**
+ * @brief
+ *   Restore the state of a buffer whose backing store already holds
+ *   elements, e.g. a backing store persisted across restarts.
+ *
+ * @param[in] inHeadOffset Offset, in the backing store, of the oldest
+ *                         element
+ *
+ * @param[in] inDataLength Length, in bytes, of the elements, which may
+ *                         wrap around the end of the backing store
+ *
+ * @retval #CHIP_NO_ERROR               On success.
+ *
+ * @retval #CHIP_ERROR_INVALID_ARGUMENT If the state does not fit the
+ *                                      backing store.
+ */
+CHIP_ERROR TLVCircularBuffer::Restore(uint32_t inHeadOffset, uint32_t inDataLength)
+{
+    VerifyOrReturnError(inHeadOffset < mQueueSize && inDataLength <= mQueueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mQueueHead   = mQueue + inHeadOffset;
+    mQueueLength = inDataLength;
+    return CHIP_NO_ERROR;
+}
+
 /**
  * @brief
  *   Evicts the oldest top-level TLV element in the TLVCircularBuffer
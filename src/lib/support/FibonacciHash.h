@@ -0,0 +1,59 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Fibonacci hashing of integer keys for the hash indexes of the stack.
+ *
+ *      Multiplying a key by 2^N divided by the golden ratio spreads keys that differ only in their low bits, such as
+ *      sequentially allocated IDs, over the high bits of the product, so the hash is taken from those high bits.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+
+inline constexpr uint32_t FibonacciHash(uint32_t key)
+{
+    return key * 0x9E3779B1u;
+}
+
+inline constexpr uint64_t FibonacciHash64(uint64_t key)
+{
+    return key * 0x9E3779B97F4A7C15ull;
+}
+
+/**
+ * Mixes value into hash, to hash keys made of several fields.
+ */
+inline constexpr uint32_t FibonacciHashCombine(uint32_t hash, uint32_t value)
+{
+    return FibonacciHash(hash) ^ value;
+}
+
+/**
+ * Returns the slot of key in a table of tableSize slots, which must be a power of two no larger than 2^16.
+ */
+inline constexpr size_t FibonacciHashIndex(uint32_t key, size_t tableSize)
+{
+    return static_cast<size_t>(FibonacciHash(key) >> 16) & (tableSize - 1);
+}
+
+} // namespace chip
@@ -29,6 +29,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPEncoding.h>
 #include <lib/support/CHIPFaultInjection.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
@@ -125,7 +126,7 @@ ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, Exc
         // Disallow creating exchange on an inactive session
         return nullptr;
     }
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate);
+    return CreateContext(this, mNextExchangeId++, session, isInitiator, delegate);
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId,
@@ -291,24 +292,15 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                TEMPORARY_RETURN_IGNORED ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags,
-                                                           std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindContext(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            TEMPORARY_RETURN_IGNORED ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags,
+                                                       std::move(msgBuf));
             return;
         }
     }
@@ -391,7 +383,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             return;
         }
 
-        ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate);
+        ExchangeContext * ec = CreateContext(this, payloadHeader.GetExchangeID(), session, false, delegate);
 
         if (ec == nullptr)
         {
@@ -450,8 +442,8 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // If rcvd msg is from initiator then this exchange is created as not Initiator.
     // If rcvd msg is not from initiator then this exchange is created as Initiator.
     // Create a EphemeralExchange to generate a StandaloneAck
-    ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(),
-                                                     nullptr, true /* IsEphemeralExchange */);
+    ExchangeContext * ec = CreateContext(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), nullptr,
+                                         true /* IsEphemeralExchange */);
 
     if (ec == nullptr)
     {
@@ -474,6 +466,99 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // The exchange should be closed inside HandleMessage function. So don't bother close it here.
 }
 
+ExchangeManager::ExchangeIndex::~ExchangeIndex()
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::MemoryFree(mBuckets);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+}
+
+CHIP_ERROR ExchangeManager::ExchangeIndex::Insert(ExchangeContext * ec)
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // Keep the buckets at most as many as the exchanges, so that the lists stay short. If they cannot grow, the
+    // lists just get longer, as long as there are buckets at all.
+    if (mCount + 1 > mSize)
+    {
+        CHIP_ERROR err = Grow();
+        VerifyOrReturnError(err == CHIP_NO_ERROR || mSize > 0, err);
+    }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    InsertInBuckets(ec);
+    mCount++;
+    return CHIP_NO_ERROR;
+}
+
+void ExchangeManager::ExchangeIndex::InsertInBuckets(ExchangeContext * ec)
+{
+    // Append, so that exchanges with the same key are matched in order of creation.
+    ExchangeContext ** link = &mBuckets[Bucket(ec->GetExchangeId(), ec->IsInitiator())];
+    while (*link != nullptr)
+    {
+        link = &(*link)->mNextInIndex;
+    }
+    ec->mNextInIndex = nullptr;
+    *link            = ec;
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+CHIP_ERROR ExchangeManager::ExchangeIndex::Grow()
+{
+    const size_t newSize = (mSize == 0) ? kInitialSize : mSize * 2;
+    auto ** newBuckets   = static_cast<ExchangeContext **>(Platform::MemoryCalloc(newSize, sizeof(ExchangeContext *)));
+    VerifyOrReturnError(newBuckets != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    ExchangeContext ** oldBuckets = mBuckets;
+    const size_t oldSize          = mSize;
+    mBuckets                      = newBuckets;
+    mSize                         = newSize;
+    // Exchanges with the same key share their old bucket, so moving each list in order keeps them in order of creation.
+    for (size_t bucket = 0; bucket < oldSize; bucket++)
+    {
+        ExchangeContext * ec = oldBuckets[bucket];
+        while (ec != nullptr)
+        {
+            ExchangeContext * next = ec->mNextInIndex;
+            InsertInBuckets(ec);
+            ec = next;
+        }
+    }
+    Platform::MemoryFree(oldBuckets);
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+void ExchangeManager::ExchangeIndex::Remove(ExchangeContext * ec)
+{
+    VerifyOrReturn(mCount > 0);
+
+    ExchangeContext ** link = &mBuckets[Bucket(ec->GetExchangeId(), ec->IsInitiator())];
+    while (*link != nullptr)
+    {
+        if (*link == ec)
+        {
+            *link            = ec->mNextInIndex;
+            ec->mNextInIndex = nullptr;
+            mCount--;
+            return;
+        }
+        link = &(*link)->mNextInIndex;
+    }
+}
+
+ExchangeContext * ExchangeManager::FindContext(const SessionHandle & session, const PacketHeader & packetHeader,
+                                               const PayloadHeader & payloadHeader)
+{
+    // A message sent by an initiator belongs to a responder exchange, and vice versa.
+    ExchangeContext * ec = mExchangeIndex.First(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator());
+    while (ec != nullptr && !ec->MatchExchange(session, packetHeader, payloadHeader))
+    {
+        ec = ec->mNextInIndex;
+    }
+    return ec;
+}
+
 void ExchangeManager::CloseAllContextsForDelegate(const ExchangeDelegate * delegate)
 {
     mContextPool.ForEachActiveObject([&](auto * ec) {
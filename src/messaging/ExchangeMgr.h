@@ -25,8 +25,10 @@
 #pragma once
 
 #include <array>
+#include <utility>
 
 #include <lib/support/DLLUtil.h>
+#include <lib/support/FibonacciHash.h>
 #include <lib/support/Pool.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeContext.h>
@@ -45,6 +47,20 @@ class TestOnlyReceivedMessageObserver;
 
 static constexpr int16_t kAnyMessageType = -1;
 
+/**
+ * Number of buckets of the exchange index of an ExchangeManager for a pool of @a poolSize
+ * exchanges: the smallest power of two that is at least @a poolSize.
+ */
+constexpr size_t ExchangeIndexSize(size_t poolSize)
+{
+    size_t size = 1;
+    while (size < poolSize)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
 /**
  *  @brief
  *    This class is used to manage ExchangeContexts with other CHIP nodes.
@@ -111,7 +127,11 @@ public:
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator = true);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec)
+    {
+        mExchangeIndex.Remove(ec);
+        mContextPool.ReleaseObject(ec);
+    }
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -244,6 +264,83 @@ private:
         UnsolicitedMessageHandler * Handler;
     };
 
+    /**
+     * An index of the allocated exchanges by exchange ID and initiator flag, so that the exchange of a received
+     * message can be found without walking the exchange pool. Each bucket is a list of exchanges linked through
+     * ExchangeContext::mNextInIndex, in order of creation. Both parts of the key are fixed for the lifetime of an
+     * exchange, while its session may change, so the session is checked by ExchangeContext::MatchExchange() on lookup.
+     *
+     * With a static exchange pool, the index has one bucket per exchange of CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS.
+     * With a heap exchange pool, which can hold more exchanges than that, the buckets are allocated on first use
+     * and doubled whenever there are more exchanges than buckets.
+     */
+    class ExchangeIndex
+    {
+    public:
+        ExchangeIndex() = default;
+        ~ExchangeIndex();
+
+        ExchangeIndex(const ExchangeIndex &)             = delete;
+        ExchangeIndex & operator=(const ExchangeIndex &) = delete;
+
+        /**
+         * @retval CHIP_ERROR_NO_MEMORY if the buckets cannot be allocated.
+         */
+        CHIP_ERROR Insert(ExchangeContext * ec);
+        void Remove(ExchangeContext * ec);
+
+        /**
+         * The first exchange of the bucket that holds the exchanges with the given key, if any.
+         */
+        ExchangeContext * First(uint16_t exchangeId, bool isInitiator) const
+        {
+            return (mCount > 0) ? mBuckets[Bucket(exchangeId, isInitiator)] : nullptr;
+        }
+
+    private:
+        static constexpr size_t kInitialSize = ExchangeIndexSize(CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS);
+
+        size_t Bucket(uint16_t exchangeId, bool isInitiator) const
+        {
+            return FibonacciHashIndex(static_cast<uint32_t>(exchangeId) | (isInitiator ? 0x10000u : 0u), mSize);
+        }
+
+        void InsertInBuckets(ExchangeContext * ec);
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        CHIP_ERROR Grow();
+
+        ExchangeContext ** mBuckets = nullptr;
+        size_t mSize                = 0;
+#else
+        ExchangeContext * mStorage[kInitialSize] = {};
+        ExchangeContext ** mBuckets              = mStorage;
+        size_t mSize                             = kInitialSize;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        size_t mCount = 0;
+    };
+
+    /**
+     * Allocate an exchange from the pool and add it to the exchange index.
+     */
+    template <typename... Args>
+    ExchangeContext * CreateContext(Args &&... args)
+    {
+        ExchangeContext * ec = mContextPool.CreateObject(std::forward<Args>(args)...);
+        if (ec != nullptr && mExchangeIndex.Insert(ec) != CHIP_NO_ERROR)
+        {
+            mContextPool.ReleaseObject(ec);
+            ec = nullptr;
+        }
+        return ec;
+    }
+
+    /**
+     * Find the exchange that a received message belongs to, if any.
+     */
+    ExchangeContext * FindContext(const SessionHandle & session, const PacketHeader & packetHeader,
+                                  const PayloadHeader & payloadHeader);
+
     uint16_t mNextExchangeId;
     uint16_t mNextKeyId;
     State mState;
@@ -251,6 +348,7 @@ private:
     FabricIndex mFabricIndex = 0;
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+    ExchangeIndex mExchangeIndex;
 
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
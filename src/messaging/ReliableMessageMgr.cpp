@@ -23,6 +23,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <utility>
 
 #include <app/icd/server/ICDServerConfig.h>
 #include <lib/support/BitFlags.h>
@@ -50,13 +51,13 @@ namespace Messaging {
 
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
+RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
     ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
 {
     ec->SetWaitingForAck(true);
 }
 
-ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
+RetransTableEntry::~RetransTableEntry()
 {
     ec->SetWaitingForAck(false);
 }
@@ -78,7 +79,7 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseRetransEntry(*entry);
         return Loop::Continue;
     });
 
@@ -162,10 +163,13 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired, earliest first. A
+    // retransmitted entry is queued again at its new time; if that is already due, it waits for the next pass.
+    mActionPass++;
+    while (mRetransQueue != nullptr && mRetransQueue->nextRetransTime <= now && mRetransQueue->actionPass != mActionPass)
+    {
+        RetransTableEntry * entry = mRetransQueue;
+        entry->actionPass         = mActionPass;
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -212,9 +216,9 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
+            ReleaseRetransEntry(*entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -227,9 +231,7 @@ void ReliableMessageMgr::ExecuteActions()
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
 
         TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -262,6 +264,9 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    rc->mRetransEntry = *rEntry;
+    QueueRetransEntry(**rEntry);
+
     return CHIP_NO_ERROR;
 }
 
@@ -338,29 +343,26 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
+    // An exchange has at most one message waiting for an ack.
+    RetransTableEntry * entry = rc->mRetransEntry;
+    if (entry == nullptr || entry->retainedBuf.GetMessageCounter() != ackMessageCounter)
+    {
+        return false;
+    }
+
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-            auto session = entry->ec->GetSessionHandle();
-            NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
+    auto session = entry->ec->GetSessionHandle();
+    NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
-
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
 
-    return removed;
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -425,23 +427,117 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    if (rc->mRetransEntry != nullptr)
+    {
+        ClearRetransTable(*rc->mRetransEntry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
 
+void ReliableMessageMgr::ReleaseRetransEntry(RetransTableEntry & entry)
+{
+    DequeueRetransEntry(entry);
+    entry.ec->GetReliableMessageContext()->mRetransEntry = nullptr;
+    mRetransTable.ReleaseObject(&entry);
+}
+
+void ReliableMessageMgr::QueueRetransEntry(RetransTableEntry & entry)
+{
+    entry.queueChild = nullptr;
+    entry.queueNext  = nullptr;
+    entry.queuePrev  = nullptr;
+    mRetransQueue    = MeldRetransQueues(mRetransQueue, &entry);
+}
+
+void ReliableMessageMgr::DequeueRetransEntry(RetransTableEntry & entry)
+{
+    if (&entry == mRetransQueue)
+    {
+        mRetransQueue = MeldRetransQueuePairs(entry.queueChild);
+        return;
+    }
+
+    // Unlink the entry from its siblings, then meld its children back into the queue.
+    if (entry.queuePrev->queueChild == &entry)
+    {
+        entry.queuePrev->queueChild = entry.queueNext;
+    }
+    else
+    {
+        entry.queuePrev->queueNext = entry.queueNext;
+    }
+    if (entry.queueNext != nullptr)
+    {
+        entry.queueNext->queuePrev = entry.queuePrev;
+    }
+    mRetransQueue = MeldRetransQueues(mRetransQueue, MeldRetransQueuePairs(entry.queueChild));
+}
+
+RetransTableEntry * ReliableMessageMgr::MeldRetransQueues(RetransTableEntry * a, RetransTableEntry * b)
+{
+    if (a == nullptr)
+    {
+        return b;
+    }
+    if (b == nullptr)
+    {
+        return a;
+    }
+    if (b->nextRetransTime < a->nextRetransTime)
+    {
+        std::swap(a, b);
+    }
+
+    // b becomes the first child of a.
+    b->queuePrev = a;
+    b->queueNext = a->queueChild;
+    if (a->queueChild != nullptr)
+    {
+        a->queueChild->queuePrev = b;
+    }
+    a->queueChild = b;
+    return a;
+}
+
+RetransTableEntry * ReliableMessageMgr::MeldRetransQueuePairs(RetransTableEntry * first)
+{
+    // Meld the siblings in pairs from left to right, collecting the results in reverse order, then meld those
+    // from right to left.
+    RetransTableEntry * pairs = nullptr;
+    while (first != nullptr)
+    {
+        RetransTableEntry * a = first;
+        RetransTableEntry * b = a->queueNext;
+        first                 = (b != nullptr) ? b->queueNext : nullptr;
+
+        a->queueNext = a->queuePrev = nullptr;
+        if (b != nullptr)
+        {
+            b->queueNext = b->queuePrev = nullptr;
+        }
+
+        RetransTableEntry * melded = MeldRetransQueues(a, b);
+        melded->queueNext          = pairs;
+        pairs                      = melded;
+    }
+
+    RetransTableEntry * root = nullptr;
+    while (pairs != nullptr)
+    {
+        RetransTableEntry * next = pairs->queueNext;
+        pairs->queueNext         = nullptr;
+        root                     = MeldRetransQueues(root, pairs);
+        pairs                    = next;
+    }
+    return root;
+}
+
 void ReliableMessageMgr::StartTimer()
 {
     // When do we need to next wake up to send an ACK?
@@ -455,13 +551,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mRetransQueue != nullptr && mRetransQueue->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransQueue->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -566,7 +659,10 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
     System::Clock::Timeout baseTimeout = sessionHandle->GetMRPBaseTimeout();
 
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
-    entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+
+    DequeueRetransEntry(entry);
+    entry.nextRetransTime = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    QueueRetransEntry(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
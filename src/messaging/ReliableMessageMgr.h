@@ -44,33 +44,41 @@ namespace Messaging {
 enum class SendMessageFlags : uint16_t;
 class ReliableMessageContext;
 
+/**
+ *  @class RetransTableEntry
+ *
+ *  @brief
+ *    This class is part of the CHIP Reliable Messaging Protocol and is used
+ *    to keep track of CHIP messages that have been sent and are expecting an
+ *    acknowledgment back. If the acknowledgment is not received within a
+ *    specific timeout, the message would be retransmitted from this table.
+ *
+ */
+struct RetransTableEntry
+{
+    RetransTableEntry(ReliableMessageContext * rc);
+    ~RetransTableEntry();
+
+    ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
+    EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
+    System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+    uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
+                                                   including both successfully and failure send. */
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+    System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
+#endif                                        // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+
+    // Links of the retransmission queue, a pairing heap ordered by nextRetransTime, managed by ReliableMessageMgr.
+    RetransTableEntry * queueChild = nullptr; /**< First child of this entry. */
+    RetransTableEntry * queueNext  = nullptr; /**< Next sibling of this entry. */
+    RetransTableEntry * queuePrev  = nullptr; /**< Previous sibling of this entry, or its parent if it is a first child. */
+    uint32_t actionPass            = 0;       /**< The ExecuteActions pass that last handled this entry. */
+};
+
 class ReliableMessageMgr
 {
 public:
-    /**
-     *  @class RetransTableEntry
-     *
-     *  @brief
-     *    This class is part of the CHIP Reliable Messaging Protocol and is used
-     *    to keep track of CHIP messages that have been sent and are expecting an
-     *    acknowledgment back. If the acknowledgment is not received within a
-     *    specific timeout, the message would be retransmitted from this table.
-     *
-     */
-    struct RetransTableEntry
-    {
-        RetransTableEntry(ReliableMessageContext * rc);
-        ~RetransTableEntry();
-
-        ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
-        EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
-        System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
-        uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
-                                                       including both successfully and failure send. */
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-        System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
-#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-    };
+    using RetransTableEntry = Messaging::RetransTableEntry;
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
     ~ReliableMessageMgr();
@@ -129,8 +137,7 @@ public:
     void StartRetransmision(RetransTableEntry * entry);
 
     /**
-     *  Iterate through active exchange contexts and retrans table entries. Clear the entry matching
-     *  the specified ExchangeContext and the message ID from the retransmision table.
+     *  Clear the entry matching the specified ExchangeContext and the message ID from the retransmision table.
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
@@ -165,7 +172,7 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
+     * Iterate through active exchange contexts and look at the earliest retrans table entry.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
      * need to physically wake the CPU to perform an action.  Set a timer to go off
      * when we next need to wake the system.
@@ -243,6 +250,20 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Remove an entry from the retransmission queue and table, and release it.
+     */
+    void ReleaseRetransEntry(RetransTableEntry & entry);
+
+    // Add an entry to, or remove it from, the retransmission queue. An entry must be removed before its
+    // nextRetransTime is changed and added back afterwards.
+    void QueueRetransEntry(RetransTableEntry & entry);
+    void DequeueRetransEntry(RetransTableEntry & entry);
+
+    // Pairing heap operations on retransmission queue roots.
+    static RetransTableEntry * MeldRetransQueues(RetransTableEntry * a, RetransTableEntry * b);
+    static RetransTableEntry * MeldRetransQueuePairs(RetransTableEntry * first);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -266,6 +287,13 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // Every entry of mRetransTable, ordered by next retransmission time so that the timer only has to look at the
+    // entries that are due. This is the root of the heap, i.e. the entry to retransmit first.
+    RetransTableEntry * mRetransQueue = nullptr;
+
+    // Incremented by each ExecuteActions, so that an entry is handled at most once per pass.
+    uint32_t mActionPass = 0;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     ReliableMessageAnalyticsDelegate * mAnalyticsDelegate = nullptr;
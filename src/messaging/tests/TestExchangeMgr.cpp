@@ -58,6 +58,9 @@ struct TestExchangeMgr : public chip::Testing::LoopbackMessagingContext
 #endif
         chip::Testing::LoopbackMessagingContext::SetUp();
     }
+
+    template <int kNumExchanges>
+    void CheckResponsesMatchTheirExchange();
 };
 
 enum : uint8_t
@@ -277,6 +280,95 @@ TEST_F(TestExchangeMgr, CheckExchangeMessages)
     EXPECT_EQ(removedHandler, &mockUnsolicitedAppDelegate);
 }
 
+class RespondingAppDelegate : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        return ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                               SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
+class ResponseRecordingDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        mResponseExchange = ec;
+        mResponseCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    ExchangeContext * mResponseExchange = nullptr;
+    int mResponseCount                  = 0;
+};
+
+// Both ends of each exchange live in the same exchange manager here, so every responder exchange has the same
+// exchange ID as an initiator exchange. Each response must still be delivered to the exchange it was sent on.
+template <int kNumExchanges>
+void TestExchangeMgr::CheckResponsesMatchTheirExchange()
+{
+    RespondingAppDelegate responder;
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &responder),
+              CHIP_NO_ERROR);
+
+    ResponseRecordingDelegate initiators[kNumExchanges];
+    ExchangeContext * exchanges[kNumExchanges];
+    for (int i = 0; i < kNumExchanges; i++)
+    {
+        exchanges[i] = NewExchangeToAlice(&initiators[i]);
+        ASSERT_NE(exchanges[i], nullptr);
+    }
+
+    // Send in batches, so that the messages in flight do not run out of packet buffers.
+    constexpr int kBatchSize = 4;
+    for (int i = 0; i < kNumExchanges; i++)
+    {
+        EXPECT_SUCCESS(exchanges[i]->SendMessage(
+            Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+            SendFlags(Messaging::SendMessageFlags::kExpectResponse).Set(Messaging::SendMessageFlags::kNoAutoRequestAck)));
+        if ((i + 1) % kBatchSize == 0 || i + 1 == kNumExchanges)
+        {
+            DrainAndServiceIO();
+        }
+    }
+
+    for (int i = 0; i < kNumExchanges; i++)
+    {
+        EXPECT_EQ(initiators[i].mResponseCount, 1);
+        EXPECT_EQ(initiators[i].mResponseExchange, exchanges[i]);
+    }
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1), CHIP_NO_ERROR);
+}
+
+TEST_F(TestExchangeMgr, CheckResponsesMatchTheirExchange)
+{
+    CheckResponsesMatchTheirExchange<4>();
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+// The exchange index grows with a heap exchange pool, which can hold more exchanges than CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS.
+TEST_F(TestExchangeMgr, CheckResponsesMatchTheirExchangeBeyondPoolSize)
+{
+    CheckResponsesMatchTheirExchange<4 * CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS>();
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 class MockUHTempUnregister : public UnsolicitedMessageHandler, public ExchangeDelegate
 {
 public:
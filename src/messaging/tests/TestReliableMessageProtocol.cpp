@@ -373,6 +373,96 @@ TEST_F(TestReliableMessageProtocol, CheckAddClearRetrans)
     exchange->Close();
 }
 
+TEST_F(TestReliableMessageProtocol, CheckClearRetransOnSeveralExchanges)
+{
+    constexpr size_t kNumExchanges = 4;
+
+    MockAppDelegate mockAppDelegate(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    ExchangeContext * exchanges[kNumExchanges];
+    for (auto & exchange : exchanges)
+    {
+        exchange = NewExchangeToAlice(&mockAppDelegate);
+        ASSERT_NE(exchange, nullptr);
+
+        ReliableMessageMgr::RetransTableEntry * entry;
+        EXPECT_SUCCESS(rm->AddToRetransTable(exchange->GetReliableMessageContext(), &entry));
+        EXPECT_TRUE(exchange->GetReliableMessageContext()->IsWaitingForAck());
+    }
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumExchanges));
+
+    // An exchange only has one entry, and clearing it leaves the entries of the other exchanges alone.
+    ReliableMessageMgr::RetransTableEntry * duplicate;
+    EXPECT_EQ(rm->AddToRetransTable(exchanges[1]->GetReliableMessageContext(), &duplicate), CHIP_ERROR_INCORRECT_STATE);
+    rm->ClearRetransTable(exchanges[1]);
+    EXPECT_FALSE(exchanges[1]->GetReliableMessageContext()->IsWaitingForAck());
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumExchanges - 1));
+    rm->ClearRetransTable(exchanges[1]);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumExchanges - 1));
+
+    for (auto & exchange : exchanges)
+    {
+        rm->ClearRetransTable(exchange);
+        exchange->Close();
+    }
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+}
+
+/**
+ * Tests that messages sent on several exchanges are each retransmitted until acknowledged:
+ *
+ * 1) DUT sends a message on each of several exchanges to PEER
+ *      - Force PEER to drop the initial message of every exchange
+ * 2) DUT retransmits each message once its own backoff expires
+ *      - PEER acknowledges the retransmitted messages
+ *      - Observe the retransmit table becoming empty
+ */
+TEST_F(TestReliableMessageProtocol, CheckResendApplicationMessageOnSeveralExchanges)
+{
+    constexpr uint32_t kNumExchanges = 4;
+
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = kNumExchanges;
+    loopback.mDroppedMessageCount = 0;
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    for (uint32_t i = 0; i < kNumExchanges; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        EXPECT_FALSE(buffer.IsNull());
+
+        ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    }
+    DrainAndServiceIO();
+
+    // Ensure the initial messages were all dropped and added to the retransmit table
+    EXPECT_EQ(loopback.mDroppedMessageCount, kNumExchanges);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumExchanges));
+
+    // Wait for every message to be retransmitted and acknowledged (the first retransmits should take 70-88ms)
+    GetIOContext().DriveIOUntil(1000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    DrainAndServiceIO();
+
+    EXPECT_EQ(loopback.mDroppedMessageCount, kNumExchanges);
+    EXPECT_GE(loopback.mSentMessageCount, 2 * kNumExchanges);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+}
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -0,0 +1,180 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the CHIP device event queue which operates in a FIFO context (first-in first-out).
+ *
+ *      The queue is a ring of slots, each tagged with a sequence number that tells producers and the consumer
+ *      whether the slot is free for the current lap of the ring or holds a published event, backed by an
+ *      overflow list for the events that do not fit in the ring.
+ */
+
+#include <platform/DeviceEventQueue.h>
+
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+DeviceEventQueue::DeviceEventQueue()
+{
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        mSlots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+void DeviceEventQueue::Push(const ChipDeviceEvent & event, bool & needsWake)
+{
+    needsWake = false;
+
+    // Once events have spilled over, later ones follow them until the consumer has drained the overflow list, so that
+    // they stay in order.
+    size_t depth;
+    if (mOverflowSize.load() != 0 || !TryPushRing(event, depth))
+    {
+        std::lock_guard<std::mutex> lock(mOverflowLock);
+        if (mOverflow.empty())
+        {
+            ChipLogError(DeviceLayer, "CHIP event queue is full (%u events), growing it", static_cast<unsigned>(kCapacity));
+        }
+        mOverflow.push(event);
+        mOverflowSize.store(mOverflow.size());
+        mOverflowed.fetch_add(1, std::memory_order_relaxed);
+        depth = kCapacity + mOverflow.size();
+    }
+
+    size_t maxDepth = mMaxDepth.load(std::memory_order_relaxed);
+    while (depth > maxDepth && !mMaxDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed))
+    {
+    }
+
+    // Only the first push after the consumer started draining needs to wake it up. The fence pairs with the one in
+    // Drain(): either the consumer sees this event, or this push sees the wakeup cleared.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!mWakePending.exchange(true))
+    {
+        needsWake = true;
+        mWakeups.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool DeviceEventQueue::TryPushRing(const ChipDeviceEvent & event, size_t & depth)
+{
+    Slot * slot;
+    size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        slot                = &mSlots[pos & (kCapacity - 1)];
+        const size_t seq    = slot->sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds the event from the previous lap: the ring is full.
+            return false;
+        }
+        else
+        {
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->event = event;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    depth = pos + 1 - mDequeuePos.load(std::memory_order_relaxed);
+    return true;
+}
+
+bool DeviceEventQueue::Pop(ChipDeviceEvent & event)
+{
+    return PopRing(event) || PopOverflow(event);
+}
+
+bool DeviceEventQueue::PopRing(ChipDeviceEvent & event)
+{
+    const size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+    Slot & slot      = mSlots[pos & (kCapacity - 1)];
+
+    // A slot that was claimed but not yet published ends the drain; its producer will see the wakeup cleared and
+    // signal again once it has published.
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+    {
+        return false;
+    }
+
+    event = slot.event;
+    slot.sequence.store(pos + kCapacity, std::memory_order_release);
+    mDequeuePos.store(pos + 1, std::memory_order_relaxed);
+    return true;
+}
+
+bool DeviceEventQueue::PopOverflow(ChipDeviceEvent & event)
+{
+    // Events in the overflow list were pushed after those in the ring, including any claimed slot that is not
+    // published yet, so the ring must be empty first.
+    if (mOverflowSize.load() == 0 || mEnqueuePos.load() != mDequeuePos.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mOverflowLock);
+    if (mOverflow.empty())
+    {
+        return false;
+    }
+
+    event = mOverflow.front();
+    mOverflow.pop();
+    mOverflowSize.store(mOverflow.size());
+    return true;
+}
+
+bool DeviceEventQueue::Empty() const
+{
+    const size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+    return mSlots[pos & (kCapacity - 1)].sequence.load(std::memory_order_acquire) != pos + 1 && mOverflowSize.load() == 0;
+}
+
+DeviceEventQueue::Stats DeviceEventQueue::GetStats() const
+{
+    const size_t dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+    const size_t enqueuePos = mEnqueuePos.load(std::memory_order_relaxed);
+
+    Stats stats;
+    stats.depth      = ((enqueuePos > dequeuePos) ? enqueuePos - dequeuePos : 0) + mOverflowSize.load();
+    stats.maxDepth   = mMaxDepth.load(std::memory_order_relaxed);
+    stats.overflowed = mOverflowed.load(std::memory_order_relaxed);
+    stats.pushed     = enqueuePos + stats.overflowed;
+    stats.wakeups    = mWakeups.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the CHIP device event queue which operates in a FIFO context (first-in first-out).
+ *      Events can be pushed from any thread without locking, and are consumed by the single CHIP event loop thread.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+
+#include <lib/core/CHIPCore.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/CHIPDeviceEvent.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+/**
+ *  @class DeviceEventQueue
+ *
+ *  @brief
+ *      This class represents a multi-producer single-consumer message queue used by the CHIP event loop to hold
+ *      incoming messages. Each message is sequentially dequeued, decoded, and then an action is performed.
+ *
+ *      Events normally go through a lock-free ring, in which producers claim a slot with a single compare-and-swap
+ *      and never block each other or the consumer. When the ring is full, events spill over into a mutex-guarded
+ *      list, and later events follow them there until the consumer has drained it, so that no event is lost and
+ *      events pushed by one thread are processed in order. The queue also tracks whether the consumer has already
+ *      been asked to wake up, so that a burst of pushes between two drains results in a single wakeup of the event
+ *      loop rather than one per push.
+ *
+ */
+class DeviceEventQueue
+{
+public:
+    static constexpr size_t kCapacity = CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE;
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0,
+                  "CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE must be a power of two");
+
+    struct Stats
+    {
+        // Number of events currently in the queue.
+        size_t depth;
+        // Largest number of events that have been in the queue at once.
+        size_t maxDepth;
+        // Number of events pushed.
+        uint64_t pushed;
+        // Number of events that spilled over from the ring because it was full.
+        uint64_t overflowed;
+        // Number of pushes that required waking the consumer. The remaining pushed events were coalesced into a
+        // wakeup that was already pending.
+        uint64_t wakeups;
+    };
+
+    DeviceEventQueue();
+    ~DeviceEventQueue() = default;
+
+    /**
+     * Add an event to the back of the queue. May be called from any thread.
+     *
+     * @param[in]  event      The event to add.
+     * @param[out] needsWake  Set to true if the consumer must be woken up to process the event, false if a wakeup
+     *                        is already pending.
+     */
+    void Push(const ChipDeviceEvent & event, bool & needsWake);
+
+    /**
+     * Remove all events from the queue, in order, passing each to @p handler. Events pushed by @p handler, or
+     * concurrently by other threads, are processed before returning.
+     *
+     * Must only be called from the consumer thread.
+     */
+    template <typename Handler>
+    void Drain(Handler && handler)
+    {
+        ChipDeviceEvent event;
+        do
+        {
+            // Clear the wakeup before looking at the queue: a producer that still sees it pending pushed its event
+            // before this point, so the loop below will find it.
+            mWakePending.store(false);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            while (Pop(event))
+            {
+                handler(event);
+            }
+        } while (mWakePending.load());
+    }
+
+    bool Empty() const;
+
+    Stats GetStats() const;
+
+private:
+    struct Slot
+    {
+        // Position at which the slot can next be written (== position) or read (== position + 1).
+        std::atomic<size_t> sequence;
+        ChipDeviceEvent event;
+    };
+
+    bool TryPushRing(const ChipDeviceEvent & event, size_t & depth);
+    bool Pop(ChipDeviceEvent & event);
+    bool PopRing(ChipDeviceEvent & event);
+    bool PopOverflow(ChipDeviceEvent & event);
+
+    Slot mSlots[kCapacity];
+
+    // Producer and consumer positions are kept on separate cache lines to avoid false sharing.
+    alignas(64) std::atomic<size_t> mEnqueuePos{ 0 };
+    alignas(64) std::atomic<size_t> mDequeuePos{ 0 };
+    alignas(64) std::atomic<bool> mWakePending{ false };
+
+    // Events that did not fit in the ring. mOverflowSize mirrors mOverflow.size(), so that producers and the
+    // consumer can check whether the list is in use without taking its lock.
+    std::mutex mOverflowLock;
+    std::queue<ChipDeviceEvent> mOverflow;
+    std::atomic<size_t> mOverflowSize{ 0 };
+
+    std::atomic<size_t> mMaxDepth{ 0 };
+    std::atomic<uint64_t> mOverflowed{ 0 };
+    std::atomic<uint64_t> mWakeups{ 0 };
+
+    DeviceEventQueue(const DeviceEventQueue &)             = delete;
+    DeviceEventQueue & operator=(const DeviceEventQueue &) = delete;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
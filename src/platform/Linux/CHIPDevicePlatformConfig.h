@@ -55,6 +55,41 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+ *
+ * Store the KeyValueStoreManager data in an append-only log (ChipLinuxStorageLog), so that a write
+ * costs O(value size), instead of rewriting the whole INI file (ChipLinuxStorage) on every write.
+ *
+ * Opt-in: an existing INI file is converted on first use, and there is no conversion back, so a
+ * device that enabled this cannot go back to a build without it and keep its KVS data.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT
+ *
+ * With CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED, group-commit the KeyValueStoreManager writes made
+ * in one event loop turn (see ChipLinuxStorageLog::SetGroupCommit()). A successful Put() is then not
+ * durable until the end of the event loop turn, which callers such as the fabric table do not expect,
+ * so this is off by default.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT_MAX_PENDING
+ *
+ * Number of bytes of group-committed writes that may wait for the event loop, beyond which writes are
+ * made synchronously.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT_MAX_PENDING
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT_MAX_PENDING (64 * 1024)
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT_MAX_PENDING
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
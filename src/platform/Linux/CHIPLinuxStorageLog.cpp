@@ -0,0 +1,716 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Implementation of the append-only, log-structured key-value store.
+ *
+ *          The file starts with an 8-byte magic, followed by records of the form:
+ *
+ *            uint32 crc        CRC-32 of all the following bytes of the record
+ *            uint8  type       RecordType
+ *            uint8  reserved   0
+ *            uint16 keyLen
+ *            uint32 valueLen   0 for deletions
+ *            key, value
+ *
+ *          with all integers little-endian.
+ */
+
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/Linux/CHIPLinuxStorageIni.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr char kMagic[8]          = { 'C', 'H', 'I', 'P', 'K', 'V', 'L', '1' };
+constexpr size_t kRecordHeaderLen = 12;
+// Sanity limit on the size of a single value, used to reject corrupt record headers.
+constexpr size_t kMaxValueLen = 16 * 1024 * 1024;
+
+// Compact once the file is at least this large and at least half of it is garbage.
+constexpr size_t kCompactionMinFileSize = 64 * 1024;
+
+// The stores that are initialized, by ID, so that work items can find out whether their store still exists.
+std::mutex gStoresLock;
+std::unordered_map<intptr_t, ChipLinuxStorageLog *> gStores;
+intptr_t gNextStoreId = 1;
+
+class Crc32Table
+{
+public:
+    constexpr Crc32Table() : mTable()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : (crc >> 1);
+            }
+            mTable[i] = crc;
+        }
+    }
+
+    uint32_t Update(uint32_t crc, const uint8_t * data, size_t len) const
+    {
+        crc = ~crc;
+        for (size_t i = 0; i < len; i++)
+        {
+            crc = mTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+private:
+    uint32_t mTable[256];
+};
+
+constexpr Crc32Table kCrc32;
+
+CHIP_ERROR WriteAll(int fd, size_t offset, const uint8_t * data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t written = pwrite(fd, data, len, static_cast<off_t>(offset));
+        if (written < 0)
+        {
+            VerifyOrReturnError(errno == EINTR, CHIP_ERROR_POSIX(errno));
+            continue;
+        }
+        data += written;
+        offset += static_cast<size_t>(written);
+        len -= static_cast<size_t>(written);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ReadAll(int fd, size_t offset, uint8_t * data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t count = pread(fd, data, len, static_cast<off_t>(offset));
+        if (count < 0)
+        {
+            VerifyOrReturnError(errno == EINTR, CHIP_ERROR_POSIX(errno));
+            continue;
+        }
+        VerifyOrReturnError(count > 0, CHIP_ERROR_READ_FAILED);
+        data += count;
+        offset += static_cast<size_t>(count);
+        len -= static_cast<size_t>(count);
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Make a rename() within the directory of @p path durable.
+void SyncParentDirectory(const std::string & path)
+{
+    std::string copy = path;
+    FileDescriptor dir(open(dirname(copy.data()), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (dir.Get() < 0 || fsync(dir.Get()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to sync directory of %s: %s", path.c_str(), strerror(errno));
+    }
+}
+
+} // namespace
+
+ChipLinuxStorageLog::~ChipLinuxStorageLog()
+{
+    Shutdown();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * file)
+{
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::unique_lock<std::mutex> lock(mLock);
+
+    if (mFd.Get() >= 0)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageLog::Init: Attempt to re-initialize with KVS file: %s, IGNORING.", file);
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageLog::Init: Using KVS file: %s", file);
+
+    mPath.assign(file);
+    ReturnErrorOnFailure(ReopenLocked());
+
+    // Convert a store written by ChipLinuxStorage, i.e. a non-empty file that doesn't start with our magic.
+    char magic[sizeof(kMagic)];
+    ssize_t count = pread(mFd.Get(), magic, sizeof(magic), 0);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (count > 0 && (static_cast<size_t>(count) < sizeof(magic) || memcmp(magic, kMagic, sizeof(kMagic)) != 0))
+    {
+        err = MigrateIniLocked();
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = LoadLocked();
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        mFd.Close();
+        return err;
+    }
+    lock.unlock();
+
+    // FlushWork() takes gStoresLock before the lock of the store, so do not hold both here.
+    std::lock_guard<std::mutex> storesLock(gStoresLock);
+    mStoreId          = gNextStoreId++;
+    gStores[mStoreId] = this;
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> storesLock(gStoresLock);
+        gStores.erase(mStoreId);
+        mStoreId = 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mStopCompaction = true;
+    }
+    if (mCompactionThread.joinable())
+    {
+        mCompactionThread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+    mFlushScheduled = false;
+
+    if (mFd.Get() >= 0)
+    {
+        CHIP_ERROR err = FlushLocked();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Failed to flush KVS %s: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+        }
+
+        mFd.Close();
+        mIndex.clear();
+        mPending.clear();
+        mFileSize    = 0;
+        mGarbageSize = 0;
+    }
+
+    mStopCompaction = false;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Get(const char * key, void * value, size_t valueSize, size_t * readBytesSize, size_t offset)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd.Get() >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    const ValueLocation & location = it->second;
+    VerifyOrReturnError(offset <= location.size, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t remaining = location.size - offset;
+    const size_t copySize  = std::min(valueSize, remaining);
+    ReturnErrorOnFailure(ReadLocked(location.offset + offset, value, copySize));
+
+    if (readBytesSize != nullptr)
+    {
+        *readBytesSize = copySize;
+    }
+
+    return (valueSize < remaining) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Put(const char * key, const void * value, size_t valueSize)
+{
+    VerifyOrReturnError(key != nullptr && key[0] != '\0', CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value != nullptr || valueSize == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(valueSize <= kMaxValueLen, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd.Get() >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    ReturnErrorOnFailure(AppendLocked(RecordType::kPut, key, value, valueSize));
+    return CommitLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Delete(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd.Get() >= 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mIndex.find(key) != mIndex.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    ReturnErrorOnFailure(AppendLocked(RecordType::kDelete, key, nullptr, 0));
+    return CommitLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Flush()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return FlushLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        VerifyOrReturnError(mFd.Get() >= 0, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(!mCompacting, CHIP_ERROR_BUSY);
+        mCompacting = true;
+    }
+
+    CHIP_ERROR err = CompactUnlocked();
+
+    std::lock_guard<std::mutex> lock(mLock);
+    mCompacting = false;
+    return err;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CompactUnlocked()
+{
+    std::vector<std::pair<std::string, ValueLocation>> snapshot;
+    size_t snapshotSize;
+    FileDescriptor source;
+
+    // Take a snapshot of the index. The records it points to are never modified, as the file is append-only,
+    // so they can be read through a duplicate of the file descriptor while writes go on.
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        VerifyOrReturnError(mFd.Get() >= 0 && !mStopCompaction, CHIP_ERROR_CANCELLED);
+        ReturnErrorOnFailure(FlushLocked());
+        VerifyOrReturnError(mGarbageSize > 0, CHIP_NO_ERROR);
+
+        source = FileDescriptor(dup(mFd.Get()));
+        VerifyOrReturnError(source.Get() >= 0, CHIP_ERROR_POSIX(errno));
+        snapshot.assign(mIndex.begin(), mIndex.end());
+        snapshotSize = mFileSize;
+    }
+
+    std::vector<uint8_t> contents(kMagic, kMagic + sizeof(kMagic));
+    std::vector<uint8_t> value;
+    Index index;
+    for (const auto & entry : snapshot)
+    {
+        value.resize(entry.second.size);
+        ReturnErrorOnFailure(ReadAll(source.Get(), entry.second.offset, value.data(), value.size()));
+
+        const size_t recordOffset = contents.size();
+        EncodeRecord(contents, RecordType::kPut, entry.first, value.data(), value.size());
+        index[entry.first] =
+            ValueLocation{ recordOffset + kRecordHeaderLen + entry.first.size(), value.size(), contents.size() - recordOffset };
+    }
+
+    std::string tmpPath;
+    FileDescriptor tmp;
+    ReturnErrorOnFailure(WriteTempFile(contents, tmpPath, tmp));
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    // Append the records written since the snapshot, which are few, to the new file, and swap it in.
+    std::vector<uint8_t> tail;
+    size_t tailSize    = 0;
+    size_t garbageSize = 0;
+    CHIP_ERROR err     = (mFd.Get() < 0 || mStopCompaction) ? CHIP_ERROR_CANCELLED : FlushLocked();
+    if (err == CHIP_NO_ERROR)
+    {
+        tail.resize(mFileSize - snapshotSize);
+        err = ReadAll(mFd.Get(), snapshotSize, tail.data(), tail.size());
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        tailSize = ScanRecords(tail.data(), tail.size(), contents.size(), index, garbageSize);
+        err      = WriteAll(tmp.Get(), contents.size(), tail.data(), tailSize);
+    }
+    if (err == CHIP_NO_ERROR && fdatasync(tmp.Get()) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = ReplaceWithTempFileLocked(tmpPath, std::move(tmp));
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(tmpPath.c_str());
+        return err;
+    }
+
+    ChipLogProgress(DeviceLayer, "Compacted KVS %s from %u to %u bytes", mPath.c_str(), static_cast<unsigned>(mFileSize),
+                    static_cast<unsigned>(contents.size() + tailSize));
+    mIndex       = std::move(index);
+    mFileSize    = contents.size() + tailSize;
+    mGarbageSize = garbageSize;
+    return CHIP_NO_ERROR;
+}
+
+size_t ChipLinuxStorageLog::GetLogSize()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mFileSize + mPending.size();
+}
+
+size_t ChipLinuxStorageLog::GetGarbageSize()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mGarbageSize;
+}
+
+void ChipLinuxStorageLog::FlushWork(intptr_t storeId)
+{
+    // Holding gStoresLock keeps the store from being shut down while it is flushed.
+    std::lock_guard<std::mutex> storesLock(gStoresLock);
+    auto it = gStores.find(storeId);
+    VerifyOrReturn(it != gStores.end());
+
+    ChipLinuxStorageLog * self = it->second;
+    std::lock_guard<std::mutex> lock(self->mLock);
+
+    self->mFlushScheduled = false;
+    CHIP_ERROR err        = self->FlushLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to flush KVS %s: %" CHIP_ERROR_FORMAT, self->mPath.c_str(), err.Format());
+    }
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CommitLocked()
+{
+    // Without a running CHIP stack there is no event loop to run the flush, so write through instead. So do writes
+    // beyond the pending limit, so that they do not pile up if the event loop stops running work items.
+    if (mGroupCommit && SystemLayer().IsInitialized() && mPending.size() < CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT_MAX_PENDING)
+    {
+        if (!mFlushScheduled)
+        {
+            mFlushScheduled = (PlatformMgr().ScheduleWork(FlushWork, mStoreId) == CHIP_NO_ERROR);
+        }
+        VerifyOrReturnError(!mFlushScheduled, CHIP_NO_ERROR);
+    }
+
+    return FlushLocked();
+}
+
+void ChipLinuxStorageLog::MaybeScheduleCompactionLocked()
+{
+    VerifyOrReturn(!mCompacting && !mStopCompaction);
+    VerifyOrReturn(mFileSize >= kCompactionMinFileSize && mGarbageSize * 2 >= mFileSize);
+
+    // The previous compaction thread, if any, is done, as mCompacting is clear.
+    if (mCompactionThread.joinable())
+    {
+        mCompactionThread.join();
+    }
+
+    // The thread clears mCompacting when it is done, so that no other compaction starts meanwhile.
+    mCompacting       = true;
+    mCompactionThread = std::thread(&ChipLinuxStorageLog::CompactionThreadMain, this);
+}
+
+void ChipLinuxStorageLog::CompactionThreadMain()
+{
+    CHIP_ERROR err = CompactUnlocked();
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mCompacting = false;
+    }
+
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_CANCELLED)
+    {
+        ChipLogError(DeviceLayer, "Failed to compact KVS %s: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+    }
+}
+
+void ChipLinuxStorageLog::EncodeRecord(std::vector<uint8_t> & out, RecordType type, const std::string & key, const void * value,
+                                       size_t valueSize)
+{
+    const size_t start = out.size();
+    out.resize(start + kRecordHeaderLen + key.size() + valueSize);
+
+    uint8_t * record = out.data() + start;
+    record[4]        = static_cast<uint8_t>(type);
+    record[5]        = 0;
+    Encoding::LittleEndian::Put16(record + 6, static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Put32(record + 8, static_cast<uint32_t>(valueSize));
+    memcpy(record + kRecordHeaderLen, key.data(), key.size());
+    if (valueSize > 0)
+    {
+        memcpy(record + kRecordHeaderLen + key.size(), value, valueSize);
+    }
+
+    const uint32_t crc = kCrc32.Update(0, record + 4, out.size() - start - 4);
+    Encoding::LittleEndian::Put32(record, crc);
+}
+
+size_t ChipLinuxStorageLog::ScanRecords(const uint8_t * data, size_t size, size_t baseOffset, Index & index, size_t & garbageSize)
+{
+    size_t offset = 0;
+    while (size - offset >= kRecordHeaderLen)
+    {
+        const uint8_t * record = data + offset;
+        const auto type        = static_cast<RecordType>(record[4]);
+        const size_t keyLen    = Encoding::LittleEndian::Get16(record + 6);
+        const size_t valueLen  = Encoding::LittleEndian::Get32(record + 8);
+        const size_t recordLen = kRecordHeaderLen + keyLen + valueLen;
+
+        if ((type != RecordType::kPut && type != RecordType::kDelete) || keyLen == 0 || valueLen > kMaxValueLen ||
+            recordLen > size - offset || kCrc32.Update(0, record + 4, recordLen - 4) != Encoding::LittleEndian::Get32(record))
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(record + kRecordHeaderLen), keyLen);
+        auto it = index.find(key);
+        if (it != index.end())
+        {
+            garbageSize += it->second.recordSize;
+        }
+
+        if (type == RecordType::kPut)
+        {
+            index[std::move(key)] = ValueLocation{ baseOffset + offset + kRecordHeaderLen + keyLen, valueLen, recordLen };
+        }
+        else
+        {
+            garbageSize += recordLen;
+            if (it != index.end())
+            {
+                index.erase(it);
+            }
+        }
+
+        offset += recordLen;
+    }
+
+    return offset;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::AppendLocked(RecordType type, const std::string & key, const void * value, size_t valueSize)
+{
+    VerifyOrReturnError(key.size() <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t recordOffset = mFileSize + mPending.size();
+    EncodeRecord(mPending, type, key, value, valueSize);
+    const size_t recordSize = mFileSize + mPending.size() - recordOffset;
+
+    auto it = mIndex.find(key);
+    if (it != mIndex.end())
+    {
+        mGarbageSize += it->second.recordSize;
+    }
+
+    if (type == RecordType::kPut)
+    {
+        mIndex[key] = ValueLocation{ recordOffset + kRecordHeaderLen + key.size(), valueSize, recordSize };
+    }
+    else
+    {
+        // The deletion record itself is garbage as soon as the previous value is gone.
+        mGarbageSize += recordSize;
+        mIndex.erase(it);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReadLocked(size_t offset, void * buf, size_t size)
+{
+    uint8_t * out = static_cast<uint8_t *>(buf);
+
+    if (offset < mFileSize)
+    {
+        const size_t fromFile = std::min(size, mFileSize - offset);
+        ReturnErrorOnFailure(ReadAll(mFd.Get(), offset, out, fromFile));
+        out += fromFile;
+        offset += fromFile;
+        size -= fromFile;
+    }
+
+    if (size > 0)
+    {
+        VerifyOrReturnError(offset - mFileSize + size <= mPending.size(), CHIP_ERROR_INTERNAL);
+        memcpy(out, mPending.data() + (offset - mFileSize), size);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::FlushLocked()
+{
+    VerifyOrReturnError(!mPending.empty(), CHIP_NO_ERROR);
+
+    // A failed or partial write leaves mFileSize unchanged, so the next flush rewrites the same bytes.
+    ReturnErrorOnFailure(WriteAll(mFd.Get(), mFileSize, mPending.data(), mPending.size()));
+    VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+
+    mFileSize += mPending.size();
+    mPending.clear();
+
+    MaybeScheduleCompactionLocked();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReopenLocked()
+{
+    mFd = FileDescriptor(open(mPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    VerifyOrReturnError(mFd.Get() >= 0, CHIP_ERROR_POSIX(errno),
+                        ChipLogError(DeviceLayer, "Failed to open KVS file %s: %s", mPath.c_str(), strerror(errno)));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::LoadLocked()
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(mFd.Get(), &st) == 0, CHIP_ERROR_POSIX(errno));
+
+    mIndex.clear();
+    mPending.clear();
+    mFileSize    = 0;
+    mGarbageSize = 0;
+
+    std::vector<uint8_t> contents(static_cast<size_t>(st.st_size));
+    ReturnErrorOnFailure(ReadAll(mFd.Get(), 0, contents.data(), contents.size()));
+
+    if (contents.size() < sizeof(kMagic))
+    {
+        // New (or torn while being created) store: start it with the magic.
+        ReturnErrorOnFailure(WriteAll(mFd.Get(), 0, reinterpret_cast<const uint8_t *>(kMagic), sizeof(kMagic)));
+        VerifyOrReturnError(ftruncate(mFd.Get(), sizeof(kMagic)) == 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+        mFileSize = sizeof(kMagic);
+        return CHIP_NO_ERROR;
+    }
+
+    const size_t offset = sizeof(kMagic) +
+        ScanRecords(contents.data() + sizeof(kMagic), contents.size() - sizeof(kMagic), sizeof(kMagic), mIndex, mGarbageSize);
+
+    if (offset != contents.size())
+    {
+        // Everything from the first bad record on is the tail of an interrupted write.
+        ChipLogError(DeviceLayer, "KVS %s: discarding %u bytes of incomplete or corrupt records at offset %u", mPath.c_str(),
+                     static_cast<unsigned>(contents.size() - offset), static_cast<unsigned>(offset));
+        VerifyOrReturnError(ftruncate(mFd.Get(), static_cast<off_t>(offset)) == 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+    }
+
+    mFileSize = offset;
+    ChipLogDetail(DeviceLayer, "KVS %s: loaded %u keys, %u of %u bytes garbage", mPath.c_str(),
+                  static_cast<unsigned>(mIndex.size()), static_cast<unsigned>(mGarbageSize), static_cast<unsigned>(mFileSize));
+
+    MaybeScheduleCompactionLocked();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::WriteTempFile(const std::vector<uint8_t> & contents, std::string & tmpPath, FileDescriptor & tmp)
+{
+    tmpPath = mPath + "-XXXXXX";
+    tmp     = FileDescriptor(mkostemp(tmpPath.data(), O_CLOEXEC));
+    VerifyOrReturnError(tmp.Get() >= 0, CHIP_ERROR_POSIX(errno),
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    CHIP_ERROR err = WriteAll(tmp.Get(), 0, contents.data(), contents.size());
+    if (err == CHIP_NO_ERROR && fdatasync(tmp.Get()) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to write KVS snapshot %s: %" CHIP_ERROR_FORMAT, tmpPath.c_str(), err.Format());
+        unlink(tmpPath.c_str());
+    }
+    return err;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReplaceWithTempFileLocked(const std::string & tmpPath, FileDescriptor && tmp)
+{
+    VerifyOrReturnError(rename(tmpPath.c_str(), mPath.c_str()) == 0, CHIP_ERROR_POSIX(errno),
+                        ChipLogError(DeviceLayer, "Failed to replace KVS %s: %s", mPath.c_str(), strerror(errno)));
+    SyncParentDirectory(mPath);
+
+    // The descriptor for the temporary file now refers to the store.
+    mFd = std::move(tmp);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::MigrateIniLocked()
+{
+    ChipLinuxStorageIni ini;
+    std::vector<std::string> keys;
+
+    ReturnErrorOnFailure(ini.Init());
+    ReturnErrorOnFailure(ini.AddConfig(mPath));
+    ReturnErrorOnFailure(ini.GetKeys(keys));
+
+    std::vector<uint8_t> contents(kMagic, kMagic + sizeof(kMagic));
+    for (const auto & key : keys)
+    {
+        size_t size = 0;
+        CHIP_ERROR err = ini.GetBinaryBlobValue(key.c_str(), nullptr, 0, size);
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL, err);
+
+        std::vector<uint8_t> value(size);
+        ReturnErrorOnFailure(ini.GetBinaryBlobValue(key.c_str(), value.data(), value.size(), size));
+        value.resize(size);
+        EncodeRecord(contents, RecordType::kPut, key, value.data(), value.size());
+    }
+
+    std::string tmpPath;
+    FileDescriptor tmp;
+    ReturnErrorOnFailure(WriteTempFile(contents, tmpPath, tmp));
+    CHIP_ERROR err = ReplaceWithTempFileLocked(tmpPath, std::move(tmp));
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(tmpPath.c_str());
+        return err;
+    }
+
+    ChipLogProgress(DeviceLayer, "Converted KVS %s from INI format (%u keys)", mPath.c_str(), static_cast<unsigned>(keys.size()));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,192 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         Provides an append-only, log-structured key-value store backed by a single file.
+ *
+ *         Every Put() or Delete() appends one checksummed record to the end of the file, so the cost
+ *         of a write is proportional to the size of the value rather than to the size of the whole
+ *         store. An in-memory hash index maps each key to the location of its latest value.
+ *
+ *         Put() and Delete() return once the record is written and synced. Callers that can tolerate
+ *         losing the latest writes on a crash may opt in to group commit with SetGroupCommit(), so that
+ *         a burst of writes in one event loop turn costs one write() and one fdatasync().
+ *
+ *         When superseded and deleted records make up most of the file, it is compacted by writing
+ *         the live records to a new file that atomically replaces the old one. Compaction runs on its
+ *         own thread, and only holds the lock of the store to take a snapshot of the index and to
+ *         swap in the new file, so reads and writes carry on meanwhile.
+ *
+ *         On startup, the file is scanned to rebuild the index. A torn or corrupt record at the end
+ *         of the file (e.g. from a crash during a write) ends the scan and is truncated away, so the
+ *         store recovers the state as of the last complete write. A file in the INI format written by
+ *         ChipLinuxStorage is converted on first use.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageLog
+{
+public:
+    ChipLinuxStorageLog() = default;
+    ~ChipLinuxStorageLog();
+
+    ChipLinuxStorageLog(const ChipLinuxStorageLog &)             = delete;
+    ChipLinuxStorageLog & operator=(const ChipLinuxStorageLog &) = delete;
+
+    /**
+     * Open (creating it if needed) the store in @p file and rebuild the index from it.
+     */
+    CHIP_ERROR Init(const char * file);
+
+    /**
+     * Wait for a compaction in progress, write out any buffered writes and close the store.
+     */
+    void Shutdown();
+
+    /**
+     * Read the value of @p key, starting at @p offset, with the semantics of KeyValueStoreManager::Get().
+     */
+    CHIP_ERROR Get(const char * key, void * value, size_t valueSize, size_t * readBytesSize, size_t offset);
+
+    /**
+     * Set the value of @p key, with the semantics of KeyValueStoreManager::Put().
+     */
+    CHIP_ERROR Put(const char * key, const void * value, size_t valueSize);
+
+    /**
+     * Remove @p key, with the semantics of KeyValueStoreManager::Delete().
+     */
+    CHIP_ERROR Delete(const char * key);
+
+    /**
+     * Write out and sync any buffered writes.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * Rewrite the store so that it only contains the current value of each key.
+     *
+     * @retval CHIP_ERROR_BUSY if a compaction is already in progress.
+     */
+    CHIP_ERROR Compact();
+
+    /**
+     * The size of the store file, including buffered writes.
+     */
+    size_t GetLogSize();
+
+    /**
+     * The number of bytes of the store file taken up by superseded or deleted values.
+     */
+    size_t GetGarbageSize();
+
+    /**
+     * Control whether writes are written and synced before Put() and Delete() return (the default),
+     * or group-committed by a work item scheduled on the event loop.
+     *
+     * With group commit, a successful Put() or Delete() is not durable until that work item, Flush()
+     * or Shutdown() has run. Writes are still made synchronously when the CHIP stack is not running,
+     * or when CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT_MAX_PENDING bytes are waiting to be written.
+     */
+    void SetGroupCommit(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mGroupCommit = enabled;
+    }
+
+private:
+    enum class RecordType : uint8_t
+    {
+        kPut    = 1,
+        kDelete = 2,
+    };
+
+    // Location of the latest value of a key. Offsets are into the logical log, i.e. the file followed by mPending.
+    struct ValueLocation
+    {
+        size_t offset;
+        size_t size;
+        size_t recordSize;
+    };
+
+    using Index = std::unordered_map<std::string, ValueLocation>;
+
+    // Work items are given the ID of the store rather than a pointer to it, so that a work item that
+    // runs after the store is shut down does nothing.
+    static void FlushWork(intptr_t storeId);
+
+    CHIP_ERROR LoadLocked();
+    CHIP_ERROR MigrateIniLocked();
+    CHIP_ERROR CommitLocked();
+    CHIP_ERROR FlushLocked();
+    CHIP_ERROR AppendLocked(RecordType type, const std::string & key, const void * value, size_t valueSize);
+    CHIP_ERROR ReadLocked(size_t offset, void * buf, size_t size);
+    CHIP_ERROR WriteTempFile(const std::vector<uint8_t> & contents, std::string & tmpPath, FileDescriptor & tmp);
+    CHIP_ERROR ReplaceWithTempFileLocked(const std::string & tmpPath, FileDescriptor && tmp);
+    CHIP_ERROR ReopenLocked();
+    void MaybeScheduleCompactionLocked();
+    void CompactionThreadMain();
+    // Compaction, for a caller that set mCompacting.
+    CHIP_ERROR CompactUnlocked();
+
+    static void EncodeRecord(std::vector<uint8_t> & out, RecordType type, const std::string & key, const void * value,
+                             size_t valueSize);
+    // Add the valid records at the start of @p data, which are at @p baseOffset in the file, to @p index.
+    // Returns the size of these records: any bytes after them are an incomplete or corrupt record.
+    static size_t ScanRecords(const uint8_t * data, size_t size, size_t baseOffset, Index & index, size_t & garbageSize);
+
+    std::mutex mLock;
+    std::string mPath;
+    FileDescriptor mFd;
+    Index mIndex;
+
+    // Records appended since the last flush, and the size of the file they will be written at.
+    std::vector<uint8_t> mPending;
+    size_t mFileSize    = 0;
+    size_t mGarbageSize = 0;
+
+    bool mGroupCommit    = false;
+    bool mFlushScheduled = false;
+    intptr_t mStoreId    = 0;
+
+    // mCompacting is set while a compaction runs, on mCompactionThread or in Compact(). mStopCompaction
+    // makes a compaction in progress give up, and prevents new ones, while the store shuts down.
+    std::thread mCompactionThread;
+    bool mCompacting = false;
+    std::atomic<bool> mStopCompaction{ false };
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -72,6 +72,29 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+// Pools are heap-allocated on Linux, so the reporting dirty set can grow well past
+// CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, e.g. on bridges with many endpoints.
+
+#ifndef CHIP_IM_SERVER_DIRTY_SET_INDEX_SIZE
+#define CHIP_IM_SERVER_DIRTY_SET_INDEX_SIZE 64
+#endif // CHIP_IM_SERVER_DIRTY_SET_INDEX_SIZE
+
+#ifndef CHIP_CONFIG_IM_REPORT_CACHE_SIZE
+#define CHIP_CONFIG_IM_REPORT_CACHE_SIZE 2048
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_SIZE
+
+#ifndef CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES
+#define CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES 8192
+#endif // CHIP_CONFIG_IM_METADATA_SNAPSHOT_MAX_ENTRIES
+
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 16
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS 32
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS
+
 // Increase C++ lambda event size to accommodate larger local captures
 // for connman-based Connectivity Manager network management
 // implementation, particularly on [I]LP64 architectures in which
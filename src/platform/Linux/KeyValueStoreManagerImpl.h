@@ -23,7 +23,12 @@
 
 #pragma once
 
+#include <platform/CHIPDeviceConfig.h>
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+#else
 #include <platform/Linux/CHIPLinuxStorage.h>
+#endif
 
 namespace chip {
 namespace DeviceLayer {
@@ -36,14 +41,31 @@ public:
      * @brief
      * Initalize the KVS, must be called before using.
      */
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+    CHIP_ERROR Init(const char * file)
+    {
+        mStorage.SetGroupCommit(CHIP_DEVICE_CONFIG_LINUX_KVS_GROUP_COMMIT);
+        return mStorage.Init(file);
+    }
+
+    /**
+     * Write out the writes that are waiting to be group-committed.
+     */
+    CHIP_ERROR Flush() { return mStorage.Flush(); }
+#else
     CHIP_ERROR Init(const char * file) { return mStorage.Init(file); }
+#endif
 
     CHIP_ERROR _Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
 private:
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+    DeviceLayer::Internal::ChipLinuxStorageLog mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
@@ -42,6 +42,7 @@
 #include <platform/DeviceInstanceInfoProvider.h>
 #include <platform/Linux/DeviceInstanceInfoProviderImpl.h>
 #include <platform/Linux/DiagnosticDataProviderImpl.h>
+#include <platform/Linux/KeyValueStoreManagerImpl.h>
 #include <platform/PlatformManager.h>
 #include <platform/internal/GenericPlatformManagerImpl_POSIX.ipp>
 
@@ -282,6 +283,11 @@ void PlatformManagerImpl::_Shutdown()
 
     Internal::GenericPlatformManagerImpl_POSIX<PlatformManagerImpl>::_Shutdown();
 
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+    // Write out the group-committed KVS writes that the event loop did not get to.
+    LogErrorOnFailure(PersistedStorage::KeyValueStoreMgrImpl().Flush());
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+
 #if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
     if (mGLibMainLoop != nullptr)
     {
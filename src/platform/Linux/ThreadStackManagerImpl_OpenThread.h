@@ -19,7 +19,7 @@
 
 #include <platform/OpenThread/GenericThreadStackManagerImpl_OpenThread.h>
 #include <platform/ThreadStackManager.h>
-#include <system/SystemLayerImplSelect.h>
+#include <system/SystemLayerImpl.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -28,7 +28,7 @@ namespace DeviceLayer {
  * Concrete implementation of the ThreadStackManager singleton object for Linux platform using OpenThread Endpoint.
  */
 class ThreadStackManagerImpl final : public ThreadStackManager,
-                                     public System::LayerImplSelect::EventSource,
+                                     public System::LayerImpl::EventSource,
                                      public Internal::GenericThreadStackManagerImpl_OpenThread<ThreadStackManagerImpl>
 {
     friend ThreadStackManager;
@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the lock-free device event queue used by
+ *      the POSIX platform manager, including overflow and wakeup coalescing with concurrent producers.
+ *
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <platform/DeviceEventQueue.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+ChipDeviceEvent MakeEvent(intptr_t arg)
+{
+    ChipDeviceEvent event{ .Type = DeviceEventType::kCallWorkFunct };
+    event.CallWorkFunct = { .WorkFunct = nullptr, .Arg = arg };
+    return event;
+}
+
+TEST(TestDeviceEventQueue, FifoAndWakeCoalescing)
+{
+    auto queue = std::make_unique<DeviceEventQueue>();
+    bool needsWake;
+
+    EXPECT_TRUE(queue->Empty());
+
+    queue->Push(MakeEvent(1), needsWake);
+    EXPECT_TRUE(needsWake);
+    queue->Push(MakeEvent(2), needsWake);
+    EXPECT_FALSE(needsWake);
+    queue->Push(MakeEvent(3), needsWake);
+    EXPECT_FALSE(needsWake);
+    EXPECT_FALSE(queue->Empty());
+
+    DeviceEventQueue::Stats stats = queue->GetStats();
+    EXPECT_EQ(stats.depth, 3u);
+    EXPECT_EQ(stats.maxDepth, 3u);
+    EXPECT_EQ(stats.pushed, 3u);
+    EXPECT_EQ(stats.wakeups, 1u);
+    EXPECT_EQ(stats.overflowed, 0u);
+
+    std::vector<intptr_t> seen;
+    queue->Drain([&](const ChipDeviceEvent & event) {
+        seen.push_back(event.CallWorkFunct.Arg);
+        // Events pushed while draining are processed by the same drain.
+        if (event.CallWorkFunct.Arg == 2)
+        {
+            bool wake;
+            queue->Push(MakeEvent(4), wake);
+        }
+    });
+    EXPECT_EQ(seen, (std::vector<intptr_t>{ 1, 2, 3, 4 }));
+    EXPECT_TRUE(queue->Empty());
+    EXPECT_EQ(queue->GetStats().depth, 0u);
+
+    // Once drained, the next push needs a new wakeup.
+    queue->Push(MakeEvent(5), needsWake);
+    EXPECT_TRUE(needsWake);
+}
+
+TEST(TestDeviceEventQueue, Overflow)
+{
+    auto queue = std::make_unique<DeviceEventQueue>();
+    bool needsWake;
+
+    // Fill the ring, then spill over into the overflow list.
+    constexpr size_t kEvents = DeviceEventQueue::kCapacity + 3;
+    for (size_t i = 0; i < kEvents; i++)
+    {
+        queue->Push(MakeEvent(static_cast<intptr_t>(i)), needsWake);
+    }
+    DeviceEventQueue::Stats stats = queue->GetStats();
+    EXPECT_EQ(stats.overflowed, 3u);
+    EXPECT_EQ(stats.pushed, kEvents);
+    EXPECT_EQ(stats.depth, kEvents);
+    EXPECT_EQ(stats.maxDepth, kEvents);
+
+    // Events are drained in order. Events pushed meanwhile follow those in the overflow list, even once the ring has
+    // room again.
+    intptr_t expected = 0;
+    queue->Drain([&](const ChipDeviceEvent & event) {
+        EXPECT_EQ(event.CallWorkFunct.Arg, expected++);
+        if (event.CallWorkFunct.Arg == static_cast<intptr_t>(DeviceEventQueue::kCapacity))
+        {
+            bool wake;
+            queue->Push(MakeEvent(static_cast<intptr_t>(kEvents)), wake);
+        }
+    });
+    EXPECT_EQ(expected, static_cast<intptr_t>(kEvents + 1));
+    EXPECT_TRUE(queue->Empty());
+    EXPECT_EQ(queue->GetStats().overflowed, 4u);
+    EXPECT_EQ(queue->GetStats().depth, 0u);
+
+    // Once the overflow list is drained, events go through the ring again.
+    queue->Push(MakeEvent(42), needsWake);
+    EXPECT_TRUE(needsWake);
+    EXPECT_EQ(queue->GetStats().overflowed, 4u);
+    queue->Drain([&](const ChipDeviceEvent & event) { EXPECT_EQ(event.CallWorkFunct.Arg, 42); });
+}
+
+// Several producers push concurrently and only signal the consumer when Push() asks for a wakeup.
+// The consumer only drains when signalled, so a lost wakeup would leave events behind and time out.
+TEST(TestDeviceEventQueue, ConcurrentProducers)
+{
+    constexpr int kProducers         = 4;
+    constexpr int kEventsPerProducer = 20000;
+
+    auto queue = std::make_unique<DeviceEventQueue>();
+    std::mutex lock;
+    std::condition_variable signalled;
+    uint64_t signals = 0;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; p++)
+    {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < kEventsPerProducer; i++)
+            {
+                bool needsWake;
+                queue->Push(MakeEvent(p * kEventsPerProducer + i), needsWake);
+                if (needsWake)
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    signals++;
+                    signalled.notify_one();
+                }
+            }
+        });
+    }
+
+    std::vector<int> nextExpected(kProducers, 0);
+    int received      = 0;
+    uint64_t consumed = 0;
+    bool inOrder      = true;
+    bool lostWakeup   = false;
+    while (received < kProducers * kEventsPerProducer)
+    {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            if (!signalled.wait_for(guard, std::chrono::seconds(10), [&] { return signals != consumed; }))
+            {
+                // Keep draining so the producers can finish, but fail the test.
+                lostWakeup = true;
+            }
+            consumed = signals;
+        }
+
+        queue->Drain([&](const ChipDeviceEvent & event) {
+            const int producer = static_cast<int>(event.CallWorkFunct.Arg / kEventsPerProducer);
+            const int index    = static_cast<int>(event.CallWorkFunct.Arg % kEventsPerProducer);
+            inOrder            = inOrder && (index == nextExpected[producer]);
+            nextExpected[producer] = index + 1;
+            received++;
+        });
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_FALSE(lostWakeup);
+    EXPECT_EQ(received, kProducers * kEventsPerProducer);
+    EXPECT_TRUE(inOrder);
+
+    DeviceEventQueue::Stats stats = queue->GetStats();
+    EXPECT_EQ(stats.pushed, static_cast<uint64_t>(kProducers * kEventsPerProducer));
+    EXPECT_EQ(stats.depth, 0u);
+    EXPECT_LE(stats.wakeups, stats.pushed);
+    EXPECT_EQ(stats.wakeups, signals);
+}
+
+} // namespace
@@ -0,0 +1,350 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the log-structured Linux key-value store,
+ *      including recovery from torn writes, group commit, compaction and conversion of INI stores.
+ *
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+class TestLinuxStorageLog : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/chip-kvs-log-XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        mDir  = dirTemplate;
+        mPath = mDir + "/kvs";
+    }
+
+    void TearDown() override
+    {
+        unlink(mPath.c_str());
+        rmdir(mDir.c_str());
+    }
+
+    size_t FileSize()
+    {
+        struct stat st;
+        EXPECT_EQ(stat(mPath.c_str(), &st), 0);
+        return static_cast<size_t>(st.st_size);
+    }
+
+    std::string mDir;
+    std::string mPath;
+};
+
+void ExpectValue(ChipLinuxStorageLog & storage, const char * key, const char * expected)
+{
+    char buf[64];
+    size_t readSize = 0;
+    ASSERT_EQ(storage.Get(key, buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, strlen(expected));
+    EXPECT_EQ(memcmp(buf, expected, readSize), 0);
+}
+
+void ExpectMissing(ChipLinuxStorageLog & storage, const char * key)
+{
+    char buf[8];
+    EXPECT_EQ(storage.Get(key, buf, sizeof(buf), nullptr, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+TEST_F(TestLinuxStorageLog, PutGetDeletePersist)
+{
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+        EXPECT_EQ(storage.Put("a", "first", 5), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("b", "second", 6), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("a", "third", 5), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("empty", nullptr, 0), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Delete("b"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Delete("b"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+        ExpectValue(storage, "a", "third");
+        ExpectValue(storage, "empty", "");
+        ExpectMissing(storage, "b");
+
+        // Partial and offset reads.
+        char buf[2];
+        size_t readSize = 0;
+        EXPECT_EQ(storage.Get("a", buf, sizeof(buf), &readSize, 1), CHIP_ERROR_BUFFER_TOO_SMALL);
+        EXPECT_EQ(readSize, 2u);
+        EXPECT_EQ(memcmp(buf, "hi", 2), 0);
+        EXPECT_EQ(storage.Get("a", buf, sizeof(buf), &readSize, 6), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "a", "third");
+    ExpectValue(storage, "empty", "");
+    ExpectMissing(storage, "b");
+}
+
+TEST_F(TestLinuxStorageLog, RecoversFromTornTail)
+{
+    size_t goodSize;
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("kept", "value", 5), CHIP_NO_ERROR);
+        goodSize = FileSize();
+        EXPECT_EQ(storage.Put("torn", "0123456789", 10), CHIP_NO_ERROR);
+    }
+
+    // Simulate a crash in the middle of writing the last record.
+    ASSERT_EQ(truncate(mPath.c_str(), static_cast<off_t>(FileSize() - 4)), 0);
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        ExpectValue(storage, "kept", "value");
+        ExpectMissing(storage, "torn");
+        EXPECT_EQ(FileSize(), goodSize);
+
+        // New writes go after the last good record.
+        EXPECT_EQ(storage.Put("after", "ok", 2), CHIP_NO_ERROR);
+    }
+
+    // Corrupt a byte of the value of the last record, as if it was only partially persisted.
+    {
+        int fd = open(mPath.c_str(), O_RDWR);
+        ASSERT_GE(fd, 0);
+        const uint8_t garbage = 0xA5;
+        EXPECT_EQ(pwrite(fd, &garbage, 1, static_cast<off_t>(FileSize() - 1)), 1);
+        close(fd);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "kept", "value");
+    ExpectMissing(storage, "after");
+}
+
+TEST_F(TestLinuxStorageLog, Compaction)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    char value[32];
+    for (int i = 0; i < 100; i++)
+    {
+        snprintf(value, sizeof(value), "counter-%d", i);
+        EXPECT_EQ(storage.Put("counter", value, strlen(value)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(storage.Put("other", "x", 1), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Put("deleted", "y", 1), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Delete("deleted"), CHIP_NO_ERROR);
+
+    const size_t sizeBefore = storage.GetLogSize();
+    EXPECT_GT(storage.GetGarbageSize(), 0u);
+
+    EXPECT_EQ(storage.Compact(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetGarbageSize(), 0u);
+    EXPECT_LT(storage.GetLogSize(), sizeBefore / 10);
+    EXPECT_EQ(FileSize(), storage.GetLogSize());
+
+    ExpectValue(storage, "counter", "counter-99");
+    ExpectValue(storage, "other", "x");
+    ExpectMissing(storage, "deleted");
+
+    // The store keeps working after compaction, and the compacted file is what is loaded on restart.
+    EXPECT_EQ(storage.Put("other", "z", 1), CHIP_NO_ERROR);
+    storage.Shutdown();
+
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "counter", "counter-99");
+    ExpectValue(storage, "other", "z");
+}
+
+void StopTheLoop(intptr_t)
+{
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+}
+
+// Run the work items scheduled so far.
+void RunScheduledWork()
+{
+    EXPECT_EQ(PlatformMgr().ScheduleWork(StopTheLoop), CHIP_NO_ERROR);
+    PlatformMgr().RunEventLoop();
+}
+
+TEST_F(TestLinuxStorageLog, GroupCommit)
+{
+    ASSERT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        storage.SetGroupCommit(true);
+
+        // Writes are buffered until the work item scheduled by the first one runs, but can be read meanwhile.
+        const size_t initialSize = FileSize();
+        EXPECT_EQ(storage.Put("a", "1", 1), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("b", "2", 1), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Delete("a"), CHIP_NO_ERROR);
+        EXPECT_EQ(FileSize(), initialSize);
+        EXPECT_GT(storage.GetLogSize(), initialSize);
+        ExpectMissing(storage, "a");
+        ExpectValue(storage, "b", "2");
+
+        RunScheduledWork();
+        EXPECT_EQ(FileSize(), storage.GetLogSize());
+
+        // Flush() writes buffered writes out right away.
+        EXPECT_EQ(storage.Put("c", "3", 1), CHIP_NO_ERROR);
+        EXPECT_LT(FileSize(), storage.GetLogSize());
+        EXPECT_EQ(storage.Flush(), CHIP_NO_ERROR);
+        EXPECT_EQ(FileSize(), storage.GetLogSize());
+
+        // So does Shutdown(), which leaves the scheduled work item with nothing to do.
+        EXPECT_EQ(storage.Put("d", "4", 1), CHIP_NO_ERROR);
+        EXPECT_LT(FileSize(), storage.GetLogSize());
+    }
+
+    // The work item scheduled by the store, which no longer exists, does nothing.
+    RunScheduledWork();
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        ExpectMissing(storage, "a");
+        ExpectValue(storage, "b", "2");
+        ExpectValue(storage, "c", "3");
+        ExpectValue(storage, "d", "4");
+
+        // Without group commit, which is the default, writes are synced before they return.
+        EXPECT_EQ(storage.Put("e", "5", 1), CHIP_NO_ERROR);
+        EXPECT_EQ(FileSize(), storage.GetLogSize());
+    }
+
+    PlatformMgr().Shutdown();
+}
+
+TEST_F(TestLinuxStorageLog, GroupCommitWithoutEventLoop)
+{
+    // Without a running CHIP stack, writes are synced before they return even with group commit.
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    storage.SetGroupCommit(true);
+
+    EXPECT_EQ(storage.Put("a", "1", 1), CHIP_NO_ERROR);
+    EXPECT_EQ(FileSize(), storage.GetLogSize());
+}
+
+TEST_F(TestLinuxStorageLog, BackgroundCompaction)
+{
+    // Compaction starts once the file is at least 64 KiB and at least half of it is garbage.
+    constexpr size_t kValueSize = 1024;
+    constexpr int kWrites       = 100;
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+        // Keep writing while the compaction runs; the writes made meanwhile must be carried over to the new file.
+        char value[kValueSize];
+        char key[16];
+        for (int i = 0; i < kWrites; i++)
+        {
+            memset(value, 'a' + i % 26, sizeof(value));
+            EXPECT_EQ(storage.Put("big", value, sizeof(value)), CHIP_NO_ERROR);
+            snprintf(key, sizeof(key), "key-%d", i);
+            EXPECT_EQ(storage.Put(key, key, strlen(key)), CHIP_NO_ERROR);
+        }
+
+        for (int i = 0; i < 500 && storage.GetLogSize() >= 64 * 1024; i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        EXPECT_LT(storage.GetLogSize(), 64u * 1024);
+        EXPECT_LT(storage.GetGarbageSize(), storage.GetLogSize());
+        EXPECT_EQ(FileSize(), storage.GetLogSize());
+
+        // Reads see the latest values, from the new file.
+        size_t readSize = 0;
+        EXPECT_EQ(storage.Get("big", value, sizeof(value), &readSize, 0), CHIP_NO_ERROR);
+        EXPECT_EQ(readSize, sizeof(value));
+        EXPECT_EQ(value[0], 'a' + (kWrites - 1) % 26);
+        EXPECT_EQ(value[kValueSize - 1], 'a' + (kWrites - 1) % 26);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    char key[16];
+    for (int i = 0; i < kWrites; i++)
+    {
+        snprintf(key, sizeof(key), "key-%d", i);
+        ExpectValue(storage, key, key);
+    }
+}
+
+TEST_F(TestLinuxStorageLog, ConvertsIniStore)
+{
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("g/fidx", reinterpret_cast<const uint8_t *>("\x01\x02\x03"), 3), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("key with=weird\nchars", reinterpret_cast<const uint8_t *>("abcd"), 4), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "g/fidx", "\x01\x02\x03");
+    ExpectValue(storage, "key with=weird\nchars", "abcd");
+
+    EXPECT_EQ(storage.Put("new", "1", 1), CHIP_NO_ERROR);
+    storage.Shutdown();
+
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "g/fidx", "\x01\x02\x03");
+    ExpectValue(storage, "new", "1");
+}
+
+} // namespace
@@ -377,6 +377,11 @@ void CASESession::Clear()
 {
     MATTER_TRACE_SCOPE("Clear", "CASESession");
     // Cancel any outstanding work.
+    if (mSendSigma2Helper)
+    {
+        mSendSigma2Helper->CancelWork();
+        mSendSigma2Helper.reset();
+    }
     if (mSendSigma3Helper)
     {
         mSendSigma3Helper->CancelWork();
@@ -892,6 +897,8 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
 
     CHIP_ERROR err = CHIP_NO_ERROR;
 
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma1Processing);
+
     // Parse and Validate Received Sigma1, and decide next step
     NextStep nextStep = HandleSigma1(std::move(msg));
     VerifyOrExit(nextStep.Is<Step>(), err = nextStep.Get<CHIP_ERROR>());
@@ -899,17 +906,8 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
     switch (nextStep.Get<Step>())
     {
     case Step::kSendSigma2: {
-
-        System::PacketBufferHandle msgR2;
-        EncodeSigma2Inputs encodeSigma2;
-
-        SuccessOrExit(err = PrepareSigma2(encodeSigma2));
-        SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
-
-        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
-        SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
-
-        mDelegate->OnSessionEstablishmentStarted();
+        // Sigma2 is sent by SendSigma2c, once the asymmetric crypto is done, possibly in the background.
+        SuccessOrExit(err = SendSigma2a());
         break;
     }
     case Step::kSendSigma2Resume: {
@@ -932,6 +930,11 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
     }
 
 exit:
+    if (mState != State::kSendSigma2Pending)
+    {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1Processing, err);
+    }
+
     if (err == CHIP_ERROR_KEY_NOT_FOUND)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeNoSharedRoot);
@@ -1166,40 +1169,154 @@ CHIP_ERROR CASESession::SendSigma2Resume(System::PacketBufferHandle && msgR2Resu
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
+CHIP_ERROR CASESession::SendSigma2a()
 {
+    MATTER_TRACE_SCOPE("SendSigma2", "CASESession");
 
-    MATTER_TRACE_SCOPE("PrepareSigma2", "CASESession");
+    auto helper = WorkHelper<SendSigma2Data>::Create(*this, &SendSigma2b, &CASESession::SendSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    {
+        auto & data = helper->mData;
 
-    VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    outSigma2Data.responderSessionId = GetLocalSessionId().Value();
+        VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        data.fabricIndex = mFabricIndex;
+        data.fabricTable = nullptr;
+        data.keystore    = nullptr;
+
+        {
+            const FabricInfo * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
+            VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+            auto * keystore = mFabricsTable->GetOperationalKeystore();
+            if (!fabricInfo->HasOperationalKey() && keystore != nullptr && keystore->SupportsSignWithOpKeypairInBackground())
+            {
+                // NOTE: used to sign in background.
+                data.keystore = keystore;
+            }
+            else
+            {
+                // NOTE: used to sign in foreground.
+                data.fabricTable = mFabricsTable;
+            }
+        }
+
+        VerifyOrReturnError(data.icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.icaCert = MutableByteSpan{ data.icacBuf.Get(), kMaxCHIPCertLength };
+
+        VerifyOrReturnError(data.nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.nocCert = MutableByteSpan{ data.nocBuf.Get(), kMaxCHIPCertLength };
+
+        ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, data.icaCert));
+        ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, data.nocCert));
+
+        // Generate an ephemeral keypair, and the shared secret. This stays on the event loop: unlike the operational
+        // keystore, the crypto backend (and its DRBG) makes no promise of being usable from another thread.
+        mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
+        VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
+        ReturnErrorOnFailure(mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
+
+        // Construct Sigma2 TBS Data
+        size_t msgR2SignedLen = EstimateStructOverhead(data.nocCert.size(),    // responderNoc
+                                                       data.icaCert.size(),    // responderICAC
+                                                       kP256_PublicKey_Length, // responderEphPubKey
+                                                       kP256_PublicKey_Length  // InitiatorEphPubKey
+        );
+
+        VerifyOrReturnError(data.msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+        data.msgR2SignedSpan = MutableByteSpan{ data.msgR2Signed.Get(), msgR2SignedLen };
+
+        ReturnErrorOnFailure(ConstructTBSData(data.nocCert, data.icaCert,
+                                              ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
+                                              ByteSpan(mRemotePubKey, mRemotePubKey.Length()), data.msgR2SignedSpan));
+
+        if (data.keystore != nullptr && helper->ScheduleWork() == CHIP_NO_ERROR)
+        {
+            mSendSigma2Helper = helper;
+            mExchangeCtxt.Value()->WillSendMessage();
+            mState = State::kSendSigma2Pending;
+        }
+        else
+        {
+            // Signing in the foreground, or no room for the work in the background: do it now rather than failing
+            // the handshake.
+            ReturnErrorOnFailure(helper->DoWork());
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2b(SendSigma2Data & data, bool & cancel)
+{
+    // Generate a Signature
+    if (data.keystore != nullptr)
+    {
+        // Recommended case: delegate to operational keystore
+        ReturnErrorOnFailure(data.keystore->SignWithOpKeypair(data.fabricIndex, data.msgR2SignedSpan, data.tbsData2Signature));
+    }
+    else
+    {
+        // Legacy case: delegate to fabric table fabric info
+        ReturnErrorOnFailure(data.fabricTable->SignWithOpKeypair(data.fabricIndex, data.msgR2SignedSpan, data.tbsData2Signature));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2c(SendSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    // SendSigma2a sets this state when the work is scheduled, rather than done immediately.
+    bool workScheduled = mState == State::kSendSigma2Pending;
+
+    System::PacketBufferHandle msgR2;
+    EncodeSigma2Inputs encodeSigma2;
+
+    SuccessOrExit(err = status);
+
+    SuccessOrExit(err = PrepareSigma2(data, encodeSigma2));
+    SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
+
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
+    SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
+
+    mDelegate->OnSessionEstablishmentStarted();
+
+exit:
+    mSendSigma2Helper.reset();
+
+    // If the work was scheduled, HandleSigma1_and_SendSigma2 and OnMessageReceived already returned, so the metric
+    // must be ended, the status report sent, the exchange discarded and the pending establish aborted here.
+    if (workScheduled)
+    {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1Processing, err);
+        if (err != CHIP_NO_ERROR)
+        {
+            SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+            DiscardExchange();
+            AbortPendingEstablish(err);
+        }
+    }
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> icacBuf;
-    VerifyOrReturnError(icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+    return err;
+}
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> nocBuf;
-    VerifyOrReturnError(nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+CHIP_ERROR CASESession::PrepareSigma2(SendSigma2Data & data, EncodeSigma2Inputs & outSigma2Data)
+{
 
-    MutableByteSpan icaCert{ icacBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, icaCert));
+    MATTER_TRACE_SCOPE("PrepareSigma2", "CASESession");
 
-    MutableByteSpan nocCert{ nocBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, nocCert));
+    VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_INTERNAL);
+    outSigma2Data.responderSessionId = GetLocalSessionId().Value();
 
     // Fill in the random value
     ReturnErrorOnFailure(DRBG_get_bytes(&outSigma2Data.responderRandom[0], sizeof(outSigma2Data.responderRandom)));
 
-    // Generate an ephemeral keypair
-    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
-    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
     outSigma2Data.responderEphPubKey = &mEphemeralKey->Pubkey();
 
-    // Generate a Shared Secret
-    ReturnErrorOnFailure(mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
-
     SensitiveDataFixedBuffer<kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length> msgSalt;
 
     MutableByteSpan saltSpan(msgSalt.Bytes(), msgSalt.Capacity());
@@ -1209,29 +1326,10 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
     AutoReleaseSessionKey sr2k(*mSessionManager->GetSessionKeystore());
     ReturnErrorOnFailure(DeriveSigmaKey(saltSpan, ByteSpan(kKDFSR2Info), sr2k));
 
-    // Construct Sigma2 TBS Data
-    P256ECDSASignature tbsData2Signature;
-    {
-        size_t msgR2SignedLen = EstimateStructOverhead(kMaxCHIPCertLength,     // responderNoc
-                                                       kMaxCHIPCertLength,     // responderICAC
-                                                       kP256_PublicKey_Length, // responderEphPubKey
-                                                       kP256_PublicKey_Length  // InitiatorEphPubKey
-        );
-
-        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-        VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-        MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
-
-        ReturnErrorOnFailure(ConstructTBSData(nocCert, icaCert, ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
-                                              ByteSpan(mRemotePubKey, mRemotePubKey.Length()), msgR2SignedSpan));
-
-        // Generate a Signature
-        ReturnErrorOnFailure(mFabricsTable->SignWithOpKeypair(mFabricIndex, msgR2SignedSpan, tbsData2Signature));
-    }
     // Construct Sigma2 TBE Data
-    size_t msgR2SignedEncLen = EstimateStructOverhead(nocCert.size(),                             // responderNoc
-                                                      icaCert.size(),                             // responderICAC
-                                                      tbsData2Signature.Length(),                 // signature
+    size_t msgR2SignedEncLen = EstimateStructOverhead(data.nocCert.size(),                        // responderNoc
+                                                      data.icaCert.size(),                        // responderICAC
+                                                      data.tbsData2Signature.Length(),            // signature
                                                       SessionResumptionStorage::kResumptionIdSize // resumptionID
     );
 
@@ -1245,28 +1343,28 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
 
     ReturnErrorOnFailure(tlvWriter.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType));
 
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2NOC, *nocCert.data() ^= 0xFF);
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2ICAC, *icaCert.data() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2NOC, *data.nocCert.data() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2ICAC, *data.icaCert.data() ^= 0xFF);
 
-    ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderNOC), nocCert));
-    if (!icaCert.empty())
+    ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderNOC), data.nocCert));
+    if (!data.icaCert.empty())
     {
-        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), icaCert));
+        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), data.icaCert));
     }
 
     // We are now done with ICAC and NOC certs so we can release the memory.
     {
-        icacBuf.Free();
-        icaCert = MutableByteSpan{};
+        data.icacBuf.Free();
+        data.icaCert = MutableByteSpan{};
 
-        nocBuf.Free();
-        nocCert = MutableByteSpan{};
+        data.nocBuf.Free();
+        data.nocCert = MutableByteSpan{};
     }
 
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2Signature, *tbsData2Signature.Bytes() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2Signature, *data.tbsData2Signature.Bytes() ^= 0xFF);
 
-    ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), tbsData2Signature.ConstBytes(),
-                                            static_cast<uint32_t>(tbsData2Signature.Length())));
+    ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), data.tbsData2Signature.ConstBytes(),
+                                            static_cast<uint32_t>(data.tbsData2Signature.Length())));
 
     // Generate a new resumption ID
     ReturnErrorOnFailure(DRBG_get_bytes(mNewResumptionId.data(), mNewResumptionId.size()));
@@ -1447,6 +1545,7 @@ CHIP_ERROR CASESession::ParseSigma2Resume(ContiguousBufferTLVReader & tlvReader,
 CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2_and_SendSigma3", "CASESession");
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2Processing);
     CHIP_ERROR err = HandleSigma2(std::move(msg));
     MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
     SuccessOrExit(err);
@@ -1459,6 +1558,11 @@ CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle &
     }
 
 exit:
+    if (mState != State::kSendSigma3Pending)
+    {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2Processing, err);
+    }
+
     if (CHIP_NO_ERROR != err)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
@@ -1893,6 +1997,11 @@ CHIP_ERROR CASESession::SendSigma3c(SendSigma3Data & data, CHIP_ERROR status)
 exit:
     mSendSigma3Helper.reset();
 
+    if (data.keystore != nullptr)
+    {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2Processing, err);
+    }
+
     // If data.keystore is set, processing occurred in the background, so if an error occurred,
     // need to send status report (normally occurs in SendSigma3a), and discard exchange and
     // abort pending establish (normally occurs in OnMessageReceived).
@@ -1923,6 +2032,7 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
     ChipLogProgress(SecureChannel, "Received Sigma3 msg");
     MATTER_TRACE_COUNTER("Sigma3");
     MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err);
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3Processing);
 
     auto helper = WorkHelper<HandleSigma3Data>::Create(*this, &HandleSigma3b, &CASESession::HandleSigma3c);
     VerifyOrExit(helper, err = CHIP_ERROR_NO_MEMORY);
@@ -1990,7 +2100,8 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
 
         // Copy remaining needed data into work structure
         {
-            data.validContext = mValidContext;
+            data.validContext                     = mValidContext;
+            data.validContext.mValidatedCertCache = mFabricsTable->GetValidatedCertificateCache();
 
             // initiatorNOC and initiatorICAC are spans into msgR3Encrypted
             // which is going away, so to save memory, redirect them to their
@@ -2021,6 +2132,7 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
 exit:
     if (err != CHIP_NO_ERROR)
     {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3Processing, err);
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
     }
 
@@ -2151,6 +2263,7 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
 
 exit:
     mHandleSigma3Helper.reset();
+    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3Processing, err);
 
     if (err != CHIP_NO_ERROR)
     {
@@ -2657,6 +2770,13 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
 
+    if (mSendSigma2Helper && mSendSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "SendSigma2Helper was unable to schedule the AfterWorkCallback");
+        mSendSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     if (mSendSigma3Helper && mSendSigma3Helper->UnableToScheduleAfterWorkCallback())
     {
         ChipLogError(SecureChannel, "SendSigma3Helper was unable to schedule the AfterWorkCallback");
@@ -2684,6 +2804,8 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma1:
     case State::kSentSigma1Resume:
         return SessionEstablishmentStage::kSentSigma1;
+    case State::kSendSigma2Pending:
+        return SessionEstablishmentStage::kReceivedSigma1;
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
@@ -18,14 +18,47 @@
 #include <protocols/secure_channel/DefaultSessionResumptionStorage.h>
 
 #include <lib/support/Base64.h>
+#include <lib/support/FibonacciHash.h>
 #include <lib/support/SafeInt.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+#include <string.h>
 
 namespace chip {
 
+namespace {
+
+constexpr System::Clock::Milliseconds32 kIndexWriteDelay(CHIP_CONFIG_CASE_SESSION_RESUME_INDEX_WRITE_DELAY_MS);
+
+} // namespace
+
+DefaultSessionResumptionStorage::~DefaultSessionResumptionStorage()
+{
+    // The index cannot be written here, as the storage of the derived class is gone.  Flush() must be called before.
+    if (DeviceLayer::SystemLayer().IsInitialized())
+    {
+        DeviceLayer::SystemLayer().CancelTimer(FlushTimerHandler, this);
+    }
+}
+
 CHIP_ERROR DefaultSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
-    ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
+    ReturnErrorOnFailure(EnsureLoaded());
+
+    Entry * entry = FindEntry(node);
+    if (entry == nullptr)
+    {
+        entry = AdoptUnindexedRecord(node);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    }
+    ReturnErrorOnFailure(LoadEntryState(*entry));
+
+    resumptionId    = entry->mResumptionId;
+    sharedSecret    = entry->mSharedSecret;
+    peerCATs        = entry->mPeerCATs;
+    entry->mLastUse = ++mUseCounter;
     return CHIP_NO_ERROR;
 }
 
@@ -42,132 +75,122 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindByResumptionId(ConstResumptionId
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node)
 {
-    ReturnErrorOnFailure(LoadLink(resumptionId, node));
+    ReturnErrorOnFailure(EnsureLoaded());
+
+    Entry * entry = FindEntry(resumptionId);
+    if (entry == nullptr)
+    {
+        // The resumption IDs of the records whose state is not loaded yet, or that are missing from the index, are only known
+        // from their links.
+        ReturnErrorOnFailure(LoadLink(resumptionId, node));
+        entry = FindEntry(node);
+        if (entry == nullptr)
+        {
+            entry = AdoptUnindexedRecord(node);
+            VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        }
+        ReturnErrorOnFailure(LoadEntryState(*entry));
+    }
+
+    node = entry->mNode;
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
                                                  const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
 {
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(EnsureLoaded());
 
-    for (size_t i = 0; i < index.mSize; ++i)
+    Entry * entry = FindEntry(node);
+    if (entry == nullptr)
     {
-        if (index.mNodes[i] == node)
+        // A record left out of the index is replaced like the others, so that its link is deleted.
+        entry = AdoptUnindexedRecord(node);
+    }
+    if (entry != nullptr)
+    {
+        // Node already exists in the index.  Save in place.
+        //
+        // This follows the approach in Delete.  Removal of the old
+        // resumption-id-keyed link is best effort.  If we cannot load
+        // state to lookup the resumption ID for the key, the entry in
+        // the link table will be leaked.
+        CHIP_ERROR err = LoadEntryState(*entry);
+        if (err != CHIP_NO_ERROR)
         {
-            // Node already exists in the index.  Save in place.
-            CHIP_ERROR err = CHIP_NO_ERROR;
-            ResumptionIdStorage oldResumptionId;
-            Crypto::P256ECDHDerivedSecret oldSharedSecret;
-            CATValues oldPeerCATs;
-            // This follows the approach in Delete.  Removal of the old
-            // resumption-id-keyed link is best effort.  If we cannot load
-            // state to lookup the resumption ID for the key, the entry in
-            // the link table will be leaked.
-            err = LoadState(node, oldResumptionId, oldSharedSecret, oldPeerCATs);
+            ChipLogError(SecureChannel,
+                         "LoadState failed; unable to fully delete session resumption record for node " ChipLogFormatX64
+                         ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node.GetNodeId()), err.Format());
+            // The entry is dropped when its state is not found.
+            entry = FindEntry(node);
+        }
+        else
+        {
+            err = DeleteLink(entry->mResumptionId);
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(SecureChannel,
-                             "LoadState failed; unable to fully delete session resumption record for node " ChipLogFormatX64
+                             "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
                              ": %" CHIP_ERROR_FORMAT,
                              ChipLogValueX64(node.GetNodeId()), err.Format());
             }
-            else
-            {
-                err = DeleteLink(oldResumptionId);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(SecureChannel,
-                                 "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
-                                 ": %" CHIP_ERROR_FORMAT,
-                                 ChipLogValueX64(node.GetNodeId()), err.Format());
-                }
-            }
-            ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
-            ReturnErrorOnFailure(SaveLink(resumptionId, node));
-            return CHIP_NO_ERROR;
         }
     }
 
-    // Constant product inside a CHIPConfig.h macro; cannot widen at the use site.
-    // NOLINTNEXTLINE(bugprone-implicit-widening-of-multiplication-result)
-    if (index.mSize == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
+    bool added = false;
+    if (entry == nullptr)
     {
-        // TODO: implement LRU for resumption
-        ReturnErrorOnFailure(Delete(index.mNodes[0]));
-        ReturnErrorOnFailure(LoadIndex(index));
+        entry = AllocateEntryEvictingIfFull(node);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NO_MEMORY);
+        added = true;
+    }
+    else if (entry->mStateLoaded)
+    {
+        mResumptionIdIndex.Remove(Hash(entry->mResumptionId), IndexOf(*entry),
+                                  [this](uint16_t i) { return Hash(mEntries[i].mResumptionId); });
+        entry->mStateLoaded = false;
     }
 
-    ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
-    ReturnErrorOnFailure(SaveLink(resumptionId, node));
-
-    index.mNodes[index.mSize++] = node;
-    ReturnErrorOnFailure(SaveIndex(index));
-
-    return CHIP_NO_ERROR;
-}
-
-CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
-{
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
-
-    ResumptionIdStorage resumptionId;
-    Crypto::P256ECDHDerivedSecret sharedSecret;
-    CATValues peerCATs;
-    CHIP_ERROR err = LoadState(node, resumptionId, sharedSecret, peerCATs);
+    CHIP_ERROR err = SaveState(node, resumptionId, sharedSecret, peerCATs);
     if (err == CHIP_NO_ERROR)
     {
-        err = DeleteLink(resumptionId);
-        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
-        {
-            ChipLogError(SecureChannel,
-                         "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                         ChipLogValueX64(node.GetNodeId()), err.Format());
-        }
+        err = SaveLink(resumptionId, node);
     }
-    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    if (err != CHIP_NO_ERROR)
     {
-        ChipLogError(SecureChannel,
-                     "Unable to load session resumption state during session deletion for node " ChipLogFormatX64
-                     ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
+        // The record may be incomplete, so it is dropped.  A stale state left in storage is overwritten by the next save.
+        RemoveEntry(*entry);
+        MarkIndexDirty();
+        return err;
     }
 
-    err = DeleteState(node);
-    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
-    {
-        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
-    }
+    std::copy(resumptionId.begin(), resumptionId.end(), entry->mResumptionId.begin());
+    entry->mSharedSecret = sharedSecret;
+    entry->mPeerCATs     = peerCATs;
+    entry->mStateLoaded  = true;
+    entry->mLastUse      = ++mUseCounter;
+    mResumptionIdIndex.Insert(Hash(entry->mResumptionId), IndexOf(*entry));
 
-    bool found = false;
-    for (size_t i = 0; i < index.mSize; ++i)
+    if (added)
     {
-        if (found)
-        {
-            // index.mSize was decreased by 1 when found was set to true.
-            // So the (i+1)th element isn't out of bounds.
-            index.mNodes[i] = index.mNodes[i + 1];
-        }
-        else
-        {
-            if (index.mNodes[i] == node)
-            {
-                found = true;
-                if (i + 1 < index.mSize)
-                {
-                    index.mNodes[i] = index.mNodes[i + 1];
-                }
-                index.mSize -= 1;
-            }
-        }
+        MarkIndexDirty();
     }
 
-    if (found)
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
+{
+    ReturnErrorOnFailure(EnsureLoaded());
+
+    Entry * entry = FindEntry(node);
+    DeleteRecord(node, entry);
+
+    if (entry != nullptr)
     {
-        err = SaveIndex(index);
+        mIndexDirty    = true;
+        CHIP_ERROR err = FlushIndex();
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
@@ -175,9 +198,8 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
     }
     else
     {
-        ChipLogError(SecureChannel,
-                     "Unable to find session resumption state for node in index" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
+        ChipLogError(SecureChannel, "Unable to find session resumption state for node in index " ChipLogFormatX64,
+                     ChipLogValueX64(node.GetNodeId()));
     }
 
     return CHIP_NO_ERROR;
@@ -186,23 +208,21 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
 {
     CHIP_ERROR stickyErr = CHIP_NO_ERROR;
-    size_t found         = 0;
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
-    size_t initialSize = index.mSize;
-    for (size_t i = 0; i < initialSize; ++i)
-    {
-        CHIP_ERROR err = CHIP_NO_ERROR;
-        size_t cur     = i - found;
-        size_t remain  = initialSize - i;
-        ResumptionIdStorage resumptionId;
-        Crypto::P256ECDHDerivedSecret sharedSecret;
-        CATValues peerCATs;
-        if (index.mNodes[cur].GetFabricIndex() != fabricIndex)
+    bool found           = false;
+    ReturnErrorOnFailure(EnsureLoaded());
+    for (auto & entry : mEntries)
+    {
+        if (entry.mLastUse == 0 || entry.mNode.GetFabricIndex() != fabricIndex)
         {
             continue;
         }
-        err       = LoadState(index.mNodes[cur], resumptionId, sharedSecret, peerCATs);
+        CHIP_ERROR err = LoadEntryState(entry);
+        if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            // Nothing left in storage, and the entry was dropped.
+            found = true;
+            continue;
+        }
         stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -212,7 +232,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
                          fabricIndex, err.Format());
             continue;
         }
-        err       = DeleteLink(resumptionId);
+        err       = DeleteLink(entry.mResumptionId);
         stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -222,7 +242,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
                          fabricIndex, err.Format());
             continue;
         }
-        err       = DeleteState(index.mNodes[cur]);
+        err       = DeleteState(entry.mNode);
         stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -232,17 +252,14 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
                          fabricIndex, err.Format());
             continue;
         }
-        ++found;
-        --remain;
-        if (remain)
-        {
-            memmove(&index.mNodes[cur], &index.mNodes[cur + 1], remain * sizeof(index.mNodes[0]));
-        }
+        RemoveEntry(entry);
+        found = true;
     }
     if (found)
     {
-        index.mSize -= found;
-        CHIP_ERROR err = SaveIndex(index);
+        // Unlike additions, removals are written right away.
+        mIndexDirty    = true;
+        CHIP_ERROR err = FlushIndex();
         stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -256,4 +273,342 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
     return stickyErr;
 }
 
+CHIP_ERROR DefaultSessionResumptionStorage::FlushIndex()
+{
+    VerifyOrReturnError(mIndexDirty, CHIP_NO_ERROR);
+
+    if (DeviceLayer::SystemLayer().IsInitialized())
+    {
+        DeviceLayer::SystemLayer().CancelTimer(FlushTimerHandler, this);
+    }
+
+    // Write the records from the least to the most recently used, so that they are replaced in the same order once the
+    // index is loaded again.
+    uint16_t order[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    size_t count = 0;
+    for (uint16_t i = 0; i < MATTER_ARRAY_SIZE(mEntries); ++i)
+    {
+        if (mEntries[i].mLastUse != 0)
+        {
+            order[count++] = i;
+        }
+    }
+    std::sort(order, order + count, [this](uint16_t a, uint16_t b) { return mEntries[a].mLastUse < mEntries[b].mLastUse; });
+
+    SessionIndex index;
+    index.mSize = count;
+    for (size_t i = 0; i < count; ++i)
+    {
+        index.mNodes[i] = mEntries[order[i]].mNode;
+    }
+    ReturnErrorOnFailure(SaveIndex(index));
+
+    mIndexDirty = false;
+    return CHIP_NO_ERROR;
+}
+
+void DefaultSessionResumptionStorage::ResetCache()
+{
+    if (DeviceLayer::SystemLayer().IsInitialized())
+    {
+        DeviceLayer::SystemLayer().CancelTimer(FlushTimerHandler, this);
+    }
+    for (auto & entry : mEntries)
+    {
+        ClearEntry(entry);
+    }
+    mNodeIndex.Clear();
+    mResumptionIdIndex.Clear();
+    mEntryCount = 0;
+    mUseCounter = 0;
+    mLoaded     = false;
+    mIndexDirty = false;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::EnsureLoaded()
+{
+    VerifyOrReturnError(!mLoaded, CHIP_NO_ERROR);
+
+    SessionIndex index;
+    ReturnErrorOnFailure(LoadIndex(index));
+
+    ResetCache();
+    // The index lists the records from the least to the most recently used.  The state of each record is only loaded
+    // when it is first needed.
+    for (size_t i = 0; i < index.mSize; ++i)
+    {
+        if (FindEntry(index.mNodes[i]) == nullptr)
+        {
+            VerifyOrReturnError(AllocateEntry(index.mNodes[i]) != nullptr, CHIP_ERROR_INTERNAL);
+        }
+    }
+
+    mLoaded = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::LoadEntryState(Entry & entry)
+{
+    VerifyOrReturnError(!entry.mStateLoaded, CHIP_NO_ERROR);
+
+    CHIP_ERROR err = LoadState(entry.mNode, entry.mResumptionId, entry.mSharedSecret, entry.mPeerCATs);
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        // The index lists a record that is gone, e.g. when the index could not be written before a reboot.
+        RemoveEntry(entry);
+        MarkIndexDirty();
+    }
+    ReturnErrorOnFailure(err);
+
+    entry.mStateLoaded = true;
+    mResumptionIdIndex.Insert(Hash(entry.mResumptionId), IndexOf(entry));
+    return CHIP_NO_ERROR;
+}
+
+DefaultSessionResumptionStorage::Entry * DefaultSessionResumptionStorage::FindEntry(const ScopedNodeId & node)
+{
+    constexpr size_t kMask = kBucketCount - 1;
+    for (size_t bucket = Hash(node) & kMask;; bucket = (bucket + 1) & kMask)
+    {
+        const uint16_t i = mNodeIndex.mBuckets[bucket];
+        VerifyOrReturnValue(i != kNoEntry, nullptr);
+        if (mEntries[i].mNode == node)
+        {
+            return &mEntries[i];
+        }
+    }
+}
+
+DefaultSessionResumptionStorage::Entry * DefaultSessionResumptionStorage::FindEntry(ConstResumptionIdView resumptionId)
+{
+    constexpr size_t kMask = kBucketCount - 1;
+    for (size_t bucket = Hash(resumptionId) & kMask;; bucket = (bucket + 1) & kMask)
+    {
+        const uint16_t i = mResumptionIdIndex.mBuckets[bucket];
+        VerifyOrReturnValue(i != kNoEntry, nullptr);
+        if (std::equal(resumptionId.begin(), resumptionId.end(), mEntries[i].mResumptionId.begin()))
+        {
+            return &mEntries[i];
+        }
+    }
+}
+
+DefaultSessionResumptionStorage::Entry * DefaultSessionResumptionStorage::AllocateEntry(const ScopedNodeId & node)
+{
+    for (uint16_t i = 0; i < MATTER_ARRAY_SIZE(mEntries); ++i)
+    {
+        Entry & entry = mEntries[i];
+        if (entry.mLastUse == 0)
+        {
+            entry.mNode        = node;
+            entry.mStateLoaded = false;
+            entry.mLastUse     = ++mUseCounter;
+            mNodeIndex.Insert(Hash(node), i);
+            ++mEntryCount;
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+DefaultSessionResumptionStorage::Entry * DefaultSessionResumptionStorage::AllocateEntryEvictingIfFull(const ScopedNodeId & node)
+{
+    if (mEntryCount == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
+    {
+        // Replace the least recently used record.  Finding it only costs a scan of the entries in memory.
+        Entry * victim = nullptr;
+        for (auto & candidate : mEntries)
+        {
+            if (candidate.mLastUse != 0 && (victim == nullptr || candidate.mLastUse < victim->mLastUse))
+            {
+                victim = &candidate;
+            }
+        }
+        DeleteRecord(victim->mNode, victim);
+        MarkIndexDirty();
+    }
+
+    return AllocateEntry(node);
+}
+
+DefaultSessionResumptionStorage::Entry * DefaultSessionResumptionStorage::AdoptUnindexedRecord(const ScopedNodeId & node)
+{
+    ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    CHIP_ERROR err = LoadState(node, resumptionId, sharedSecret, peerCATs);
+    if (err != CHIP_NO_ERROR)
+    {
+        if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(SecureChannel,
+                         "Unable to load session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node.GetNodeId()), err.Format());
+        }
+        return nullptr;
+    }
+
+    ChipLogProgress(SecureChannel, "Adding unindexed session resumption record for node " ChipLogFormatX64 " to the index",
+                    ChipLogValueX64(node.GetNodeId()));
+    Entry * entry = AllocateEntryEvictingIfFull(node);
+    if (entry != nullptr)
+    {
+        entry->mResumptionId = resumptionId;
+        entry->mSharedSecret = sharedSecret;
+        entry->mPeerCATs     = peerCATs;
+        entry->mStateLoaded  = true;
+        mResumptionIdIndex.Insert(Hash(entry->mResumptionId), IndexOf(*entry));
+        MarkIndexDirty();
+    }
+    Crypto::ClearSecretData(sharedSecret.Bytes(), sharedSecret.Capacity());
+    return entry;
+}
+
+void DefaultSessionResumptionStorage::DeleteRecord(const ScopedNodeId & node, Entry * entry)
+{
+    ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (entry != nullptr && entry->mStateLoaded)
+    {
+        resumptionId = entry->mResumptionId;
+    }
+    else
+    {
+        err = LoadState(node, resumptionId, sharedSecret, peerCATs);
+    }
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = DeleteLink(resumptionId);
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(SecureChannel,
+                         "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node.GetNodeId()), err.Format());
+        }
+    }
+    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel,
+                     "Unable to load session resumption state during session deletion for node " ChipLogFormatX64
+                     ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(node.GetNodeId()), err.Format());
+    }
+
+    err = DeleteState(node);
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(node.GetNodeId()), err.Format());
+    }
+
+    if (entry != nullptr)
+    {
+        RemoveEntry(*entry);
+    }
+}
+
+void DefaultSessionResumptionStorage::RemoveEntry(Entry & entry)
+{
+    const uint16_t i = IndexOf(entry);
+    mNodeIndex.Remove(Hash(entry.mNode), i, [this](uint16_t j) { return Hash(mEntries[j].mNode); });
+    if (entry.mStateLoaded)
+    {
+        mResumptionIdIndex.Remove(Hash(entry.mResumptionId), i, [this](uint16_t j) { return Hash(mEntries[j].mResumptionId); });
+    }
+    ClearEntry(entry);
+    --mEntryCount;
+}
+
+void DefaultSessionResumptionStorage::ClearEntry(Entry & entry)
+{
+    Crypto::ClearSecretData(entry.mSharedSecret.Bytes(), entry.mSharedSecret.Capacity());
+    entry.mLastUse     = 0;
+    entry.mStateLoaded = false;
+}
+
+void DefaultSessionResumptionStorage::MarkIndexDirty()
+{
+    mIndexDirty = true;
+
+    System::Layer & systemLayer = DeviceLayer::SystemLayer();
+    if (kIndexWriteDelay.count() > 0 && systemLayer.IsInitialized())
+    {
+        VerifyOrReturn(!systemLayer.IsTimerActive(FlushTimerHandler, this));
+        CHIP_ERROR err = systemLayer.StartTimer(kIndexWriteDelay, FlushTimerHandler, this);
+        VerifyOrReturn(err != CHIP_NO_ERROR);
+        ChipLogError(SecureChannel, "Unable to defer writing the session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    CHIP_ERROR err = FlushIndex();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void DefaultSessionResumptionStorage::FlushTimerHandler(System::Layer *, void * appState)
+{
+    CHIP_ERROR err = static_cast<DefaultSessionResumptionStorage *>(appState)->FlushIndex();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+size_t DefaultSessionResumptionStorage::Hash(const ScopedNodeId & node)
+{
+    return static_cast<size_t>(FibonacciHash64(node.GetNodeId() ^ (static_cast<uint64_t>(node.GetFabricIndex()) << 56)) >> 32);
+}
+
+size_t DefaultSessionResumptionStorage::Hash(ConstResumptionIdView resumptionId)
+{
+    uint64_t value;
+    memcpy(&value, resumptionId.data(), sizeof(value));
+    return static_cast<size_t>(FibonacciHash64(value) >> 32);
+}
+
+void DefaultSessionResumptionStorage::HashIndex::Clear()
+{
+    std::fill(std::begin(mBuckets), std::end(mBuckets), kNoEntry);
+}
+
+void DefaultSessionResumptionStorage::HashIndex::Insert(size_t hash, uint16_t entryIndex)
+{
+    constexpr size_t kMask = kBucketCount - 1;
+    size_t bucket          = hash & kMask;
+    while (mBuckets[bucket] != kNoEntry)
+    {
+        bucket = (bucket + 1) & kMask;
+    }
+    mBuckets[bucket] = entryIndex;
+}
+
+template <typename EntryHash>
+void DefaultSessionResumptionStorage::HashIndex::Remove(size_t hash, uint16_t entryIndex, EntryHash && entryHash)
+{
+    constexpr size_t kMask = kBucketCount - 1;
+    size_t hole            = hash & kMask;
+    while (mBuckets[hole] != entryIndex)
+    {
+        VerifyOrReturn(mBuckets[hole] != kNoEntry);
+        hole = (hole + 1) & kMask;
+    }
+
+    // Move back the entries that follow in the same run, unless their home bucket is after the hole, so that every entry
+    // stays reachable from its home bucket.
+    for (size_t next = (hole + 1) & kMask; mBuckets[next] != kNoEntry; next = (next + 1) & kMask)
+    {
+        const size_t home = entryHash(mBuckets[next]) & kMask;
+        if (((next - home) & kMask) >= ((next - hole) & kMask))
+        {
+            mBuckets[hole] = mBuckets[next];
+            hole           = next;
+        }
+    }
+    mBuckets[hole] = kNoEntry;
+}
+
 } // namespace chip
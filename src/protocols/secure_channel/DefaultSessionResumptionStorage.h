@@ -17,7 +17,11 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <protocols/secure_channel/SessionResumptionStorage.h>
+#include <system/SystemLayer.h>
+
+#include <stdint.h>
 
 namespace chip {
 
@@ -29,6 +33,13 @@ namespace chip {
  *   The implementation saves 2 maps:
  *     * <FabricIndex, PeerNodeId>   => <ResumptionId, ShareSecret, PeerCATs>
  *     * <ResumptionId>              => <FabricIndex, PeerNodeId>
+ *
+ *   The records are also kept in memory, with hash indexes on both keys, so that finding a record costs at most one storage
+ *   read.  The index is loaded on first use, and the state of each record the first time it is needed.  Saving a session
+ *   writes its state and link right away, but the index, which is rewritten as a whole, is written after
+ *   CHIP_CONFIG_CASE_SESSION_RESUME_INDEX_WRITE_DELAY_MS so that the sessions established meanwhile are written at once,
+ *   or by Flush() on shutdown.  A record whose index entry was lost is added back to the index when its peer is looked up or
+ *   saved again.  When the storage is full, the least recently used record is replaced.
  */
 class DefaultSessionResumptionStorage : public SessionResumptionStorage
 {
@@ -41,7 +52,7 @@ public:
         ScopedNodeId mNodes[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
     };
 
-    virtual ~DefaultSessionResumptionStorage() {}
+    virtual ~DefaultSessionResumptionStorage();
 
     CHIP_ERROR FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                   Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
@@ -52,8 +63,20 @@ public:
                     const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override;
     CHIP_ERROR Delete(const ScopedNodeId & node);
     CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
+    CHIP_ERROR Flush() override { return FlushIndex(); }
+
+    /**
+     * Write the index now if it has changes that are not written yet.
+     */
+    CHIP_ERROR FlushIndex();
 
 protected:
+    /**
+     * Forget the records kept in memory, so that they are loaded again from storage, e.g. when the storage changes.  Changes
+     * of the index that are not written yet are lost.
+     */
+    void ResetCache();
+
     CHIP_ERROR virtual SaveIndex(const SessionIndex & index) = 0;
     CHIP_ERROR virtual LoadIndex(SessionIndex & index)       = 0;
 
@@ -66,6 +89,76 @@ protected:
     CHIP_ERROR virtual LoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)             = 0;
     CHIP_ERROR virtual DeleteState(const ScopedNodeId & node)                                                    = 0;
+
+private:
+    static_assert(CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE < UINT16_MAX, "Entry indexes must fit in a uint16_t");
+
+    static constexpr uint16_t kNoEntry = UINT16_MAX;
+
+    // A power of two that keeps the load factor of the hash indexes at or below 1/2.
+    static constexpr size_t kBucketCount = [] {
+        size_t count = 1;
+        // Constant product inside a CHIPConfig.h macro; cannot widen at the use site.
+        // NOLINTNEXTLINE(bugprone-implicit-widening-of-multiplication-result)
+        while (count < 2 * CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
+        {
+            count *= 2;
+        }
+        return count;
+    }();
+
+    struct Entry
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        Crypto::P256ECDHDerivedSecret mSharedSecret;
+        CATValues mPeerCATs;
+        // Value of mUseCounter when the record was last saved or found, 0 if the entry is free.
+        uint64_t mLastUse = 0;
+        // Whether mResumptionId, mSharedSecret and mPeerCATs are loaded from storage.
+        bool mStateLoaded = false;
+    };
+
+    // Hash table of entry indexes with linear probing.
+    struct HashIndex
+    {
+        uint16_t mBuckets[kBucketCount];
+
+        void Clear();
+        void Insert(size_t hash, uint16_t entryIndex);
+        // The hash of each entry is needed to move the entries that follow the removed one.
+        template <typename EntryHash>
+        void Remove(size_t hash, uint16_t entryIndex, EntryHash && entryHash);
+    };
+
+    static size_t Hash(const ScopedNodeId & node);
+    static size_t Hash(ConstResumptionIdView resumptionId);
+
+    CHIP_ERROR EnsureLoaded();
+    CHIP_ERROR LoadEntryState(Entry & entry);
+    Entry * FindEntry(const ScopedNodeId & node);
+    Entry * FindEntry(ConstResumptionIdView resumptionId);
+    Entry * AllocateEntry(const ScopedNodeId & node);
+    // Replaces the least recently used record if the storage is full.
+    Entry * AllocateEntryEvictingIfFull(const ScopedNodeId & node);
+    // Adds to the index the record of node found in storage but not in the index, e.g. when the index could not be written
+    // before a reboot, so that it is found, replaced and deleted like the others.
+    Entry * AdoptUnindexedRecord(const ScopedNodeId & node);
+    // Best effort removal of the record of node from storage, and of its entry, if any, from memory.
+    void DeleteRecord(const ScopedNodeId & node, Entry * entry);
+    void RemoveEntry(Entry & entry);
+    void ClearEntry(Entry & entry);
+    uint16_t IndexOf(const Entry & entry) const { return static_cast<uint16_t>(&entry - mEntries); }
+    void MarkIndexDirty();
+    static void FlushTimerHandler(System::Layer *, void * appState);
+
+    Entry mEntries[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    HashIndex mNodeIndex;
+    HashIndex mResumptionIdIndex;
+    size_t mEntryCount   = 0;
+    uint64_t mUseCounter = 0;
+    bool mLoaded         = false;
+    bool mIndexDirty     = false;
 };
 
 } // namespace chip
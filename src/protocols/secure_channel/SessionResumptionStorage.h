@@ -89,6 +89,14 @@ public:
      * @return CHIP_NO_ERROR on success, else an appropriate CHIP error on failure
      */
     virtual CHIP_ERROR DeleteAll(FabricIndex fabricIndex) = 0;
+
+    /**
+     * Write to storage the session resumption information that is held back,
+     * if any.  Called on shutdown, so that nothing is lost.
+     *
+     * @return CHIP_NO_ERROR on success, else an appropriate CHIP error on failure
+     */
+    virtual CHIP_ERROR Flush() { return CHIP_NO_ERROR; }
 };
 
 } // namespace chip
@@ -39,7 +39,17 @@ public:
     CHIP_ERROR Init(PersistentStorageDelegate * storage)
     {
         VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        if (mStorage != nullptr)
+        {
+            // The pending index changes belong to the previous storage.
+            CHIP_ERROR err = FlushIndex();
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
+            }
+        }
         mStorage = storage;
+        ResetCache();
         return CHIP_NO_ERROR;
     }
 
@@ -82,7 +92,7 @@ private:
     static constexpr TLV::Tag kSharedSecretTag = TLV::ContextTag(4);
     static constexpr TLV::Tag kCATTag          = TLV::ContextTag(5);
 
-    PersistentStorageDelegate * mStorage;
+    PersistentStorageDelegate * mStorage = nullptr;
 };
 
 } // namespace chip
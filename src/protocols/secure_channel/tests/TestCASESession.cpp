@@ -241,6 +241,9 @@ public:
         return mKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
     }
 
+    bool SupportsSignWithOpKeypairInBackground() const override { return mSignInBackground; }
+    void SetSignInBackground(bool signInBackground) { mSignInBackground = signInBackground; }
+
     Crypto::P256Keypair * AllocateEphemeralKeypairForCASE() override { return Platform::New<Crypto::P256Keypair>(); }
 
     void ReleaseEphemeralKeypair(Crypto::P256Keypair * keypair) override { Platform::Delete<Crypto::P256Keypair>(keypair); }
@@ -248,6 +251,7 @@ public:
 protected:
     Platform::UniquePtr<P256Keypair> mKeypair;
     FabricIndex mSingleFabricIndex = kUndefinedFabricIndex;
+    bool mSignInBackground         = false;
 };
 
 #if CHIP_CONFIG_SLOW_CRYPTO
@@ -643,6 +647,66 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
     gPairingServer.Shutdown();
 }
 
+/* This tests that the responder only signs Sigma2 in the background when its operational keystore supports it: the
+   responder waits in kSendSigma2Pending until the signature is done, and otherwise signs and sends Sigma2 inline. */
+TEST_F(TestCASESession, Sigma2SignatureInBackground)
+{
+    for (bool signInBackground : { true, false })
+    {
+        TemporarySessionManager sessionManager(*this);
+        TestCASESecurePairingDelegate delegateInitiator;
+        TestCASESecurePairingDelegate delegateResponder;
+        CASESession pairingInitiator;
+        CASESession pairingResponder;
+
+        gDeviceOperationalKeystore.SetSignInBackground(signInBackground);
+
+        auto & loopback            = GetLoopback();
+        loopback.mSentMessageCount = 0;
+
+        pairingInitiator.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        ExchangeContext * contextInitiator = NewUnauthenticatedExchangeToBob(&pairingInitiator);
+
+        EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                                &pairingResponder),
+                  CHIP_NO_ERROR);
+        pairingResponder.SetGroupDataProvider(&gDeviceGroupDataProvider);
+
+        EXPECT_SUCCESS(pairingResponder.PrepareForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, nullptr,
+                                                                       &delegateResponder, ScopedNodeId(),
+                                                                       Optional<ReliableMessageProtocolConfig>::Missing()));
+        EXPECT_SUCCESS(pairingInitiator.EstablishSession(
+            sessionManager, &gCommissionerFabrics, ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextInitiator, nullptr,
+            nullptr, &delegateInitiator, Optional<ReliableMessageProtocolConfig>::Missing()));
+
+        // Deliver the messages without running the event loop, where background work completes.
+        DrainAndServiceIO();
+
+        if (signInBackground)
+        {
+            EXPECT_EQ(pairingResponder.GetState(), CASESession::State::kSendSigma2Pending);
+            EXPECT_EQ(pairingInitiator.GetState(), CASESession::State::kSentSigma1);
+        }
+        else
+        {
+            EXPECT_EQ(pairingInitiator.GetState(), CASESession::State::kSentSigma3);
+        }
+
+        ServiceEvents();
+
+        EXPECT_EQ(loopback.mSentMessageCount, sTestCaseMessageCount);
+        EXPECT_EQ(delegateResponder.mNumPairingComplete, 1u);
+        EXPECT_EQ(delegateInitiator.mNumPairingComplete, 1u);
+        EXPECT_EQ(delegateResponder.mNumPairingErrors, 0u);
+        EXPECT_EQ(delegateInitiator.mNumPairingErrors, 0u);
+
+        EXPECT_SUCCESS(
+            GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1));
+    }
+
+    gDeviceOperationalKeystore.SetSignInBackground(false);
+}
+
 #if CHIP_WITH_NLFAULTINJECTION
 
 /* This tests that Corrupting Signature during a CASE Handshake will lead to CASE Failing and to the Correct Error returned.
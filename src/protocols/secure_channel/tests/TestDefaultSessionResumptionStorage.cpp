@@ -21,6 +21,9 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/RAIIMockClock.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
 
 // DefaultSessionResumptionStorage is a partial implementation.
 // Use SimpleSessionResumptionStorage, which extends it, to test.
@@ -64,9 +67,8 @@ TEST(TestDefaultSessionResumptionStorage, TestSave)
 
     // Verify behavior for over-fill.
     //
-    // Currently, DefaultSessionResumptionStorage replaces index 0.
-    // If more sophisticated LRU behavior is implemented, this test
-    // case should be modified to match.
+    // DefaultSessionResumptionStorage replaces the least recently used
+    // record, which is index 0 here.  See TestLeastRecentlyUsed.
     {
         size_t last = MATTER_ARRAY_SIZE(vectors) - 1;
         EXPECT_EQ(
@@ -106,6 +108,73 @@ TEST(TestDefaultSessionResumptionStorage, TestSave)
     }
 }
 
+TEST(TestDefaultSessionResumptionStorage, TestLeastRecentlyUsed)
+{
+    chip::TestPersistentStorageDelegate storage;
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    EXPECT_SUCCESS(sessionStorage.Init(&storage));
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    struct
+    {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        chip::ScopedNodeId node;
+    } vectors[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE + 1];
+
+    EXPECT_SUCCESS(sharedSecret.SetLength(sharedSecret.Capacity()));
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(vectors); ++i)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(vectors[i].resumptionId.data(), vectors[i].resumptionId.size()), CHIP_NO_ERROR);
+        *vectors[i].resumptionId.data() = static_cast<uint8_t>(i);
+        vectors[i].node = chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), static_cast<chip::FabricIndex>(i + 1));
+    }
+
+    // Fill storage.
+    // Constant product inside a CHIPConfig.h macro; cannot widen at the use site.
+    // NOLINTNEXTLINE(bugprone-implicit-widening-of-multiplication-result)
+    for (size_t i = 0; i < CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE; ++i)
+    {
+        EXPECT_EQ(sessionStorage.Save(vectors[i].node, vectors[i].resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    }
+
+    chip::ScopedNodeId outNode;
+    chip::SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+
+    // Using the oldest record makes the second one the least recently used.
+    EXPECT_EQ(sessionStorage.FindByScopedNodeId(vectors[0].node, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+
+    size_t last = MATTER_ARRAY_SIZE(vectors) - 1;
+    EXPECT_EQ(sessionStorage.Save(vectors[last].node, vectors[last].resumptionId, sharedSecret, chip::CATValues{}),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(sessionStorage.FindByScopedNodeId(vectors[1].node, outResumptionId, outSharedSecret, outCats),
+              CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_NE(sessionStorage.FindByResumptionId(vectors[1].resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+
+    // Another instance loads the records from storage in the order of their last use, so the least recently used
+    // record is still the first one replaced.
+    chip::SimpleSessionResumptionStorage reloadedStorage;
+    EXPECT_SUCCESS(reloadedStorage.Init(&storage));
+    chip::ScopedNodeId extraNode(static_cast<chip::NodeId>(last + 2), static_cast<chip::FabricIndex>(1));
+    chip::SessionResumptionStorage::ResumptionIdStorage extraResumptionId = vectors[1].resumptionId;
+    *extraResumptionId.data()                                            = 0xff;
+    EXPECT_EQ(reloadedStorage.Save(extraNode, extraResumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    EXPECT_EQ(reloadedStorage.FindByScopedNodeId(vectors[2].node, outResumptionId, outSharedSecret, outCats),
+              CHIP_ERROR_KEY_NOT_FOUND);
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(vectors); ++i)
+    {
+        if (i == 1 || i == 2)
+        {
+            continue;
+        }
+        EXPECT_EQ(reloadedStorage.FindByResumptionId(vectors[i].resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(vectors[i].node, outNode);
+        EXPECT_EQ(memcmp(sharedSecret.ConstBytes(), outSharedSecret.ConstBytes(), sharedSecret.Length()), 0);
+    }
+}
+
 TEST(TestDefaultSessionResumptionStorage, TestInPlaceSave)
 {
     chip::SimpleSessionResumptionStorage sessionStorage;
@@ -393,3 +462,123 @@ TEST(TestDefaultSessionResumptionStorage, TestDeleteAll)
         }
     }
 }
+
+// The index is written after a delay when the system layer is running, which the tests above do not exercise.
+class TestDefaultSessionResumptionStorageDeferred : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(sIOContext.Init(), CHIP_NO_ERROR);
+        chip::DeviceLayer::SetSystemLayerForTesting(&sIOContext.GetSystemLayer());
+    }
+
+    static void TearDownTestSuite()
+    {
+        chip::DeviceLayer::SetSystemLayerForTesting(nullptr);
+        sIOContext.Shutdown();
+    }
+
+protected:
+    void SetUp() override
+    {
+        EXPECT_SUCCESS(mSharedSecret.SetLength(mSharedSecret.Capacity()));
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(mSharedSecret.Bytes(), mSharedSecret.Length()), CHIP_NO_ERROR);
+    }
+
+    void AdvanceClockAndRunEventLoop(chip::System::Clock::Milliseconds32 time)
+    {
+        mMockClock.AdvanceMonotonic(time);
+        sIOContext.DriveIO();
+    }
+
+    bool IndexWritten() { return mStorage.SyncDoesKeyExist(chip::DefaultStorageKeyAllocator::SessionResumptionIndex().KeyName()); }
+
+    static chip::Testing::IOContext sIOContext;
+
+    chip::System::Clock::Internal::RAIIMockClock mMockClock;
+    chip::TestPersistentStorageDelegate mStorage;
+    chip::Crypto::P256ECDHDerivedSecret mSharedSecret;
+};
+
+chip::Testing::IOContext TestDefaultSessionResumptionStorageDeferred::sIOContext;
+
+TEST_F(TestDefaultSessionResumptionStorageDeferred, TestDeferredIndexWrite)
+{
+    constexpr chip::System::Clock::Milliseconds32 kDelay(CHIP_CONFIG_CASE_SESSION_RESUME_INDEX_WRITE_DELAY_MS);
+    chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    EXPECT_SUCCESS(sessionStorage.Init(&mStorage));
+
+    // Sessions established within the delay share one write of the index.
+    for (chip::NodeId nodeId = 1; nodeId <= 2; ++nodeId)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(resumptionId.data(), resumptionId.size()), CHIP_NO_ERROR);
+        EXPECT_SUCCESS(sessionStorage.Save(chip::ScopedNodeId(nodeId, 1), resumptionId, mSharedSecret, chip::CATValues{}));
+    }
+    EXPECT_FALSE(IndexWritten());
+
+    AdvanceClockAndRunEventLoop(kDelay - chip::System::Clock::Milliseconds32(1));
+    EXPECT_FALSE(IndexWritten());
+
+    AdvanceClockAndRunEventLoop(chip::System::Clock::Milliseconds32(1));
+    EXPECT_TRUE(IndexWritten());
+
+    chip::DefaultSessionResumptionStorage::SessionIndex index;
+    EXPECT_SUCCESS(sessionStorage.LoadIndex(index));
+    EXPECT_EQ(index.mSize, 2u);
+}
+
+TEST_F(TestDefaultSessionResumptionStorageDeferred, TestFlush)
+{
+    chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(resumptionId.data(), resumptionId.size()), CHIP_NO_ERROR);
+    {
+        chip::SimpleSessionResumptionStorage sessionStorage;
+        EXPECT_SUCCESS(sessionStorage.Init(&mStorage));
+        EXPECT_SUCCESS(sessionStorage.Save(chip::ScopedNodeId(1, 1), resumptionId, mSharedSecret, chip::CATValues{}));
+        EXPECT_FALSE(IndexWritten());
+
+        // As on shutdown.
+        EXPECT_SUCCESS(sessionStorage.Flush());
+        EXPECT_TRUE(IndexWritten());
+    }
+
+    // The pending write is cancelled, so nothing runs on the destroyed storage.
+    AdvanceClockAndRunEventLoop(chip::System::Clock::Milliseconds32(CHIP_CONFIG_CASE_SESSION_RESUME_INDEX_WRITE_DELAY_MS));
+}
+
+TEST_F(TestDefaultSessionResumptionStorageDeferred, TestUnindexedRecord)
+{
+    const chip::ScopedNodeId node(1, 1);
+    chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    chip::SessionResumptionStorage::ResumptionIdStorage newResumptionId;
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(resumptionId.data(), resumptionId.size()), CHIP_NO_ERROR);
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(newResumptionId.data(), newResumptionId.size()), CHIP_NO_ERROR);
+
+    // Lose the index entry of the record, as on a power loss.
+    {
+        chip::SimpleSessionResumptionStorage sessionStorage;
+        EXPECT_SUCCESS(sessionStorage.Init(&mStorage));
+        EXPECT_SUCCESS(sessionStorage.Save(node, resumptionId, mSharedSecret, chip::CATValues{}));
+    }
+    EXPECT_FALSE(IndexWritten());
+
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    EXPECT_SUCCESS(sessionStorage.Init(&mStorage));
+    chip::ScopedNodeId outNode;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+    EXPECT_SUCCESS(sessionStorage.FindByResumptionId(resumptionId, outNode, outSharedSecret, outCats));
+    EXPECT_EQ(outNode, node);
+
+    // Saving again replaces the record found, link included.
+    EXPECT_SUCCESS(sessionStorage.Save(node, newResumptionId, mSharedSecret, chip::CATValues{}));
+    EXPECT_NE(sessionStorage.FindByResumptionId(resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+    EXPECT_SUCCESS(sessionStorage.Flush());
+
+    // The record is deleted with its fabric, and nothing but the index is left.
+    EXPECT_SUCCESS(sessionStorage.DeleteAll(node.GetFabricIndex()));
+    EXPECT_EQ(mStorage.GetNumKeys(), 1u);
+    EXPECT_TRUE(IndexWritten());
+}
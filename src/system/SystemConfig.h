@@ -394,6 +394,54 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+ *
+ *  @brief
+ *      When packet buffers are allocated from the heap (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0 on a non-LwIP
+ *      platform), keep freed buffers on per-size-class free lists and reuse them for later allocations, so that
+ *      steady-state messaging does not go through the general-purpose allocator.
+ *
+ *      Allocations are rounded up to one of three size classes: small buffers
+ *      (CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE), buffers of up to CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX,
+ *      and large buffers (CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES, for TCP).
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB 1
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE
+ *
+ *  @brief
+ *      Capacity of packet buffers in the small size class of the packet buffer slab allocator, e.g. for
+ *      acknowledgements and other header-only messages.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE 256
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE
+ *
+ *  @brief
+ *      Maximum number of free buffers kept by the packet buffer slab allocator for each of the small and MTU-sized
+ *      classes. Buffers freed beyond this are returned to the heap.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE 16
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE_LARGE
+ *
+ *  @brief
+ *      Maximum number of free large buffers kept by the packet buffer slab allocator.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE_LARGE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE_LARGE 2
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE_LARGE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -531,6 +579,30 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+ *
+ *  @brief
+ *      Defines whether (1) or not (0) the select()/epoll() based System Layer implementations keep pending timers in a
+ *      TimerHeap (a pairing heap with a hash index on callback and app state) rather than a sorted TimerList.
+ *
+ *      The heap makes starting a timer O(1) and cancelling one O(log n) amortized, at the cost of a few extra pointers
+ *      per timer, so it is enabled by default only for large systems that allocate pools from the heap.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_HEAP_INDEX_SIZE
+ *
+ *  @brief
+ *      Number of hash buckets used by TimerHeap to look up timers by callback and app state. Must be a power of two.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_HEAP_INDEX_SIZE
+#define CHIP_SYSTEM_CONFIG_TIMER_HEAP_INDEX_SIZE 256
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_HEAP_INDEX_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
  *
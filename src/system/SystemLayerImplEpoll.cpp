@@ -0,0 +1,692 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll().
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <limits>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
+
+namespace {
+
+constexpr unsigned kEpollTagShift   = 56;
+constexpr unsigned kEpollIndexShift = 32;
+
+uint32_t EpollEventsFromSets(int fd, const fd_set & readfds, const fd_set & writefds, const fd_set & exceptfds)
+{
+    uint32_t events = 0;
+    // POSIX does not define the fd_set parameter of FD_ISSET() as const, even though it isn't modified.
+    if (FD_ISSET(fd, const_cast<fd_set *>(&readfds)))
+        events |= EPOLLIN;
+    if (FD_ISSET(fd, const_cast<fd_set *>(&writefds)))
+        events |= EPOLLOUT;
+    if (FD_ISSET(fd, const_cast<fd_set *>(&exceptfds)))
+        events |= EPOLLPRI;
+    return events;
+}
+
+} // anonymous namespace
+
+CriticalFailure LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+#endif
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrReturnError(mEpollFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+    FD_ZERO(&mSourceRegistered.mReadSet);
+    FD_ZERO(&mSourceRegistered.mWriteSet);
+    FD_ZERO(&mSourceRegistered.mErrorSet);
+    // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+    mSourceRegisteredMaxFd = -1;
+
+    // Create an event to allow an arbitrary thread to wake the thread in the epoll loop.
+    CHIP_ERROR err = mWakeEvent.Open();
+    if (err == CHIP_NO_ERROR)
+    {
+        err = UpdateEpollRegistration(mWakeEvent.GetReadFD(), 0, EPOLLIN,
+                                      EncodeEpollData(EpollTag::kWakeEvent, 0, mWakeEvent.GetReadFD()));
+        if (err != CHIP_NO_ERROR)
+        {
+            mWakeEvent.Close();
+        }
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+        return err;
+    }
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    EventSourceClear();
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+    mWakeEvent.Close();
+
+    // Closing the epoll instance drops every remaining registration.
+    close(mEpollFd);
+    mEpollFd = -1;
+
+    // Return the packet buffers kept for reuse to the heap, so that they are not left allocated past the shutdown.
+    PacketBuffer::DrainSlabFreeLists();
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by notifying the wake event.
+     *
+     * If this is being called from within an I/O event callback, then the notification can be skipped,
+     * since the I/O thread is already awake.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CriticalFailure LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(delay.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    assertChipStackLockedByCurrentThread();
+
+    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    if (remainingTime.count() < delay.count())
+    {
+        return StartTimer(delay, onComplete, appState);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool LayerImplEpoll::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
+{
+    bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+
+    if (!timerIsActive)
+    {
+        // check if the timer is in the mExpiredTimers list about to be fired.
+        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
+        {
+            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
+            {
+                return true;
+            }
+        }
+    }
+
+    return timerIsActive;
+}
+
+Clock::Timeout LayerImplEpoll::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    return mTimerList.GetRemainingTime(onComplete, appState);
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer might be in the chunk of expired timers currently being fired.
+        timer = mExpiredTimers.Remove(onComplete, appState);
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CriticalFailure LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // As in LayerImplSelect, use an expires-ASAP timer as the closure, and do not cancel
+    // existing timers with the same callback and appState.
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+uint64_t LayerImplEpoll::EncodeEpollData(EpollTag tag, uint32_t index, int fd)
+{
+    return (static_cast<uint64_t>(tag) << kEpollTagShift) | (static_cast<uint64_t>(index) << kEpollIndexShift) |
+        static_cast<uint32_t>(fd);
+}
+
+uint32_t LayerImplEpoll::EpollEventsFromSocketEvents(SocketEvents events)
+{
+    return (events.Has(SocketEventFlags::kRead) ? static_cast<uint32_t>(EPOLLIN) : 0u) |
+        (events.Has(SocketEventFlags::kWrite) ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+}
+
+SocketEvents LayerImplEpoll::SocketEventsFromEpollEvents(uint32_t epollEvents, SocketEvents requested)
+{
+    SocketEvents res;
+
+    // select() reports a descriptor with a pending error or hang-up as readable and writable;
+    // epoll reports EPOLLERR/EPOLLHUP instead, so map those onto whatever the watcher asked for.
+    const bool errorOrHangup = (epollEvents & (EPOLLERR | EPOLLHUP)) != 0;
+
+    if ((epollEvents & EPOLLIN) || (errorOrHangup && requested.Has(SocketEventFlags::kRead)))
+        res.Set(SocketEventFlags::kRead);
+    if ((epollEvents & EPOLLOUT) || (errorOrHangup && requested.Has(SocketEventFlags::kWrite)))
+        res.Set(SocketEventFlags::kWrite);
+    if (epollEvents & EPOLLPRI)
+        res.Set(SocketEventFlags::kExcept);
+
+    return res;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateEpollRegistration(int fd, uint32_t current, uint32_t desired, uint64_t data)
+{
+    VerifyOrReturnError(current != desired, CHIP_NO_ERROR);
+
+    struct epoll_event event = {};
+    event.events             = desired;
+    event.data.u64           = data;
+
+    // Descriptors without any requested events are removed from the epoll instance rather than
+    // kept with an empty mask, since epoll always reports EPOLLERR/EPOLLHUP, and a level-triggered
+    // hang-up on an idle socket would otherwise wake the loop continuously.
+    int op = EPOLL_CTL_MOD;
+    if (current == 0)
+    {
+        op = EPOLL_CTL_ADD;
+    }
+    else if (desired == 0)
+    {
+        op = EPOLL_CTL_DEL;
+    }
+
+    if (epoll_ctl(mEpollFd, op, fd, &event) != 0)
+    {
+        // The descriptor may have been closed (which implicitly removes it from the epoll instance)
+        // before we got to remove it, and its number may since have been reused.
+        if (op == EPOLL_CTL_MOD && errno == ENOENT)
+        {
+            VerifyOrReturnError(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, fd, &event) == 0, CHIP_ERROR_POSIX(errno));
+            return CHIP_NO_ERROR;
+        }
+        VerifyOrReturnError(op == EPOLL_CTL_DEL && (errno == EBADF || errno == ENOENT), CHIP_ERROR_POSIX(errno));
+    }
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+CHIP_ERROR LayerImplEpoll::UpdateSocketWatch(SocketWatch & watch)
+{
+    const uint32_t desired = EpollEventsFromSocketEvents(watch.mPendingIO);
+    const auto index       = static_cast<uint32_t>(&watch - mSocketWatchPool);
+
+    ReturnErrorOnFailure(UpdateEpollRegistration(watch.mFD, watch.mRegisteredEvents, desired,
+                                                 EncodeEpollData(EpollTag::kSocketWatch, index, watch.mFD)));
+    watch.mRegisteredEvents = desired;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Already registered, return the existing token
+            *tokenOut = reinterpret_cast<SocketWatchToken>(&w);
+            return CHIP_NO_ERROR;
+        }
+        if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    // The descriptor is added to the epoll instance once callbacks are requested on it.
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateSocketWatch(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateSocketWatch(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateSocketWatch(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateSocketWatch(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    VerifyOrReturnError(tokenInOut != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    watch->mPendingIO.ClearAll();
+    CHIP_ERROR err = UpdateSocketWatch(*watch);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "Failed to remove fd %d from epoll: %" CHIP_ERROR_FORMAT, watch->mFD, err.Format());
+    }
+    watch->Clear();
+
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+enum : intptr_t
+{
+    kLoopHandlerInactive = 0, // default value for EventLoopHandler::mState
+    kLoopHandlerPending,
+    kLoopHandlerActive,
+};
+
+void LayerImplEpoll::AddLoopHandler(EventLoopHandler & handler)
+{
+    // Add the handler as pending because this method can be called at any point
+    // in a PrepareEvents() / WaitForEvents() / HandleEvents() sequence.
+    // It will be marked active when we call PrepareEvents() on it for the first time.
+    auto & state = LoopHandlerState(handler);
+    VerifyOrDie(state == kLoopHandlerInactive);
+    state = kLoopHandlerPending;
+    mLoopHandlers.PushBack(&handler);
+}
+
+void LayerImplEpoll::RemoveLoopHandler(EventLoopHandler & handler)
+{
+    mLoopHandlers.Remove(&handler);
+    LoopHandlerState(handler) = kLoopHandlerInactive;
+}
+
+void LayerImplEpoll::EventSourceAdd(EventSource * source)
+{
+    assertChipStackLockedByCurrentThread();
+    if (mSources.Contains(source))
+    {
+        ChipLogDetail(DeviceLayer, "Warning: the EventSource is already added");
+        return;
+    }
+    mSources.PushBack(source);
+}
+
+void LayerImplEpoll::EventSourceRemove(EventSource * source)
+{
+    assertChipStackLockedByCurrentThread();
+    if (mSources.Contains(source))
+    {
+        mSources.Remove(source);
+    }
+}
+
+void LayerImplEpoll::EventSourceClear()
+{
+    assertChipStackLockedByCurrentThread();
+    mSources.Clear();
+    ClearEventSourceRegistrations();
+}
+
+void LayerImplEpoll::SyncEventSourceRegistrations()
+{
+    const int maxFd = std::max(mSourceMaxFd, mSourceRegisteredMaxFd);
+    for (int fd = 0; fd <= maxFd; fd++)
+    {
+        const uint32_t current =
+            EpollEventsFromSets(fd, mSourceRegistered.mReadSet, mSourceRegistered.mWriteSet, mSourceRegistered.mErrorSet);
+        const uint32_t desired =
+            EpollEventsFromSets(fd, mSourceRequested.mReadSet, mSourceRequested.mWriteSet, mSourceRequested.mErrorSet);
+
+        CHIP_ERROR err = UpdateEpollRegistration(fd, current, desired, EncodeEpollData(EpollTag::kEventSource, 0, fd));
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(chipSystemLayer, "Failed to update epoll registration of fd %d: %" CHIP_ERROR_FORMAT, fd, err.Format());
+        }
+    }
+
+    mSourceRegistered      = mSourceRequested;
+    mSourceRegisteredMaxFd = mSourceMaxFd;
+}
+
+void LayerImplEpoll::ClearEventSourceRegistrations()
+{
+    // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+    FD_ZERO(&mSourceRequested.mReadSet);
+    FD_ZERO(&mSourceRequested.mWriteSet);
+    FD_ZERO(&mSourceRequested.mErrorSet);
+    // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+    mSourceMaxFd = -1;
+
+    if (mSourceRegisteredMaxFd >= 0)
+    {
+        SyncEventSourceRegistrations();
+    }
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer)
+    {
+        awakenTime = std::min(awakenTime, timer->AwakenTime());
+    }
+
+    // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        switch (auto & state = LoopHandlerState(loop))
+        {
+        case kLoopHandlerPending:
+            state = kLoopHandlerActive;
+            [[fallthrough]];
+        case kLoopHandlerActive:
+            awakenTime = std::min(awakenTime, loop.PrepareEvents(currentTime));
+            break;
+        }
+    }
+
+    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+    Clock::ToTimeval(sleepTime, mNextTimeout);
+
+    // Socket watches are kept registered with the epoll instance as their requests change, so only
+    // EventSources (which use the select()-style fd_set contract) need to be collected here.
+    if (!mSources.Empty() || mSourceRegisteredMaxFd >= 0)
+    {
+        // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+        FD_ZERO(&mSourceRequested.mReadSet);
+        FD_ZERO(&mSourceRequested.mWriteSet);
+        FD_ZERO(&mSourceRequested.mErrorSet);
+        // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+        mSourceMaxFd = -1;
+
+        for (auto & source : mSources)
+        {
+            source.PrepareEvents(mSourceMaxFd, mSourceRequested.mReadSet, mSourceRequested.mWriteSet, mSourceRequested.mErrorSet,
+                                 mNextTimeout);
+        }
+
+        SyncEventSourceRegistrations();
+    }
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    // Round up so that we do not wake up (and spin) just before the next timer expires.
+    const uint64_t timeoutMs =
+        static_cast<uint64_t>(mNextTimeout.tv_sec) * 1000u + (static_cast<uint64_t>(mNextTimeout.tv_usec) + 999u) / 1000u;
+    const int timeout = static_cast<int>(std::min<uint64_t>(timeoutMs, static_cast<uint64_t>(std::numeric_limits<int>::max())));
+
+    mEpollResult = epoll_wait(mEpollFd, mEpollEvents, kEpollEventsMax, timeout);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        VerifyOrReturn(errno != EINTR); // EINTR is not really an error (and we don't use it for signal handling)
+        ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    SelectSets sourceReady;
+    // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+    FD_ZERO(&sourceReady.mReadSet);
+    FD_ZERO(&sourceReady.mWriteSet);
+    FD_ZERO(&sourceReady.mErrorSet);
+    // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+
+    // Dispatch only the descriptors that are ready.
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        const uint64_t data   = mEpollEvents[i].data.u64;
+        const uint32_t events = mEpollEvents[i].events;
+        const auto tag        = static_cast<EpollTag>(data >> kEpollTagShift);
+        const auto index      = static_cast<uint32_t>((data >> kEpollIndexShift) & 0x00FFFFFF);
+        const auto fd         = static_cast<int>(static_cast<uint32_t>(data));
+
+        switch (tag)
+        {
+        case EpollTag::kWakeEvent:
+            mWakeEvent.Confirm();
+            break;
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+        case EpollTag::kSocketWatch: {
+            VerifyOrDie(index < static_cast<uint32_t>(kSocketWatchMax));
+            SocketWatch & w = mSocketWatchPool[index];
+            // An earlier callback in this pass may have stopped watching (or even replaced) this socket.
+            if (w.mFD == fd && w.mCallback != nullptr)
+            {
+                SocketEvents socketEvents = SocketEventsFromEpollEvents(events, w.mPendingIO);
+                if (socketEvents.HasAny())
+                {
+                    w.mCallback(socketEvents, w.mCallbackData);
+                }
+            }
+            break;
+        }
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+        case EpollTag::kEventSource: {
+            // Report the descriptor ready only for the sets the source asked for, as select() would.
+            const uint32_t requested =
+                EpollEventsFromSets(fd, mSourceRegistered.mReadSet, mSourceRegistered.mWriteSet, mSourceRegistered.mErrorSet);
+            const bool errorOrHangup = (events & (EPOLLERR | EPOLLHUP)) != 0;
+            if ((requested & EPOLLIN) && ((events & EPOLLIN) || errorOrHangup))
+                FD_SET(fd, &sourceReady.mReadSet);
+            if ((requested & EPOLLOUT) && ((events & EPOLLOUT) || errorOrHangup))
+                FD_SET(fd, &sourceReady.mWriteSet);
+            if ((requested & EPOLLPRI) && (events & EPOLLPRI))
+                FD_SET(fd, &sourceReady.mErrorSet);
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    for (auto & source : mSources)
+    {
+        source.ProcessEvents(sourceReady.mReadSet, sourceReady.mWriteSet, sourceReady.mErrorSet);
+    }
+
+    // Call HandleEvents for active loop handlers
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        if (LoopHandlerState(loop) == kLoopHandlerActive)
+        {
+            loop.HandleEvents();
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mRegisteredEvents = 0;
+    mCallback         = nullptr;
+    mCallbackData     = 0;
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+} // namespace System
+} // namespace chip
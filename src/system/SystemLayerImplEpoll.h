@@ -0,0 +1,240 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll().
+ *
+ *      Unlike LayerImplSelect, watched sockets are registered with the kernel once
+ *      (and modified only when their requested events change), and only the file
+ *      descriptors reported ready by epoll_wait() are dispatched. This removes the
+ *      FD_SETSIZE limit and the per-iteration O(watched sockets) cost for sockets.
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#if CHIP_SYSTEM_CONFIG_USE_LIBEV
+#error "LayerImplEpoll does not support CHIP_SYSTEM_CONFIG_USE_LIBEV"
+#endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
+
+#include <sys/epoll.h>
+#include <sys/select.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+class LayerImplEpoll : public LayerSelectLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() override { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CriticalFailure Init() override;
+    void Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CriticalFailure StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override;
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CriticalFailure ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+#endif
+
+    // LayerSelectLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+    void AddLoopHandler(EventLoopHandler & handler) override;
+    void RemoveLoopHandler(EventLoopHandler & handler) override;
+
+    // Expose the result of WaitForEvents() for non-blocking socket implementations.
+    bool IsSelectResultValid() const { return mEpollResult >= 0; }
+
+    /**
+     * @brief Abstract interface for an event source compatible with a select()-based event loop.
+     *
+     * This is the same contract as LayerImplSelect::EventSource, so that sources can be used
+     * with either event loop. The file descriptors a source adds to the sets in PrepareEvents()
+     * are mirrored into the epoll instance (added, modified or removed only when they change
+     * between iterations), and the sets passed to ProcessEvents() contain only the descriptors
+     * that epoll_wait() reported ready.
+     *
+     * @see LayerImplSelect::EventSource
+     */
+    struct EventSource : public IntrusiveListNodeBase<IntrusiveMode::Strict>
+    {
+        virtual ~EventSource() = default;
+
+        /**
+         * @brief Prepares the file descriptor sets and timeout before waiting for events.
+         *
+         * @see LayerImplSelect::EventSource::PrepareEvents
+         */
+        virtual void PrepareEvents(int & maxfd, fd_set & readfds, fd_set & writefds, fd_set & exceptfds,
+                                   struct timeval & timeout) = 0;
+
+        /**
+         * @brief Processes the results after waiting for events.
+         *
+         * @see LayerImplSelect::EventSource::ProcessEvents
+         */
+        virtual void ProcessEvents(const fd_set & readfds, const fd_set & writefds, const fd_set & exceptfds) = 0;
+    };
+
+    /**
+     * @brief Register an EventSource with this LayerImplEpoll instance.
+     *
+     * Must be called with the ChipStack lock held. Ownership of @p source is not transferred.
+     *
+     * @see LayerImplSelect::EventSourceAdd
+     */
+    void EventSourceAdd(EventSource * source);
+
+    /**
+     * @brief Unregister a previously added EventSource.
+     *
+     * Must be called with the ChipStack lock held. It is safe to call this multiple times with the same pointer.
+     *
+     * @see LayerImplSelect::EventSourceRemove
+     */
+    void EventSourceRemove(EventSource * source);
+
+    /**
+     * @brief Clear all registered EventSource instances.
+     *
+     * Must be called with the ChipStack lock held.
+     *
+     * @see LayerImplSelect::EventSourceClear
+     */
+    void EventSourceClear();
+
+protected:
+    // Tag stored in the upper bits of epoll_event::data.u64 to identify the kind of descriptor that became ready.
+    enum class EpollTag : uint8_t
+    {
+        kWakeEvent   = 0,
+        kSocketWatch = 1,
+        kEventSource = 2,
+    };
+
+    static uint64_t EncodeEpollData(EpollTag tag, uint32_t index, int fd);
+    static uint32_t EpollEventsFromSocketEvents(SocketEvents events);
+    static SocketEvents SocketEventsFromEpollEvents(uint32_t epollEvents, SocketEvents requested);
+
+    // Bring the epoll registration of @p fd from @p current to @p desired events; zero means not registered.
+    CHIP_ERROR UpdateEpollRegistration(int fd, uint32_t current, uint32_t desired, uint64_t data);
+
+    void SyncEventSourceRegistrations();
+    void ClearEventSourceRegistrations();
+
+    IntrusiveList<EventSource> mSources;
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO;
+        // Events currently registered with the epoll instance (0 if not registered).
+        uint32_t mRegisteredEvents;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+    };
+    SocketWatch mSocketWatchPool[kSocketWatchMax];
+
+    CHIP_ERROR UpdateSocketWatch(SocketWatch & watch);
+#else
+    static constexpr int kSocketWatchMax = 0;
+#endif
+
+    // Maximum number of ready descriptors retrieved per epoll_wait(). Any further ready descriptors
+    // remain pending (level-triggered) and are reported on the next iteration.
+    static constexpr int kEpollEventsMax = kSocketWatchMax + 8;
+
+    TimerPool<TimerList::Node> mTimerPool;
+    TimerQueue mTimerList;
+    // List of expired timers being processed right now.  Stored in a member so
+    // we can cancel them.
+    TimerList mExpiredTimers;
+    timeval mNextTimeout;
+
+    IntrusiveList<EventLoopHandler> mLoopHandlers;
+
+    int mEpollFd = -1;
+    struct epoll_event mEpollEvents[kEpollEventsMax];
+
+    // Return value from epoll_wait(), carried between WaitForEvents() and HandleEvents().
+    int mEpollResult;
+
+    // File descriptor sets requested by EventSources in the current iteration, and the ones mirrored
+    // into the epoll instance during the previous one.
+    struct SelectSets
+    {
+        fd_set mReadSet;
+        fd_set mWriteSet;
+        fd_set mErrorSet;
+    };
+    SelectSets mSourceRequested;
+    SelectSets mSourceRegistered;
+    int mSourceMaxFd           = -1;
+    int mSourceRegisteredMaxFd = -1;
+
+    ObjectLifeCycle mLayerState;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleSelectThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    WakeEvent mWakeEvent;
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
@@ -27,6 +27,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplFreeRTOS.h>
+#include <system/SystemPacketBuffer.h>
 
 namespace chip {
 namespace System {
@@ -47,6 +48,7 @@ CriticalFailure LayerImplFreeRTOS::Init()
 
 void LayerImplFreeRTOS::Shutdown()
 {
+    PacketBuffer::DrainSlabFreeLists();
     mLayerState.ResetFromInitialized();
 }
 
@@ -27,6 +27,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplSelect.h>
+#include <system/SystemPacketBuffer.h>
 
 #include <algorithm>
 #include <errno.h>
@@ -106,6 +107,9 @@ void LayerImplSelect::Shutdown()
     mWakeEvent.Close();
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 
+    // Return the packet buffers kept for reuse to the heap, so that they are not left allocated past the shutdown.
+    PacketBuffer::DrainSlabFreeLists();
+
     mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
 }
 
@@ -231,7 +231,7 @@ protected:
 #endif
 
     TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerQueue mTimerList;
     // List of expired timers being processed right now.  Stored in a member so
     // we can cancel them.
     TimerList mExpiredTimers;
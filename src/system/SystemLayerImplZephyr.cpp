@@ -26,6 +26,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplZephyr.h>
+#include <system/SystemPacketBuffer.h>
 
 namespace chip {
 namespace System {
@@ -42,6 +43,7 @@ CriticalFailure LayerImplZephyr::Init()
 
 void LayerImplZephyr::Shutdown()
 {
+    PacketBuffer::DrainSlabFreeLists();
     mLayerState.ResetFromInitialized();
 }
 
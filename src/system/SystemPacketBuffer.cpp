@@ -109,6 +109,189 @@ PacketBuffer * PacketBuffer::BuildFreeList()
 // Heap allocation for PacketBuffer objects.
 //
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+//
+// Freed heap buffers are kept on a free list per size class and reused by later allocations of the same class.
+// A buffer belongs to a class exactly when its alloc_size equals the class size.
+//
+
+namespace {
+
+constexpr size_t kSlabClassSizes[Stats::kNumPacketBufferSlabClasses] = {
+    CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE,
+    PacketBuffer::kMaxSizeWithoutReserve,
+    PacketBuffer::kMaxAllocSize,
+};
+
+constexpr size_t kSlabClassMaxFree[Stats::kNumPacketBufferSlabClasses] = {
+    CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE,
+    CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE,
+    CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE_LARGE,
+};
+
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE < PacketBuffer::kMaxSizeWithoutReserve,
+              "The small packet buffer class must be smaller than the MTU-sized class");
+
+// Overlaid on the start of a free block.
+struct SlabNode
+{
+    SlabNode * next;
+};
+
+SlabNode * sSlabFreeLists[Stats::kNumPacketBufferSlabClasses];
+
+// Index of the size class used for a buffer of allocSize bytes, or kNumPacketBufferSlabClasses if it is allocated
+// from the heap directly. Only buffers of exactly the maximum size use the large class, so that a buffer slightly
+// larger than the MTU is not rounded up to the size of a large buffer.
+size_t SlabClassFor(size_t allocSize)
+{
+    size_t slabClass = 0;
+    while (slabClass < Stats::kNumPacketBufferSlabClasses && kSlabClassSizes[slabClass] < allocSize)
+    {
+        slabClass++;
+    }
+    if (slabClass == Stats::kPacketBufferSlab_Large && allocSize != kSlabClassSizes[slabClass])
+    {
+        return Stats::kNumPacketBufferSlabClasses;
+    }
+    return slabClass;
+}
+
+// Capacity of the buffer that the slab allocates for allocSize bytes.
+size_t SlabCapacityFor(size_t allocSize)
+{
+    const size_t slabClass = SlabClassFor(allocSize);
+    return (slabClass < Stats::kNumPacketBufferSlabClasses) ? kSlabClassSizes[slabClass] : allocSize;
+}
+
+} // namespace
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+static Mutex sBufferPoolMutex;
+
+#define LOCK_BUF_POOL()                                                                                                            \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        sBufferPoolMutex.Lock();                                                                                                   \
+    } while (0)
+#define UNLOCK_BUF_POOL()                                                                                                          \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        sBufferPoolMutex.Unlock();                                                                                                 \
+    } while (0)
+
+#if !CHIP_SYSTEM_CONFIG_FREERTOS_LOCKING
+static const bool sBufferPoolMutexInitialized = [] {
+    SuccessOrDie(Mutex::Init(sBufferPoolMutex));
+    return true;
+}();
+#endif
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+/**
+ * Allocate a block for a packet buffer with at least @p allocSize bytes of capacity, and update @p allocSize
+ * to its actual capacity.
+ */
+PacketBuffer * PacketBuffer::SlabAllocate(size_t & allocSize)
+{
+    const size_t slabClass = SlabClassFor(allocSize);
+    if (slabClass >= Stats::kNumPacketBufferSlabClasses)
+    {
+        return static_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(kStructureSize + allocSize));
+    }
+    allocSize = kSlabClassSizes[slabClass];
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING && CHIP_SYSTEM_CONFIG_FREERTOS_LOCKING
+    if (!sBufferPoolMutex.isInitialized())
+    {
+        SuccessOrDie(Mutex::Init(sBufferPoolMutex));
+    }
+#endif
+    LOCK_BUF_POOL();
+
+    Stats::PacketBufferSlabCounters & counters = Stats::GetPacketBufferSlabCounters()[slabClass];
+    void * block                               = sSlabFreeLists[slabClass];
+    if (block != nullptr)
+    {
+        sSlabFreeLists[slabClass] = sSlabFreeLists[slabClass]->next;
+        counters.free--;
+        counters.hits++;
+    }
+    else
+    {
+        block = chip::Platform::MemoryAlloc(kStructureSize + allocSize);
+        counters.misses++;
+    }
+
+    if (block != nullptr)
+    {
+        counters.inUse++;
+        if (counters.highWatermark < counters.inUse)
+        {
+            counters.highWatermark = counters.inUse;
+        }
+    }
+
+    UNLOCK_BUF_POOL();
+
+    return static_cast<PacketBuffer *>(block);
+}
+
+/**
+ * Release the block of a packet buffer with @p allocSize bytes of capacity. Must be called with the buffer pool locked.
+ */
+void PacketBuffer::SlabFree(PacketBuffer * aPacket, size_t allocSize)
+{
+    const size_t slabClass = SlabClassFor(allocSize);
+
+    // Buffers that were allocated outside of the size classes go straight back to the heap.
+    if (slabClass < Stats::kNumPacketBufferSlabClasses && kSlabClassSizes[slabClass] == allocSize)
+    {
+        Stats::PacketBufferSlabCounters & counters = Stats::GetPacketBufferSlabCounters()[slabClass];
+        if (counters.inUse > 0)
+        {
+            counters.inUse--;
+        }
+
+        if (counters.free < kSlabClassMaxFree[slabClass])
+        {
+            SlabNode * node           = reinterpret_cast<SlabNode *>(aPacket);
+            node->next                = sSlabFreeLists[slabClass];
+            sSlabFreeLists[slabClass] = node;
+            counters.free++;
+            return;
+        }
+    }
+
+    chip::Platform::MemoryFree(aPacket);
+}
+
+void PacketBuffer::DrainSlabFreeLists()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING && CHIP_SYSTEM_CONFIG_FREERTOS_LOCKING
+    if (!sBufferPoolMutex.isInitialized())
+    {
+        SuccessOrDie(Mutex::Init(sBufferPoolMutex));
+    }
+#endif
+    LOCK_BUF_POOL();
+
+    for (size_t slabClass = 0; slabClass < Stats::kNumPacketBufferSlabClasses; slabClass++)
+    {
+        while (sSlabFreeLists[slabClass] != nullptr)
+        {
+            SlabNode * node           = sSlabFreeLists[slabClass];
+            sSlabFreeLists[slabClass] = node->next;
+            chip::Platform::MemoryFree(node);
+        }
+        Stats::GetPacketBufferSlabCounters()[slabClass].free = 0;
+    }
+
+    UNLOCK_BUF_POOL();
+}
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
 void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 {
@@ -138,13 +321,23 @@ void PacketBufferHandle::InternalRightSize()
     const uint8_t * const start   = mBuffer->ReserveStart();
     const uint8_t * const payload = mBuffer->Start();
     const size_t usedSize         = static_cast<size_t>(payload - start + static_cast<ptrdiff_t>(mBuffer->len));
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    if (SlabCapacityFor(usedSize) + kRightSizingThreshold > mBuffer->alloc_size)
+#else
     if (usedSize + kRightSizingThreshold > mBuffer->alloc_size)
+#endif
     {
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
-    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    size_t newAllocSize      = usedSize;
+    PacketBuffer * newBuffer = PacketBuffer::SlabAllocate(newAllocSize);
+#else
+    const size_t newAllocSize = usedSize;
+    const size_t blockSize    = usedSize + PacketBuffer::kStructureSize;
+    PacketBuffer * newBuffer  = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+#endif
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -159,7 +352,7 @@ void PacketBufferHandle::InternalRightSize()
     newBuffer->tot_len       = mBuffer->tot_len;
     newBuffer->len           = mBuffer->len;
     newBuffer->ref           = 1;
-    newBuffer->alloc_size    = usedSize;
+    newBuffer->alloc_size    = newAllocSize;
     memcpy(newStart, start, usedSize);
 
     PacketBuffer::Free(mBuffer);
@@ -181,6 +374,10 @@ void PacketBufferHandle::InternalRightSize()
 
 #endif
 
+#if !CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+void PacketBuffer::DrainSlabFreeLists() {}
+#endif // !CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
 #ifndef LOCK_BUF_POOL
 #define LOCK_BUF_POOL()                                                                                                            \
     do                                                                                                                             \
@@ -576,7 +773,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
     // sumOfAvailAndReserved is no larger than sumOfSizes, which we checked can be cast to
     // size_t.
-    const size_t lAllocSize = static_cast<size_t>(sumOfAvailAndReserved);
+    size_t lAllocSize = static_cast<size_t>(sumOfAvailAndReserved);
     PacketBuffer * lPacket;
 
     CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_PacketBufferNew, return PacketBufferHandle());
@@ -640,6 +837,9 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
     UNLOCK_BUF_POOL();
 
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    lPacket = PacketBuffer::SlabAllocate(lAllocSize);
+
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
     // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
     // checked to fit in a size_t.
@@ -725,11 +925,16 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+            const size_t allocSize = aPacket->alloc_size;
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+            SlabFree(aPacket, allocSize);
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             chip::Platform::MemoryFree(aPacket);
 #endif
@@ -353,6 +353,15 @@ public:
         return Read(buf, N);
     }
 
+    /**
+     * Return the freed heap buffers that are kept for reuse by later allocations (see
+     * #CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB) to the heap. The System Layer does this when it shuts down.
+     *
+     * Buffers that are freed afterwards are kept for reuse again. Does nothing if packet buffers are not
+     * allocated from the heap.
+     */
+    static void DrainSlabFreeLists();
+
     /**
      * Perform an implementation-defined check on the validity of a PacketBuffer pointer.
      *
@@ -390,6 +399,11 @@ private:
     static PacketBuffer * BuildFreeList();
 #endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL || defined(DOXYGEN)
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    static PacketBuffer * SlabAllocate(size_t & allocSize);
+    static void SlabFree(PacketBuffer * aPacket, size_t allocSize);
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
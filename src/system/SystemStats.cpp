@@ -59,6 +59,7 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 
 count_t sResourcesInUse[kNumEntries];
 count_t sHighWatermarks[kNumEntries];
+PacketBufferSlabCounters sPacketBufferSlabCounters[kNumPacketBufferSlabClasses];
 
 const Label * GetStrings()
 {
@@ -75,6 +76,11 @@ count_t * GetHighWatermarks()
     return sHighWatermarks;
 }
 
+PacketBufferSlabCounters * GetPacketBufferSlabCounters()
+{
+    return sPacketBufferSlabCounters;
+}
+
 void UpdateSnapshot(Snapshot & aSnapshot)
 {
     memcpy(&aSnapshot.mResourcesInUse, &sResourcesInUse, sizeof(aSnapshot.mResourcesInUse));
@@ -81,10 +81,34 @@ public:
     count_t mHighWatermarks[kNumEntries];
 };
 
+/**
+ * Size classes of the packet buffer slab allocator (see CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB).
+ */
+enum PacketBufferSlabClass
+{
+    kPacketBufferSlab_Small,
+    kPacketBufferSlab_Mtu,
+    kPacketBufferSlab_Large,
+    kNumPacketBufferSlabClasses
+};
+
+/**
+ * Counters of the packet buffer slab allocator for one size class.
+ */
+struct PacketBufferSlabCounters
+{
+    uint32_t hits;          ///< Allocations served from the free list.
+    uint32_t misses;        ///< Allocations that had to go to the heap.
+    uint32_t inUse;         ///< Buffers of this class currently allocated.
+    uint32_t highWatermark; ///< Largest number of buffers of this class allocated at once.
+    uint32_t free;          ///< Buffers currently held on the free list.
+};
+
 bool Difference(Snapshot & result, Snapshot & after, Snapshot & before);
 void UpdateSnapshot(Snapshot & aSnapshot);
 count_t * GetResourcesInUse();
 count_t * GetHighWatermarks();
+PacketBufferSlabCounters * GetPacketBufferSlabCounters();
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 void UpdateLwipPbufCounts(void);
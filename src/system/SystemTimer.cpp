@@ -34,6 +34,7 @@
 #include <system/SystemLayer.h>
 
 #include <lib/support/CodeUtils.h>
+#include <lib/support/FibonacciHash.h>
 
 namespace chip {
 namespace System {
@@ -178,5 +179,259 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+bool TimerHeap::IsEarlier(const Node * a, const Node * b)
+{
+    if (a->AwakenTime() != b->AwakenTime())
+    {
+        return a->AwakenTime() < b->AwakenTime();
+    }
+    // Wrap-around safe comparison of insertion order.
+    return static_cast<int32_t>(a->mSequence - b->mSequence) < 0;
+}
+
+TimerHeap::Node * TimerHeap::Meld(Node * a, Node * b)
+{
+    if (a == nullptr)
+    {
+        return b;
+    }
+    if (b == nullptr)
+    {
+        return a;
+    }
+    if (IsEarlier(b, a))
+    {
+        Node * tmp = a;
+        a          = b;
+        b          = tmp;
+    }
+
+    // Make b the leftmost child of a.
+    b->mHeapPrev    = a;
+    b->mHeapSibling = a->mHeapChild;
+    if (a->mHeapChild != nullptr)
+    {
+        a->mHeapChild->mHeapPrev = b;
+    }
+    a->mHeapChild   = b;
+    a->mHeapSibling = nullptr;
+    a->mHeapPrev    = nullptr;
+    return a;
+}
+
+TimerHeap::Node * TimerHeap::MergePairs(Node * first)
+{
+    VerifyOrReturnValue(first != nullptr, nullptr);
+
+    // First pass: meld siblings in pairs from left to right, collecting the results in reverse order.
+    Node * pairs = nullptr;
+    while (first != nullptr)
+    {
+        Node * a = first;
+        Node * b = a->mHeapSibling;
+        first    = (b != nullptr) ? b->mHeapSibling : nullptr;
+
+        a->mHeapSibling = nullptr;
+        if (b != nullptr)
+        {
+            b->mHeapSibling = nullptr;
+        }
+
+        Node * melded        = Meld(a, b);
+        melded->mHeapSibling = pairs;
+        pairs                = melded;
+    }
+
+    // Second pass: meld the pairs from right to left into a single tree.
+    Node * result        = pairs;
+    pairs                = pairs->mHeapSibling;
+    result->mHeapSibling = nullptr;
+    while (pairs != nullptr)
+    {
+        Node * next         = pairs->mHeapSibling;
+        pairs->mHeapSibling = nullptr;
+        result              = Meld(result, pairs);
+        pairs               = next;
+    }
+
+    result->mHeapPrev = nullptr;
+    return result;
+}
+
+size_t TimerHeap::IndexOf(TimerCompleteCallback onComplete, void * appState)
+{
+    uintptr_t key = (reinterpret_cast<uintptr_t>(appState) >> 3) ^
+        FibonacciHash(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(onComplete) >> 2));
+    key ^= key >> 16;
+    return static_cast<size_t>(key & (kIndexSize - 1));
+}
+
+TimerHeap::Node * TimerHeap::FindEarliest(TimerCompleteCallback onComplete, void * appState) const
+{
+    Node * found = nullptr;
+    for (Node * timer = mIndex[IndexOf(onComplete, appState)]; timer != nullptr; timer = timer->mIndexNext)
+    {
+        if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState &&
+            (found == nullptr || IsEarlier(timer, found)))
+        {
+            found = timer;
+        }
+    }
+    return found;
+}
+
+void TimerHeap::IndexInsert(Node * timer)
+{
+    Node *& bucket    = mIndex[IndexOf(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+    timer->mIndexNext = bucket;
+    bucket            = timer;
+}
+
+void TimerHeap::IndexRemove(Node * timer)
+{
+    for (Node ** link = &mIndex[IndexOf(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+         *link != nullptr; link = &(*link)->mIndexNext)
+    {
+        if (*link == timer)
+        {
+            *link             = timer->mIndexNext;
+            timer->mIndexNext = nullptr;
+            return;
+        }
+    }
+}
+
+void TimerHeap::Detach(Node * timer)
+{
+    Node * prev = timer->mHeapPrev;
+    if (prev->mHeapChild == timer)
+    {
+        prev->mHeapChild = timer->mHeapSibling;
+    }
+    else
+    {
+        prev->mHeapSibling = timer->mHeapSibling;
+    }
+    if (timer->mHeapSibling != nullptr)
+    {
+        timer->mHeapSibling->mHeapPrev = prev;
+    }
+    timer->mHeapSibling = nullptr;
+    timer->mHeapPrev    = nullptr;
+}
+
+TimerHeap::Node * TimerHeap::Add(Node * add)
+{
+    VerifyOrDie(!Contains(add));
+
+    add->mNextTimer   = nullptr;
+    add->mHeapChild   = nullptr;
+    add->mHeapSibling = nullptr;
+    add->mHeapPrev    = nullptr;
+    add->mSequence    = mNextSequence++;
+
+    mRoot = Meld(mRoot, add);
+    IndexInsert(add);
+    return mRoot;
+}
+
+TimerHeap::Node * TimerHeap::Remove(Node * remove)
+{
+    VerifyOrReturnValue(remove != nullptr && Contains(remove), mRoot);
+
+    if (remove == mRoot)
+    {
+        mRoot = MergePairs(remove->mHeapChild);
+    }
+    else
+    {
+        Detach(remove);
+        mRoot = Meld(mRoot, MergePairs(remove->mHeapChild));
+    }
+
+    remove->mHeapChild = nullptr;
+    remove->mNextTimer = nullptr;
+    IndexRemove(remove);
+    return mRoot;
+}
+
+TimerHeap::Node * TimerHeap::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = FindEarliest(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Remove(timer);
+    }
+    return timer;
+}
+
+TimerHeap::Node * TimerHeap::PopEarliest()
+{
+    Node * earliest = mRoot;
+    if (earliest != nullptr)
+    {
+        Remove(earliest);
+    }
+    return earliest;
+}
+
+TimerHeap::Node * TimerHeap::PopIfEarlier(Clock::Timestamp t)
+{
+    if ((mRoot == nullptr) || !(mRoot->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+TimerList TimerHeap::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    Node * last = nullptr;
+
+    Node * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        if (last == nullptr)
+        {
+            out.mEarliestTimer = timer;
+        }
+        else
+        {
+            last->mNextTimer = timer;
+        }
+        last = timer;
+    }
+
+    return out;
+}
+
+void TimerHeap::Clear()
+{
+    mRoot         = nullptr;
+    mNextSequence = 0;
+    for (auto & bucket : mIndex)
+    {
+        bucket = nullptr;
+    }
+}
+
+Clock::Timeout TimerHeap::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = FindEarliest(aOnComplete, aAppState);
+    VerifyOrReturnValue(timer != nullptr, Clock::kZero);
+
+    Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    if (currentTime < timer->AwakenTime())
+    {
+        return Clock::Timeout(timer->AwakenTime() - currentTime);
+    }
+    return Clock::kZero;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 } // namespace System
 } // namespace chip
@@ -116,6 +116,20 @@ public:
             TimerData(systemLayer, awakenTime, onComplete, appState), mNextTimer(nullptr)
         {}
         Node * mNextTimer;
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    private:
+        friend class TimerHeap;
+        // Pairing heap links: leftmost child, right sibling, and either the left sibling or
+        // (for a leftmost child) the parent. mHeapPrev is nullptr for the root and for nodes not in a heap.
+        Node * mHeapChild   = nullptr;
+        Node * mHeapSibling = nullptr;
+        Node * mHeapPrev    = nullptr;
+        // Next node in the same TimerHeap index bucket.
+        Node * mIndexNext = nullptr;
+        // Insertion order, used to keep timers with equal expiration times in FIFO order.
+        uint32_t mSequence = 0;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
     };
 
     TimerList() : mEarliestTimer(nullptr) {}
@@ -186,9 +200,129 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    friend class TimerHeap;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
     Node * mEarliestTimer;
 };
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+/**
+ * Collection of `Timer`s ordered by expiration time, with the same interface as TimerList.
+ *
+ * Timers are kept in a pairing heap, so adding a timer is O(1) and removing the earliest (or any) timer
+ * is O(log n) amortized. A hash index on (onComplete, appState) makes lookups by callback O(1) on average,
+ * instead of the O(n) scans that TimerList needs. Timers with equal expiration times keep FIFO order.
+ *
+ * Expired timers extracted with ExtractEarlier() are returned as a plain TimerList.
+ */
+class TimerHeap
+{
+public:
+    using Node = TimerList::Node;
+
+    TimerHeap() { Clear(); }
+
+    /**
+     * Add a timer to the heap
+     *
+     * @return  The new earliest timer in the heap. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the heap, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the heap, or nullptr if the heap is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the heap contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the heap.
+     *
+     * @return  The earliest timer, or nullptr if the heap is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the heap, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the heap.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const { return mRoot; }
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mRoot == nullptr; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, in expiration order.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the earliest timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+private:
+    static constexpr size_t kIndexSize = CHIP_SYSTEM_CONFIG_TIMER_HEAP_INDEX_SIZE;
+    static_assert(kIndexSize > 0 && (kIndexSize & (kIndexSize - 1)) == 0,
+                  "CHIP_SYSTEM_CONFIG_TIMER_HEAP_INDEX_SIZE must be a power of two");
+
+    static bool IsEarlier(const Node * a, const Node * b);
+    static Node * Meld(Node * a, Node * b);
+    static Node * MergePairs(Node * first);
+
+    static size_t IndexOf(TimerCompleteCallback onComplete, void * appState);
+    Node * FindEarliest(TimerCompleteCallback onComplete, void * appState) const;
+    void IndexInsert(Node * timer);
+    void IndexRemove(Node * timer);
+
+    bool Contains(const Node * timer) const { return timer == mRoot || timer->mHeapPrev != nullptr; }
+    void Detach(Node * timer);
+
+    Node * mRoot;
+    uint32_t mNextSequence;
+    Node * mIndex[kIndexSize];
+};
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+/**
+ * Timer collection used by System Layer implementations for pending timers.
+ */
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+using TimerQueue = TimerHeap;
+#else
+using TimerQueue = TimerList;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
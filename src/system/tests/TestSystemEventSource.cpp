@@ -17,7 +17,8 @@
 
 /**
  *    @file
- *      This is a unit test suite for <tt>chip::System::SystemLayerImplSelect</tt>
+ *      This is a unit test suite for the EventSource support of
+ *      <tt>chip::System::LayerImplSelect</tt> and <tt>chip::System::LayerImplEpoll</tt>
  *
  */
 
@@ -42,7 +43,7 @@ using namespace chip::System::Clock::Literals;
 // The fake PlatformManagerImpl does not drive the system layer event loop
 #if !CHIP_DEVICE_LAYER_TARGET_FAKE
 
-struct TestSource : public LayerImplSelect::EventSource
+struct TestSource : public LayerImpl::EventSource
 {
     TestSource() { EXPECT_EQ(wakeEvent.Open(), CHIP_NO_ERROR); }
     ~TestSource() { wakeEvent.Close(); }
@@ -101,7 +102,7 @@ struct TestSystemEventSource : public ::testing::Test
 
 TEST_F(TestSystemEventSource, OneEventSource)
 {
-    auto & impl = static_cast<LayerImplSelect &>(chip::DeviceLayer::SystemLayer());
+    auto & impl = static_cast<LayerImpl &>(chip::DeviceLayer::SystemLayer());
 
     TestSource source1;
 
@@ -136,7 +137,7 @@ TEST_F(TestSystemEventSource, OneEventSource)
 
 TEST_F(TestSystemEventSource, MultipleEventSources)
 {
-    auto & impl = static_cast<LayerImplSelect &>(chip::DeviceLayer::SystemLayer());
+    auto & impl = static_cast<LayerImpl &>(chip::DeviceLayer::SystemLayer());
 
     TestSource source1;
     TestSource source2;
@@ -169,7 +170,7 @@ TEST_F(TestSystemEventSource, MultipleEventSources)
 
 TEST_F(TestSystemEventSource, RemoveSomeEventSource)
 {
-    auto & impl = static_cast<LayerImplSelect &>(chip::DeviceLayer::SystemLayer());
+    auto & impl = static_cast<LayerImpl &>(chip::DeviceLayer::SystemLayer());
 
     TestSource source1;
     TestSource source2;
@@ -199,7 +200,7 @@ TEST_F(TestSystemEventSource, RemoveSomeEventSource)
 
 TEST_F(TestSystemEventSource, MultipleEventSourcesOfDifferentTimeout)
 {
-    auto & impl = static_cast<LayerImplSelect &>(chip::DeviceLayer::SystemLayer());
+    auto & impl = static_cast<LayerImpl &>(chip::DeviceLayer::SystemLayer());
 
     TestSource source1;
     TestSource source2;
@@ -38,7 +38,9 @@
 #include <lib/support/SafeInt.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <platform/CHIPDeviceLayer.h>
+#include <system/SystemLayerImpl.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -195,6 +197,10 @@ public:
     void CheckRead();
     void CheckSetDataLength();
     void CheckSetStart();
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    void CheckSlabReuse();
+    void CheckSlabDrain();
+#endif
 };
 
 /**
@@ -1598,6 +1604,75 @@ TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHandleRightSize)
 #endif // CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHTSIZE
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckSlabReuse)
+{
+    Stats::PacketBufferSlabCounters & small = Stats::GetPacketBufferSlabCounters()[Stats::kPacketBufferSlab_Small];
+    Stats::PacketBufferSlabCounters & mtu   = Stats::GetPacketBufferSlabCounters()[Stats::kPacketBufferSlab_Mtu];
+
+    // Allocations are rounded up to their size class.
+    PacketBufferHandle handle = PacketBufferHandle::New(10, 0);
+    ASSERT_FALSE(handle.IsNull());
+    EXPECT_EQ(handle->AllocSize(), static_cast<size_t>(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE));
+    PacketBuffer * buffer = handle.mBuffer;
+
+    // A freed buffer is reused by the next allocation of the same class.
+    const uint32_t smallHits = small.hits;
+    handle                   = nullptr;
+    handle                   = PacketBufferHandle::New(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE, 0);
+    ASSERT_FALSE(handle.IsNull());
+    EXPECT_EQ(handle.mBuffer, buffer);
+    EXPECT_EQ(small.hits, smallHits + 1);
+
+    // But not by an allocation of another class.
+    PacketBufferHandle large = PacketBufferHandle::New(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE + 1, 0);
+    ASSERT_FALSE(large.IsNull());
+    EXPECT_EQ(large->AllocSize(), PacketBuffer::kMaxSizeWithoutReserve);
+    EXPECT_NE(large.mBuffer, buffer);
+    EXPECT_GE(mtu.inUse, 1u);
+    EXPECT_GE(mtu.highWatermark, mtu.inUse);
+
+    // Only a bounded number of free buffers is kept.
+    std::vector<PacketBufferHandle> handles;
+    for (int i = 0; i < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE + 4; i++)
+    {
+        handles.push_back(PacketBufferHandle::New(0, 0));
+        ASSERT_FALSE(handles.back().IsNull());
+    }
+    handles.clear();
+    EXPECT_EQ(small.free, static_cast<uint32_t>(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_MAX_FREE));
+}
+
+TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckSlabDrain)
+{
+    Stats::PacketBufferSlabCounters & small = Stats::GetPacketBufferSlabCounters()[Stats::kPacketBufferSlab_Small];
+
+    // Freed buffers are kept for reuse...
+    PacketBufferHandle handle = PacketBufferHandle::New(0, 0);
+    ASSERT_FALSE(handle.IsNull());
+    handle = nullptr;
+    EXPECT_GE(small.free, 1u);
+
+    // ... until the System Layer shuts down.
+    LayerImpl layer;
+    ASSERT_EQ(layer.Init(), CHIP_NO_ERROR);
+    layer.Shutdown();
+    EXPECT_EQ(small.free, 0u);
+    for (size_t slabClass = 0; slabClass < Stats::kNumPacketBufferSlabClasses; slabClass++)
+    {
+        EXPECT_EQ(Stats::GetPacketBufferSlabCounters()[slabClass].free, 0u);
+    }
+
+    // The next allocation comes from the heap, and buffers freed afterwards are kept again.
+    const uint32_t misses = small.misses;
+    handle                = PacketBufferHandle::New(0, 0);
+    ASSERT_FALSE(handle.IsNull());
+    EXPECT_EQ(small.misses, misses + 1);
+    handle = nullptr;
+    EXPECT_EQ(small.free, 1u);
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
 TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHandleCloneData)
 {
     uint8_t lPayload[2 * PacketBuffer::kMaxAllocSize];
@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for <tt>chip::System::TimerHeap</tt>, checking that it orders
+ *      timers exactly like <tt>chip::System::TimerList</tt>.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+using namespace chip::System;
+
+namespace {
+
+// Timers only keep a reference to their layer, so an uninitialized one is sufficient here.
+LayerImpl gLayer;
+
+void CallbackA(Layer *, void *) {}
+void CallbackB(Layer *, void *) {}
+
+void * AppState(uintptr_t n)
+{
+    return reinterpret_cast<void *>(n * sizeof(void *));
+}
+
+// Mirrors every operation on a TimerHeap and a TimerList and checks that they agree.
+class TimerQueuePair
+{
+public:
+    size_t Add(Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState)
+    {
+        mHeapNodes.emplace_back(std::make_unique<TimerList::Node>(gLayer, awakenTime, onComplete, appState));
+        mListNodes.emplace_back(std::make_unique<TimerList::Node>(gLayer, awakenTime, onComplete, appState));
+        mHeap.Add(mHeapNodes.back().get());
+        mList.Add(mListNodes.back().get());
+        EXPECT_EQ(IndexOfHeap(mHeap.Earliest()), IndexOfList(mList.Earliest()));
+        return mHeapNodes.size() - 1;
+    }
+
+    void Remove(size_t index)
+    {
+        mHeap.Remove(mHeapNodes[index].get());
+        mList.Remove(mListNodes[index].get());
+        EXPECT_EQ(IndexOfHeap(mHeap.Earliest()), IndexOfList(mList.Earliest()));
+    }
+
+    void Remove(TimerCompleteCallback onComplete, void * appState)
+    {
+        EXPECT_EQ(IndexOfHeap(mHeap.Remove(onComplete, appState)), IndexOfList(mList.Remove(onComplete, appState)));
+        EXPECT_EQ(IndexOfHeap(mHeap.Earliest()), IndexOfList(mList.Earliest()));
+    }
+
+    void ExtractEarlierAndCompare(Clock::Timestamp t)
+    {
+        TimerList fromHeap = mHeap.ExtractEarlier(t);
+        TimerList fromList = mList.ExtractEarlier(t);
+        CompareAndDrain(fromHeap, fromList);
+    }
+
+    void PopAllAndCompare()
+    {
+        TimerList::Node * heapNode;
+        TimerList::Node * listNode;
+        do
+        {
+            heapNode = mHeap.PopEarliest();
+            listNode = mList.PopEarliest();
+            EXPECT_EQ(IndexOfHeap(heapNode), IndexOfList(listNode));
+        } while (heapNode != nullptr && listNode != nullptr);
+        EXPECT_TRUE(mHeap.Empty());
+    }
+
+private:
+    static constexpr size_t kNotFound = SIZE_MAX;
+
+    void CompareAndDrain(TimerList & fromHeap, TimerList & fromList)
+    {
+        TimerList::Node * heapNode;
+        TimerList::Node * listNode;
+        do
+        {
+            heapNode = fromHeap.PopEarliest();
+            listNode = fromList.PopEarliest();
+            EXPECT_EQ(IndexOfHeap(heapNode), IndexOfList(listNode));
+        } while (heapNode != nullptr && listNode != nullptr);
+    }
+
+    size_t IndexOfHeap(const TimerList::Node * node) const { return IndexOf(mHeapNodes, node); }
+    size_t IndexOfList(const TimerList::Node * node) const { return IndexOf(mListNodes, node); }
+
+    static size_t IndexOf(const std::vector<std::unique_ptr<TimerList::Node>> & nodes, const TimerList::Node * node)
+    {
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            if (nodes[i].get() == node)
+            {
+                return i;
+            }
+        }
+        return kNotFound;
+    }
+
+    TimerHeap mHeap;
+    TimerList mList;
+    std::vector<std::unique_ptr<TimerList::Node>> mHeapNodes;
+    std::vector<std::unique_ptr<TimerList::Node>> mListNodes;
+};
+
+TEST(TestSystemTimerHeap, OrdersLikeTimerList)
+{
+    TimerQueuePair pair;
+
+    pair.Add(Clock::Timestamp(30), CallbackA, AppState(1));
+    pair.Add(Clock::Timestamp(10), CallbackA, AppState(2));
+    pair.Add(Clock::Timestamp(20), CallbackB, AppState(1));
+    pair.Add(Clock::Timestamp(10), CallbackB, AppState(2)); // Same time as an existing timer: FIFO order.
+    pair.Add(Clock::Timestamp(40), CallbackA, AppState(1)); // Duplicate callback and app state.
+
+    pair.Remove(CallbackA, AppState(1)); // Removes the earliest match (30).
+    pair.Remove(CallbackA, AppState(7)); // Not present.
+    pair.ExtractEarlierAndCompare(Clock::Timestamp(20));
+    pair.PopAllAndCompare();
+}
+
+TEST(TestSystemTimerHeap, RandomizedAgainstTimerList)
+{
+    std::mt19937 rng(0x5eed);
+
+    for (int round = 0; round < 50; round++)
+    {
+        TimerQueuePair pair;
+        std::vector<size_t> live;
+
+        for (int i = 0; i < 200; i++)
+        {
+            TimerCompleteCallback callback = (rng() & 1) ? CallbackA : CallbackB;
+            live.push_back(pair.Add(Clock::Timestamp(rng() % 64), callback, AppState(rng() % 32)));
+
+            switch (rng() % 8)
+            {
+            case 0: {
+                size_t victim = rng() % live.size();
+                pair.Remove(live[victim]);
+                live.erase(live.begin() + static_cast<std::ptrdiff_t>(victim));
+                break;
+            }
+            case 1:
+                pair.Remove((rng() & 1) ? CallbackA : CallbackB, AppState(rng() % 32));
+                break;
+            default:
+                break;
+            }
+        }
+
+        pair.ExtractEarlierAndCompare(Clock::Timestamp(rng() % 64));
+        pair.PopAllAndCompare();
+    }
+}
+
+TEST(TestSystemTimerHeap, RemoveAbsentTimer)
+{
+    TimerHeap heap;
+    TimerList::Node node(gLayer, Clock::Timestamp(5), CallbackA, AppState(1));
+
+    EXPECT_EQ(heap.Remove(&node), nullptr);
+    EXPECT_EQ(heap.Remove(CallbackA, AppState(1)), nullptr);
+    EXPECT_EQ(heap.GetRemainingTime(CallbackA, AppState(1)), Clock::kZero);
+
+    EXPECT_EQ(heap.Add(&node), &node);
+    EXPECT_EQ(heap.Remove(&node), nullptr);
+    EXPECT_EQ(heap.Remove(&node), nullptr);
+    EXPECT_TRUE(heap.Empty());
+}
+
+} // namespace
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
@@ -72,11 +72,35 @@ constexpr MetricKey kMetricDeviceCASESessionSigma2Resume = "core_dev_case_sessio
 // CASE Session SigmaFinished
 constexpr MetricKey kMetricDeviceCASESessionSigmaFinished = "core_dev_case_session_sigma_finished";
 
+// CASE Session Sigma1 processing, from Sigma1 reception to Sigma2 being sent
+constexpr MetricKey kMetricDeviceCASESessionSigma1Processing = "core_dev_case_session_sigma1_processing";
+
+// CASE Session Sigma2 processing, from Sigma2 reception to Sigma3 being sent
+constexpr MetricKey kMetricDeviceCASESessionSigma2Processing = "core_dev_case_session_sigma2_processing";
+
+// CASE Session Sigma3 processing, from Sigma3 reception to the session being established
+constexpr MetricKey kMetricDeviceCASESessionSigma3Processing = "core_dev_case_session_sigma3_processing";
+
+// Number of peers waiting in the CASESessionManager admission queue
+constexpr MetricKey kMetricDeviceCASESessionAdmissionQueueDepth = "core_dev_case_session_admission_queue_depth";
+
+// Time from a session request to the completion of its admitted session setup, in milliseconds
+constexpr MetricKey kMetricDeviceCASESessionTimeToSession = "core_dev_case_session_time_to_session";
+
 // MRP Retry Counter
 constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Attribute reports copied from the reporting engine report cache
+constexpr MetricKey kMetricReportCacheHits = "core_report_cache_hits";
+
+// Attribute reports encoded into the reporting engine report cache
+constexpr MetricKey kMetricReportCacheMisses = "core_report_cache_misses";
+
+// Attribute reports that did not fit in the reporting engine report cache
+constexpr MetricKey kMetricReportCacheBypassed = "core_report_cache_bypassed";
+
 } // namespace Tracing
 } // namespace chip
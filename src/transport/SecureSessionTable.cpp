@@ -51,8 +51,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = CreateSession(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId,
+                                           fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -72,7 +72,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = CreateSession(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -215,7 +215,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = CreateSession(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -338,68 +338,120 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    SecureSession * result = mSessionIdIndex.Find(localSessionId);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++, candidate++)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        if (candidate != kUnsecuredSessionId && mSessionIdIndex.Find(candidate) == nullptr)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            return MakeOptional<uint16_t>(candidate);
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
+    }
+
+    return NullOptional;
+}
+
+SecureSessionTable::SessionIdIndex::~SessionIdIndex()
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::MemoryFree(mSlots);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+}
+
+CHIP_ERROR SecureSessionTable::SessionIdIndex::Insert(SecureSession * session)
+{
+    // Keep the index at most 3/4 full, so that probe sequences stay short and always end at an empty slot.
+    if ((mCount + 1) * 4 > mSize * 3)
+    {
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        ReturnErrorOnFailure(Grow());
+#else
+        ChipLogError(SecureChannel, "Session ID index is full");
+        return CHIP_ERROR_NO_MEMORY;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    }
+
+    InsertInSlots(session);
+    mCount++;
+    return CHIP_NO_ERROR;
+}
+
+void SecureSessionTable::SessionIdIndex::InsertInSlots(SecureSession * session)
+{
+    size_t slot = HomeSlot(session->GetLocalSessionId());
+    while (mSlots[slot] != nullptr)
+    {
+        slot = (slot + 1) & (mSize - 1);
+    }
+    mSlots[slot] = session;
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+CHIP_ERROR SecureSessionTable::SessionIdIndex::Grow()
+{
+    const size_t newSize = (mSize == 0) ? kInitialSize : mSize * 2;
+    auto ** newSlots     = static_cast<SecureSession **>(Platform::MemoryCalloc(newSize, sizeof(SecureSession *)));
+    VerifyOrReturnError(newSlots != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    SecureSession ** oldSlots = mSlots;
+    const size_t oldSize      = mSize;
+    mSlots                    = newSlots;
+    mSize                     = newSize;
+    for (size_t slot = 0; slot < oldSize; slot++)
+    {
+        if (oldSlots[slot] != nullptr)
         {
-            break; // Any bit clear means we have an available ID in this bucket.
+            InsertInSlots(oldSlots[slot]);
         }
     }
-    if (candidate_mask != UINT64_MAX)
+    Platform::MemoryFree(oldSlots);
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+void SecureSessionTable::SessionIdIndex::Remove(SecureSession * session)
+{
+    VerifyOrReturn(mCount > 0);
+
+    const size_t mask = mSize - 1;
+    size_t hole       = HomeSlot(session->GetLocalSessionId());
+    while (mSlots[hole] != session)
+    {
+        VerifyOrReturn(mSlots[hole] != nullptr);
+        hole = (hole + 1) & mask;
+    }
+
+    // Shift back any following entries of the probe run that may move into the hole, i.e. those whose
+    // home slot is not cyclically in (hole, slot], so that lookups never stop early at an empty slot.
+    for (size_t slot = (hole + 1) & mask; mSlots[slot] != nullptr; slot = (slot + 1) & mask)
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        const size_t home = HomeSlot(mSlots[slot]->GetLocalSessionId());
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
         {
-            candidate_mask >>= 1;
-            ++offset;
+            mSlots[hole] = mSlots[slot];
+            hole         = slot;
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
+    mSlots[hole] = nullptr;
+    mCount--;
+}
 
-    return NullOptional;
+SecureSession * SecureSessionTable::SessionIdIndex::Find(uint16_t localSessionId) const
+{
+    VerifyOrReturnValue(mCount > 0, nullptr);
+    for (size_t slot = HomeSlot(localSessionId); mSlots[slot] != nullptr; slot = (slot + 1) & (mSize - 1))
+    {
+        if (mSlots[slot]->GetLocalSessionId() == localSessionId)
+        {
+            return mSlots[slot];
+        }
+    }
+    return nullptr;
 }
 
 } // namespace Transport
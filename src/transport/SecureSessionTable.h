@@ -18,6 +18,7 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/FibonacciHash.h>
 #include <lib/support/Pool.h>
 #include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
@@ -29,6 +30,20 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+/**
+ * Number of slots of the session ID index for a session pool of @a poolSize: the smallest power of
+ * two that keeps the index at most 3/4 full.
+ */
+constexpr size_t SessionIdIndexSize(size_t poolSize)
+{
+    size_t size = 1;
+    while (size < poolSize + poolSize / 3 + 1)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
 /**
  * Handles a set of sessions.
  *
@@ -76,7 +91,11 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        mSessionIdIndex.Remove(session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -243,21 +262,81 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Session IDs are checked against the session ID index in order, starting
+     * from the mNextSessionId clue. Since at most CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
+     * IDs are in use, an unused one is found after at most that many index lookups
+     * (and usually the first one, since IDs are handed out sequentially).
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Allocate a session from the pool and add it to the session ID index.
+     */
+    template <typename... Args>
+    SecureSession * CreateSession(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        if (session != nullptr && mSessionIdIndex.Insert(session) != CHIP_NO_ERROR)
+        {
+            mEntries.ReleaseObject(session);
+            session = nullptr;
+        }
+        return session;
+    }
+
+    /**
+     * An index of the allocated sessions by local session ID, so that sessions can be looked up
+     * for every received message without walking the session pool.
+     *
+     * This is an open-addressing hash table with linear probing, kept at most 3/4 full. Entries are
+     * removed by shifting later entries of the same probe sequence back rather than by leaving tombstones.
+     *
+     * With a static session pool, the index has room for CHIP_CONFIG_SECURE_SESSION_POOL_SIZE sessions.
+     * With a heap session pool, which can hold more sessions than that, the index is allocated on first
+     * use and doubles in size whenever it would get more than 3/4 full.
+     */
+    class SessionIdIndex
+    {
+    public:
+        SessionIdIndex() = default;
+        ~SessionIdIndex();
+
+        SessionIdIndex(const SessionIdIndex &)             = delete;
+        SessionIdIndex & operator=(const SessionIdIndex &) = delete;
+
+        /**
+         * @retval CHIP_ERROR_NO_MEMORY if the index is full and cannot grow.
+         */
+        CHIP_ERROR Insert(SecureSession * session);
+        void Remove(SecureSession * session);
+        SecureSession * Find(uint16_t localSessionId) const;
+
+    private:
+        static constexpr size_t kInitialSize = SessionIdIndexSize(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
+        size_t HomeSlot(uint16_t localSessionId) const { return FibonacciHashIndex(localSessionId, mSize); }
+
+        void InsertInSlots(SecureSession * session);
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        CHIP_ERROR Grow();
+
+        SecureSession ** mSlots = nullptr;
+        size_t mSize            = 0;
+#else
+        SecureSession * mStorage[kInitialSize] = {};
+        SecureSession ** mSlots                = mStorage;
+        size_t mSize                           = kInitialSize;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        size_t mCount = 0;
+    };
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
+    SessionIdIndex mSessionIdIndex;
 
     size_t GetMaxSessionTableSize() const
     {
@@ -43,6 +43,8 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateSessionIdIndex();
+    void ValidateSessionIdIndexBeyondPoolSize();
 
 private:
     struct SessionParameters
@@ -461,5 +463,98 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+void TestSecureSessionTable::ValidateSessionIdIndex()
+{
+    SecureSessionTable table;
+    Optional<SessionHandle> sessions[7];
+
+    auto localSessionId = [&sessions](size_t index) { return sessions[index].Value()->AsSecureSession()->GetLocalSessionId(); };
+
+    table.Init();
+    table.mNextSessionId = static_cast<uint16_t>(kMaxSessionID - 1);
+
+    // Session IDs are allocated sequentially, wrapping around and skipping the unsecured session ID.
+    const uint16_t expectedIds[] = { kMaxSessionID - 1, kMaxSessionID, 1, 2, 3 };
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(expectedIds); i++)
+    {
+        sessions[i] = table.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+        ASSERT_TRUE(sessions[i].HasValue());
+        EXPECT_EQ(localSessionId(i), expectedIds[i]);
+    }
+
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(expectedIds); i++)
+    {
+        auto found = table.FindSecureSessionByLocalKey(expectedIds[i]);
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_TRUE(found.Value() == sessions[i].Value());
+    }
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(kUnsecuredSessionId).HasValue());
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(4).HasValue());
+
+    // Releasing a session removes it from the index without losing the others.
+    sessions[1].ClearValue();
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(kMaxSessionID).HasValue());
+    for (size_t i : { 0, 2, 3, 4 })
+    {
+        EXPECT_TRUE(table.FindSecureSessionByLocalKey(expectedIds[i]).HasValue());
+    }
+
+    // The released ID is available again, and IDs in use are skipped.
+    table.mNextSessionId = static_cast<uint16_t>(kMaxSessionID - 1);
+    sessions[5]          = table.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    ASSERT_TRUE(sessions[5].HasValue());
+    EXPECT_EQ(localSessionId(5), kMaxSessionID);
+
+    sessions[6] = table.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    ASSERT_TRUE(sessions[6].HasValue());
+    EXPECT_EQ(localSessionId(6), 4);
+}
+
+TEST_F(TestSecureSessionTable, ValidateSessionIdIndex)
+{
+    ValidateSessionIdIndex();
+}
+
+void TestSecureSessionTable::ValidateSessionIdIndexBeyondPoolSize()
+{
+    // A heap session pool can hold more sessions than CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, and the index grows with it.
+    // A static pool cannot, and the allocation beyond it fails.
+    constexpr size_t kSessionCount = 4 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE;
+
+    SecureSessionTable table;
+    std::vector<Optional<SessionHandle>> sessions(kSessionCount);
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+
+    table.Init();
+    for (size_t i = 0; i < kSessionCount; i++)
+    {
+        sessions[i] = table.CreateNewSecureSessionForTest(SecureSession::Type::kPASE, static_cast<uint16_t>(i + 1),
+                                                          kUndefinedNodeId, kUndefinedNodeId, CATValues(), 0,
+                                                          kUndefinedFabricIndex, config);
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        ASSERT_TRUE(sessions[i].HasValue());
+#else
+        EXPECT_EQ(sessions[i].HasValue(), i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    }
+
+    for (size_t i = 0; i < kSessionCount; i++)
+    {
+        auto found = table.FindSecureSessionByLocalKey(static_cast<uint16_t>(i + 1));
+        ASSERT_EQ(found.HasValue(), sessions[i].HasValue());
+        if (found.HasValue())
+        {
+            EXPECT_TRUE(found.Value() == sessions[i].Value());
+        }
+    }
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(static_cast<uint16_t>(kSessionCount + 1)).HasValue());
+}
+
+TEST_F(TestSecureSessionTable, ValidateSessionIdIndexBeyondPoolSize)
+{
+    ValidateSessionIdIndexBeyondPoolSize();
+}
+
 } // namespace Transport
 } // namespace chip